@@ -15,6 +15,12 @@ INCLUDEPATH += $$PWD/src
 win32:msvc: QMAKE_CXXFLAGS += /utf-8
 win32:g++:  QMAKE_CXXFLAGS += -finput-charset=UTF-8 -fexec-charset=UTF-8
 
+# Optional AVX2 kernels (qmake CONFIG+=analysis_avx2); the default build uses SSE2
+analysis_avx2 {
+    msvc: QMAKE_CXXFLAGS += /arch:AVX2
+    else: QMAKE_CXXFLAGS += -mavx2
+}
+
 SOURCES += \
     # UI Layer
     src/ui/data_import_widget.cpp \
@@ -28,12 +34,15 @@ SOURCES += \
     src/ui/trapezoid_measure_tool.cpp \
     src/ui/peak_area_tool.cpp \
     src/ui/peak_area_dialog.cpp \
+    src/ui/series_hit_grid.cpp \
     src/ui/controller/main_controller.cpp \
     src/ui/controller/curve_view_controller.cpp \
     \
     # Application Layer
     src/application/application_context.cpp \
     src/application/curve/curve_manager.cpp \
+    src/application/curve/curve_import_worker.cpp \
+    src/application/acquisition/simulated_stream_source.cpp \
     src/application/algorithm/algorithm_manager.cpp \
     src/application/algorithm/algorithm_context.cpp \
     src/application/algorithm/algorithm_coordinator.cpp \
@@ -42,17 +51,39 @@ SOURCES += \
     src/application/algorithm/algorithm_thread_manager.cpp \
     src/application/history/history_manager.cpp \
     src/application/history/add_curve_command.cpp \
+    src/application/history/add_curves_command.cpp \
     src/application/history/algorithm_command.cpp \
     src/application/history/clear_curves_command.cpp \
     src/application/history/remove_curve_command.cpp \
+    src/application/history/autosave_manager.cpp \
+    src/application/history/autosave_worker.cpp \
     src/application/project/project_tree_manager.cpp \
     \
     # Domain Layer
+    src/domain/algorithm/algorithm_descriptor.cpp \
+    src/domain/model/cumulative_integral.cpp \
+    src/domain/model/min_max_decimator.cpp \
+    src/domain/model/min_max_pyramid.cpp \
+    src/domain/model/monotonic_segment_index.cpp \
     src/domain/model/thermal_curve.cpp \
+    src/domain/model/project_document.cpp \
+    src/domain/model/thermal_data_series.cpp \
     \
     # Infrastructure Layer
+    src/infrastructure/io/column_block_io.cpp \
+    src/infrastructure/io/curve_record_io.cpp \
+    src/infrastructure/io/autosave_journal.cpp \
+    src/infrastructure/io/project_file_reader.cpp \
+    src/infrastructure/io/project_file_writer.cpp \
+    src/infrastructure/io/tcurve_file_reader.cpp \
+    src/infrastructure/io/tcurve_file_writer.cpp \
+    src/infrastructure/io/text_data_parser.cpp \
     src/infrastructure/io/text_file_reader.cpp \
+    src/infrastructure/io/text_file_follower.cpp \
+    src/infrastructure/io/text_format_sniffer.cpp \
+    src/infrastructure/acquisition/simulated_instrument.cpp \
     src/infrastructure/algorithm/differentiation_algorithm.cpp \
+    src/infrastructure/algorithm/sliding_window_difference.cpp \
     src/infrastructure/algorithm/moving_average_filter_algorithm.cpp \
     src/infrastructure/algorithm/integration_algorithm.cpp \
     src/infrastructure/algorithm/baseline_correction_algorithm.cpp \
@@ -72,12 +103,15 @@ HEADERS += \
     src/ui/trapezoid_measure_tool.h \
     src/ui/peak_area_tool.h \
     src/ui/peak_area_dialog.h \
+    src/ui/series_hit_grid.h \
     src/ui/controller/main_controller.h \
     src/ui/controller/curve_view_controller.h \
     \
     # Application Layer
     src/application/application_context.h \
     src/application/curve/curve_manager.h \
+    src/application/curve/curve_import_worker.h \
+    src/application/acquisition/simulated_stream_source.h \
     src/application/algorithm/algorithm_manager.h \
     src/application/algorithm/algorithm_context.h \
     src/application/algorithm/algorithm_coordinator.h \
@@ -86,14 +120,23 @@ HEADERS += \
     src/application/algorithm/algorithm_worker.h \
     src/application/algorithm/algorithm_thread_manager.h \
     src/application/history/add_curve_command.h \
+    src/application/history/add_curves_command.h \
     src/application/history/history_manager.h \
     src/application/history/algorithm_command.h \
     src/application/history/clear_curves_command.h \
     src/application/history/remove_curve_command.h \
+    src/application/history/autosave_manager.h \
+    src/application/history/autosave_worker.h \
     src/application/project/project_tree_manager.h \
     \
     # Domain Layer
+    src/domain/model/cumulative_integral.h \
+    src/domain/model/min_max_decimator.h \
+    src/domain/model/min_max_pyramid.h \
+    src/domain/model/monotonic_segment_index.h \
+    src/domain/model/project_document.h \
     src/domain/model/thermal_data_point.h \
+    src/domain/model/thermal_data_series.h \
     src/domain/model/thermal_curve.h \
     src/domain/algorithm/algorithm_descriptor.h \
     src/domain/algorithm/i_thermal_algorithm.h \
@@ -103,8 +146,22 @@ HEADERS += \
     \
     # Infrastructure Layer
     src/infrastructure/io/i_file_reader.h \
+    src/infrastructure/io/column_block_io.h \
+    src/infrastructure/io/curve_record_io.h \
+    src/infrastructure/io/autosave_journal.h \
+    src/infrastructure/io/project_file_format.h \
+    src/infrastructure/io/project_file_reader.h \
+    src/infrastructure/io/project_file_writer.h \
+    src/infrastructure/io/tcurve_format.h \
+    src/infrastructure/io/tcurve_file_reader.h \
+    src/infrastructure/io/tcurve_file_writer.h \
+    src/infrastructure/io/text_data_parser.h \
     src/infrastructure/io/text_file_reader.h \
+    src/infrastructure/io/text_file_follower.h \
+    src/infrastructure/io/text_format_sniffer.h \
+    src/infrastructure/acquisition/simulated_instrument.h \
     src/infrastructure/algorithm/differentiation_algorithm.h \
+    src/infrastructure/algorithm/sliding_window_difference.h \
     src/infrastructure/algorithm/moving_average_filter_algorithm.h \
     src/infrastructure/algorithm/integration_algorithm.h \
     src/infrastructure/algorithm/baseline_correction_algorithm.h \
@@ -0,0 +1,208 @@
+#include "simulated_stream_source.h"
+#include "application/curve/curve_manager.h"
+#include <QDebug>
+#include <QThread>
+#include <QTimer>
+#include <QUuid>
+#include <atomic>
+
+/**
+ * @brief 生成线程的状态（instrument/clock/pending 仅生成线程访问）
+ */
+struct SimulatedStreamSource::ProducerState {
+    explicit ProducerState(const SimulatedInstrumentConfig& config)
+        : instrument(config)
+    {
+    }
+
+    SimulatedInstrument instrument;
+    QElapsedTimer clock;
+    ThermalDataSeries pending;           // 主线程积压时合并的待发送采样
+    std::atomic<qint64> generated { 0 }; // 已生成的采样数
+    std::atomic<int> queuedBatches { 0 }; // 已排队、主线程尚未处理的批次数
+};
+
+SimulatedStreamSource::SimulatedStreamSource(CurveManager* curveManager, QObject* parent)
+    : QObject(parent)
+    , m_curveManager(curveManager)
+{
+    qDebug() << "构造:    SimulatedStreamSource";
+
+    connect(m_curveManager, &CurveManager::curveRemoved, this, &SimulatedStreamSource::onCurveRemoved);
+    connect(m_curveManager, &CurveManager::curvesCleared, this, &SimulatedStreamSource::onCurvesCleared);
+}
+
+SimulatedStreamSource::~SimulatedStreamSource()
+{
+    stop();
+}
+
+QString SimulatedStreamSource::start(const SimulatedInstrumentConfig& config)
+{
+    stop();
+
+    ++m_generation;
+    m_config = config;
+    m_curveId = QUuid::createUuid().toString();
+    m_curveCreated = false;
+    m_deliveredSamples = 0;
+    m_deliveredBatches = 0;
+    m_appendNanoseconds = 0;
+    m_lastReportMs = 0;
+    m_stoppedAtMs = -1;
+
+    auto producer = std::make_shared<ProducerState>(config);
+    m_producer = producer;
+    m_curveName = producer->instrument.signalName();
+
+    m_thread = new QThread(this);
+    m_thread->setObjectName(QStringLiteral("SimulatedStreamThread"));
+    m_timer = new QTimer();
+    m_timer->setTimerType(Qt::PreciseTimer);
+    m_timer->setInterval(BatchIntervalMs);
+    m_timer->moveToThread(m_thread);
+
+    QTimer* timer = m_timer;
+    SimulatedStreamSource* self = this;
+    const quint64 generation = m_generation;
+
+    // 以下槽均以 m_timer 为上下文，在生成线程中执行
+    connect(m_thread, &QThread::started, timer, [producer, timer]() {
+        producer->clock.start();
+        timer->start();
+    });
+    connect(m_thread, &QThread::finished, timer, &QTimer::stop, Qt::DirectConnection);
+    connect(timer, &QTimer::timeout, timer, [producer, self, generation]() {
+        // 按流逝时间补足应生成的采样（定时器间隔不精确或线程被阻塞时仍保持采样率）
+        const double rate = producer->instrument.config().sampleRateHz;
+        const qint64 due = qint64(double(producer->clock.nsecsElapsed()) * 1e-9 * rate);
+        const qint64 maxBatch = qMax<qint64>(1, qint64(rate * MaxCatchUpSeconds));
+        const qint64 missing = qMin(due - producer->instrument.sampleCount(), maxBatch);
+        if (missing <= 0) {
+            return;
+        }
+
+        const ThermalDataSeries batch = producer->instrument.generate(int(missing));
+        producer->generated.store(producer->instrument.sampleCount());
+        if (producer->pending.isEmpty()) {
+            producer->pending = batch;
+        } else {
+            producer->pending.append(batch);
+        }
+
+        // 主线程积压时先合并，等排队的批次被处理后再发送
+        if (producer->queuedBatches.load() >= MaxPendingBatches) {
+            return;
+        }
+        producer->queuedBatches.fetch_add(1);
+        const ThermalDataSeries samples = producer->pending;
+        producer->pending = ThermalDataSeries();
+        QMetaObject::invokeMethod(
+            self,
+            [self, producer, generation, samples]() {
+                producer->queuedBatches.fetch_sub(1);
+                self->deliver(generation, samples);
+            },
+            Qt::QueuedConnection);
+    });
+
+    m_clock.start();
+    m_thread->start();
+
+    qDebug() << "SimulatedStreamSource: 开始生成模拟数据" << m_curveName << "采样率:" << config.sampleRateHz << "Hz"
+             << "曲线:" << m_curveId;
+    return m_curveId;
+}
+
+void SimulatedStreamSource::stop()
+{
+    if (!m_thread) {
+        return;
+    }
+
+    m_thread->quit();
+    m_thread->wait();
+    delete m_timer;
+    m_timer = nullptr;
+    delete m_thread;
+    m_thread = nullptr;
+
+    // 丢弃仍在排队的批次
+    ++m_generation;
+    m_stoppedAtMs = m_clock.elapsed();
+
+    const SimulatedStreamStatistics stats = statistics();
+    qDebug() << "SimulatedStreamSource: 已停止" << m_curveId << "生成:" << stats.generatedSamples
+             << "追加:" << stats.deliveredSamples << "速率:" << stats.deliveredRateHz() << "Hz"
+             << "主线程追加耗时:" << stats.appendMilliseconds << "ms";
+    emit stopped(m_curveId);
+}
+
+SimulatedStreamStatistics SimulatedStreamSource::statistics() const
+{
+    SimulatedStreamStatistics stats;
+    stats.generatedSamples = m_producer ? m_producer->generated.load() : 0;
+    stats.deliveredSamples = m_deliveredSamples;
+    stats.deliveredBatches = m_deliveredBatches;
+    if (m_clock.isValid()) {
+        stats.elapsedSeconds = (m_stoppedAtMs >= 0 ? m_stoppedAtMs : m_clock.elapsed()) / 1000.0;
+    }
+    stats.appendMilliseconds = m_appendNanoseconds / 1e6;
+    return stats;
+}
+
+void SimulatedStreamSource::deliver(quint64 generation, const ThermalDataSeries& samples)
+{
+    if (generation != m_generation || samples.isEmpty()) {
+        return;
+    }
+
+    QElapsedTimer appendTimer;
+    appendTimer.start();
+
+    if (!m_curveCreated) {
+        // 首批数据建立曲线，与导入的曲线一样作为主曲线
+        ThermalCurve curve(m_curveId, QStringLiteral("[模拟]"));
+        curve.setProjectName(QStringLiteral("模拟%1 (%2 Hz)").arg(m_curveName).arg(m_config.sampleRateHz));
+        curve.setInstrumentType(m_config.instrument);
+        curve.setSignalType(SignalType::Raw);
+        curve.setRawData(samples);
+        CurveMetadata metadata;
+        metadata.device = QStringLiteral("模拟仪器");
+        metadata.sampleName = m_curveName;
+        metadata.additional.insert(QStringLiteral("sampleRateHz"), m_config.sampleRateHz);
+        curve.setMetadata(metadata);
+        curve.setIsMainCurve(true);
+        m_curveCreated = true;
+        m_curveManager->addCurve(curve);
+    } else {
+        m_curveManager->appendCurveData(m_curveId, samples);
+    }
+
+    m_appendNanoseconds += appendTimer.nsecsElapsed();
+    m_deliveredSamples += samples.size();
+    ++m_deliveredBatches;
+
+    // 压测时定期输出吞吐
+    const qint64 now = m_clock.elapsed();
+    if (now - m_lastReportMs >= 5000) {
+        m_lastReportMs = now;
+        const SimulatedStreamStatistics stats = statistics();
+        qDebug() << "SimulatedStreamSource: 已追加" << stats.deliveredSamples << "点，速率:" << stats.deliveredRateHz()
+                 << "Hz，每批平均追加耗时:" << stats.appendMilliseconds / qMax<qint64>(1, stats.deliveredBatches) << "ms";
+    }
+}
+
+void SimulatedStreamSource::onCurveRemoved(const QString& curveId)
+{
+    if (m_curveCreated && curveId == m_curveId) {
+        stop();
+    }
+}
+
+void SimulatedStreamSource::onCurvesCleared()
+{
+    if (m_curveCreated) {
+        stop();
+    }
+}
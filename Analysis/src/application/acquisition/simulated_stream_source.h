@@ -0,0 +1,99 @@
+#ifndef SIMULATED_STREAM_SOURCE_H
+#define SIMULATED_STREAM_SOURCE_H
+
+#include "infrastructure/acquisition/simulated_instrument.h"
+#include <QElapsedTimer>
+#include <QObject>
+#include <QString>
+#include <memory>
+
+class CurveManager;
+class QThread;
+class QTimer;
+
+/**
+ * @brief 模拟数据源的吞吐统计
+ */
+struct SimulatedStreamStatistics {
+    qint64 generatedSamples = 0;     // 生成线程已生成的采样数
+    qint64 deliveredSamples = 0;     // 已追加到曲线的采样数
+    qint64 deliveredBatches = 0;     // 已追加的批次数
+    double elapsedSeconds = 0.0;     // 自 start() 以来的时间
+    double appendMilliseconds = 0.0; // 主线程追加（含图表与视图对增量的处理）的累计耗时
+
+    /** 实际追加速率（采样/秒） */
+    double deliveredRateHz() const { return elapsedSeconds > 0.0 ? deliveredSamples / elapsedSeconds : 0.0; }
+};
+
+/**
+ * @brief SimulatedStreamSource 在后台线程中按设定采样率生成模拟仪器数据并实时追加到曲线
+ *
+ * 用于在没有硬件时开发和压测实时采集链路（1 Hz 到 100 kHz）：
+ * - 生成线程中的定时器每 BatchIntervalMs 按流逝时间补足应生成的采样，与定时器精度无关地保持采样率
+ * - 每批采样经进程内排队调用回到主线程，走与跟随文件相同的 CurveManager::appendCurveData() 路径
+ *   （首批数据以 addCurve() 建立曲线）
+ * - 主线程来不及处理时，生成线程把新采样合并到待发送批次中，排队中的批次数不超过 MaxPendingBatches，
+ *   内存占用有界且不丢失采样
+ *
+ * 曲线被删除或清空时自动停止。statistics() 给出实际追加速率和主线程追加耗时。
+ */
+class SimulatedStreamSource : public QObject {
+    Q_OBJECT
+
+public:
+    explicit SimulatedStreamSource(CurveManager* curveManager, QObject* parent = nullptr);
+    ~SimulatedStreamSource() override;
+
+    /**
+     * @brief 开始生成数据（正在运行时先停止上一次的数据流）
+     * @param config 信号参数
+     * @return 接收数据的曲线ID（首批数据送达时加入 CurveManager）
+     */
+    QString start(const SimulatedInstrumentConfig& config);
+
+    /**
+     * @brief 停止生成，已追加的数据保留；发射 stopped
+     */
+    void stop();
+
+    bool isRunning() const { return m_thread != nullptr; }
+
+    QString curveId() const { return m_curveId; }
+
+    SimulatedStreamStatistics statistics() const;
+
+    static constexpr int BatchIntervalMs = 20;   ///< 生成线程的出批间隔
+    static constexpr int MaxPendingBatches = 4;  ///< 排队等待主线程处理的最大批次数
+    static constexpr int MaxCatchUpSeconds = 1;  ///< 生成线程被阻塞后最多补发的时长
+
+signals:
+    void stopped(const QString& curveId);
+
+private:
+    struct ProducerState;
+
+    void deliver(quint64 generation, const ThermalDataSeries& samples);
+    void onCurveRemoved(const QString& curveId);
+    void onCurvesCleared();
+
+    CurveManager* m_curveManager; // 非拥有指针
+
+    QThread* m_thread = nullptr;
+    QTimer* m_timer = nullptr; // 位于生成线程
+    std::shared_ptr<ProducerState> m_producer;
+    quint64 m_generation = 0; // 每次 start() 递增，丢弃上一次数据流仍在排队的批次
+
+    QString m_curveId;
+    QString m_curveName;
+    SimulatedInstrumentConfig m_config;
+    bool m_curveCreated = false;
+
+    QElapsedTimer m_clock;
+    qint64 m_deliveredSamples = 0;
+    qint64 m_deliveredBatches = 0;
+    qint64 m_appendNanoseconds = 0;
+    qint64 m_lastReportMs = 0;
+    qint64 m_stoppedAtMs = -1; // 停止时的流逝时间（运行中为 -1）
+};
+
+#endif // SIMULATED_STREAM_SOURCE_H
@@ -67,6 +67,9 @@ namespace ContextKeys {
     /** 窗口大小 (int) - 用于移动平均算法 */
     inline constexpr const char* ParamWindow = "param.window";
 
+    /** 边界模式 (QString) - 用于移动平均算法："shrink"（缩窗）、"reflect"（镜像）、"valid"（仅完整窗口） */
+    inline constexpr const char* ParamEdgeMode = "param.edgeMode";
+
     /** 半窗口大小 (int) - 用于微分算法 */
     inline constexpr const char* ParamHalfWin = "param.halfWin";
 
@@ -229,7 +232,7 @@ namespace ContextKeys {
  *
  *     // 4. 获取曲线数据并执行算法
  *     const auto& inputData = curve.getProcessedData();
- *     QVector<ThermalDataPoint> result = performCalculation(inputData, windowSize);
+ *     ThermalDataSeries result = performCalculation(inputData, windowSize);
  *
  *     return QVariant::fromValue(result);
  * }
@@ -256,6 +259,7 @@ namespace ContextKeys {
  * | `ContextKeys::BaselineCurves`     | `QVector<ThermalCurve*>`  | 活动曲线的所有基线      |
  * | `ContextKeys::SelectedPoints`     | `QVector<ThermalDataPoint>`        | 用户选择的点集合        |
  * | `ContextKeys::ParamWindow`        | `int`                     | 窗口大小（移动平均）    |
+ * | `ContextKeys::ParamEdgeMode`      | `QString`                 | 边界模式（移动平均）    |
  * | `ContextKeys::ParamThreshold`     | `double`                  | 阈值（峰值检测等）      |
  * | `ContextKeys::BaselineType`       | `int`                     | 基线类型 (0=线性, 1=多项式) |
  * | `ContextKeys::FilterType`         | `QString`                 | 滤波类型 ("FFT", "MovingAverage") |
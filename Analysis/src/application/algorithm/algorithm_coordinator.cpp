@@ -3,12 +3,15 @@
 #include "application/algorithm/algorithm_context.h"
 #include "application/algorithm/algorithm_manager.h"
 #include "application/curve/curve_manager.h"
+#include "application/project/project_tree_manager.h"
 #include "domain/algorithm/algorithm_result.h"
 #include "domain/algorithm/i_thermal_algorithm.h"
 #include "domain/model/thermal_curve.h"
 #include <QDebug>
 #include <QMetaType>
 #include <QSet>
+#include <QUuid>
+#include <memory>
 
 AlgorithmCoordinator::AlgorithmCoordinator(
     AlgorithmManager* manager, CurveManager* curveManager, AlgorithmContext* context, QObject* parent)
@@ -45,6 +48,11 @@ AlgorithmCoordinator::AlgorithmCoordinator(
     qDebug() << "[AlgorithmCoordinator] 已连接异步执行信号";
 }
 
+void AlgorithmCoordinator::setProjectTreeManager(ProjectTreeManager* projectTreeManager)
+{
+    m_projectTreeManager = projectTreeManager;
+}
+
 std::optional<AlgorithmDescriptor> AlgorithmCoordinator::descriptorFor(const QString& algorithmName)
 {
     // m_algorithmManager 由依赖注入保证非空（构造函数中已 Q_ASSERT）
@@ -175,6 +183,134 @@ void AlgorithmCoordinator::handleAlgorithmTriggered(const QString& algorithmName
     }
 }
 
+void AlgorithmCoordinator::handleBatchAlgorithmTriggered(const QString& algorithmName, const QVariantMap& presetParameters)
+{
+    if (algorithmName.isEmpty()) {
+        return;
+    }
+
+    if (!m_projectTreeManager) {
+        qWarning() << "AlgorithmCoordinator::handleBatchAlgorithmTriggered - ProjectTreeManager 未设置";
+        emit algorithmFailed(algorithmName, QStringLiteral("无法获取勾选的曲线"));
+        return;
+    }
+
+    if (m_batch.has_value()) {
+        emit algorithmFailed(algorithmName, QStringLiteral("已有批量任务正在执行"));
+        return;
+    }
+
+    const QStringList curveIds = m_projectTreeManager->getCheckedCurveIds();
+    if (curveIds.isEmpty()) {
+        emit algorithmFailed(algorithmName, QStringLiteral("没有勾选的曲线，无法批量执行算法"));
+        return;
+    }
+
+    auto descriptorOpt = descriptorFor(algorithmName);
+    if (!descriptorOpt.has_value()) {
+        emit algorithmFailed(algorithmName, QStringLiteral("找不到算法或算法描述信息"));
+        return;
+    }
+
+    const AlgorithmDescriptor descriptor = descriptorOpt.value();
+
+    // 选点依赖每条曲线各自的交互，批量模式无法提供
+    if (descriptor.interaction == AlgorithmInteraction::PointSelection
+        || descriptor.interaction == AlgorithmInteraction::ParameterThenPoint) {
+        emit algorithmFailed(algorithmName, QStringLiteral("该算法需要在曲线上选点，不支持批量执行"));
+        return;
+    }
+
+    if (!ensurePrerequisites(descriptor, nullptr)) {
+        emit algorithmFailed(algorithmName, QStringLiteral("算法前置条件未满足"));
+        return;
+    }
+
+    QVariantMap parameters = presetParameters;
+    if (!populateDefaultParameters(descriptor, parameters)) {
+        emit algorithmFailed(algorithmName, QStringLiteral("缺少必需参数，无法批量执行"));
+        return;
+    }
+    QString invalidReason;
+    if (!validateAlgorithmParameters(descriptor, parameters, &invalidReason)) {
+        qWarning() << "AlgorithmCoordinator::handleBatchAlgorithmTriggered - 参数无效:" << invalidReason;
+        emit algorithmFailed(algorithmName, invalidReason);
+        return;
+    }
+
+    m_batch = BatchRun();
+    m_batch->batchId = QUuid::createUuid().toString();
+    m_batch->algorithmName = descriptor.name;
+
+    // 逐条填充批次专用的上下文副本并提交，共享上下文中的活动曲线仍是用户的选择；
+    // executeAsync 会为每个任务再克隆一份快照，曲线采样数据是共享句柄，提交本身只有引用计数开销
+    const std::unique_ptr<AlgorithmContext> batchContext(m_context->clone());
+    for (const QString& curveId : curveIds) {
+        ThermalCurve* curve = m_curveManager->getCurve(curveId);
+        if (!curve) {
+            m_batch->failures << QStringLiteral("%1: 曲线不存在").arg(curveId);
+            continue;
+        }
+
+        fillExecutionContext(batchContext.get(), descriptor, curve, parameters, {});
+        const QString taskId = m_algorithmManager->executeAsync(
+            descriptor.name, batchContext.get(), AlgorithmManager::ResultPolicy::Deferred);
+        if (taskId.isEmpty()) {
+            m_batch->failures << QStringLiteral("%1: 算法提交失败").arg(curve->name());
+            continue;
+        }
+
+        m_batch->taskIds << taskId;
+        m_batch->pendingTaskIds.insert(taskId);
+        m_batch->progress.insert(taskId, 0);
+        m_batch->sourceNames.insert(taskId, curve->name());
+    }
+
+    m_context->setValue(QStringLiteral("history/%1/lastParameters").arg(descriptor.name), parameters, "AlgorithmCoordinator");
+
+    if (m_batch->taskIds.isEmpty()) {
+        const QString reason = m_batch->failures.join('\n');
+        m_batch.reset();
+        emit algorithmFailed(algorithmName, reason);
+        return;
+    }
+
+    qDebug() << "[AlgorithmCoordinator] 批量提交算法" << descriptor.name
+             << "任务数:" << m_batch->taskIds.size() << "batchId:" << m_batch->batchId;
+
+    // 以批次ID作为任务ID通知 UI 层，单个任务的开始/进度信号不再转发
+    emit algorithmStarted(m_batch->batchId, descriptor.name);
+    reportBatchProgress();
+}
+
+bool AlgorithmCoordinator::cancelBatch(const QString& batchId)
+{
+    if (!m_batch.has_value() || m_batch->batchId != batchId) {
+        return false;
+    }
+
+    qDebug() << "[AlgorithmCoordinator] 取消批次:" << batchId
+             << "未完成任务:" << m_batch->pendingTaskIds.size();
+
+    // 执行中的任务（以及命中结果缓存、结果已在排队的任务）取消后仍会返回结果，记下以便静默丢弃；
+    // 从队列中移除的任务不再有任何信号
+    const QSet<QString> pendingTaskIds = m_batch->pendingTaskIds;
+    m_batch.reset();
+    for (const QString& taskId : pendingTaskIds) {
+        const bool running = m_algorithmManager->isTaskRunning(taskId);
+        if (!m_algorithmManager->cancelTask(taskId) || running) {
+            m_discardedBatchTaskIds.insert(taskId);
+        }
+    }
+    return true;
+}
+
+bool AlgorithmCoordinator::takeDiscardedBatchTask(const QString& taskId)
+{
+    // 结束信号（完成或失败）是任务的最后一个信号，到达后不再需要记录
+    return m_discardedBatchTaskIds.remove(taskId);
+}
+
 void AlgorithmCoordinator::handleParameterSubmission(const QString& algorithmName, const QVariantMap& parameters)
 {
     if (!m_pending.has_value() || m_pending->descriptor.name != algorithmName) {
@@ -258,6 +394,11 @@ void AlgorithmCoordinator::cancelPendingRequest()
             qWarning() << "[AlgorithmCoordinator] 任务取消失败（任务可能已完成）:" << m_currentTaskId;
         }
     }
+
+    // 3. 取消正在执行的批次
+    if (m_batch.has_value() && cancelBatch(m_batch->batchId)) {
+        emit showMessage(QStringLiteral("已取消批量执行的算法任务"));
+    }
 }
 
 void AlgorithmCoordinator::onAlgorithmResultReady(
@@ -320,75 +461,172 @@ void AlgorithmCoordinator::executeAlgorithm(
         return;
     }
 
+    // 参数来自对话框或预设，提交前按描述中的约束校验
+    QString invalidReason;
+    if (!validateAlgorithmParameters(descriptor, parameters, &invalidReason)) {
+        qWarning() << "AlgorithmCoordinator::executeAlgorithm - 参数无效:" << invalidReason;
+        emit algorithmFailed(descriptor.name, invalidReason);
+        return;
+    }
+
+    fillExecutionContext(m_context, descriptor, curve, parameters, points);
+
+    qDebug() << "[AlgorithmCoordinator] 提交算法" << descriptor.name;
+    qDebug() << "  上下文包含:" << m_context->keys().size() << "个键";
+    qDebug() << "  参数数量:" << parameters.size();
+    qDebug() << "  选点数量:" << points.size();
+
+    // 使用异步执行接口（提交到线程池）
+    QString taskId = m_algorithmManager->executeAsync(descriptor.name, m_context);
+
+    if (taskId.isEmpty()) {
+        qCritical() << "[AlgorithmCoordinator] executeAsync 返回空 taskId，执行失败！";
+        emit algorithmFailed(descriptor.name, QStringLiteral("算法提交失败"));
+        return;
+    }
+
+    // 保存任务ID，用于未来可能的取消操作
+    m_currentTaskId = taskId;
+
+    qDebug() << "[AlgorithmCoordinator] 算法已提交到异步队列，taskId =" << taskId;
+}
+
+void AlgorithmCoordinator::fillExecutionContext(AlgorithmContext* context, const AlgorithmDescriptor& descriptor,
+                                                ThermalCurve* curve, const QVariantMap& parameters,
+                                                const QVector<ThermalDataPoint>& points)
+{
     // 清空上下文中的算法相关数据，准备新的执行
-    m_context->remove(ContextKeys::ActiveCurve);
-    m_context->remove(ContextKeys::BaselineCurves);
-    m_context->remove(ContextKeys::SelectedPoints);
-    QStringList paramKeys = m_context->keys("param.");
+    context->remove(ContextKeys::ActiveCurve);
+    context->remove(ContextKeys::BaselineCurves);
+    context->remove(ContextKeys::SelectedPoints);
+    QStringList paramKeys = context->keys("param.");
     for (const QString& key : paramKeys) {
-        m_context->remove(key);
+        context->remove(key);
     }
 
     // 将主曲线设置到上下文（存储副本以确保线程安全）
-    // 当上下文被克隆时，ThermalCurve 会被深拷贝，确保工作线程拥有独立的数据副本
-    m_context->setValue(ContextKeys::ActiveCurve, QVariant::fromValue(*curve), "AlgorithmCoordinator");
+    // ThermalCurve 的采样数据是写时复制的共享句柄：复制只增加引用计数，
+    // 主线程之后对曲线的任何修改都会分离出新缓冲区，工作线程看到的快照保持不变
+    context->setValue(ContextKeys::ActiveCurve, QVariant::fromValue(*curve), "AlgorithmCoordinator");
 
     // 自动查找并注入活动曲线的基线（如果存在）
     QVector<ThermalCurve*> baselines = m_curveManager->getBaselines(curve->id());
 
     if (!baselines.isEmpty()) {
         // 注入所有基线，由算法自己决定如何使用
-        m_context->setValue(ContextKeys::BaselineCurves, QVariant::fromValue(baselines), "AlgorithmCoordinator");
+        context->setValue(ContextKeys::BaselineCurves, QVariant::fromValue(baselines), "AlgorithmCoordinator");
 
         qDebug() << "AlgorithmCoordinator::executeAlgorithm - 找到" << baselines.size()
                  << "条基线曲线，由算法决定使用哪条";
     } else {
         // 确保清除之前可能存在的基线
-        m_context->remove(ContextKeys::BaselineCurves);
+        context->remove(ContextKeys::BaselineCurves);
     }
 
     // 将参数设置到上下文（使用 param. 前缀）
     for (auto it = parameters.constBegin(); it != parameters.constEnd(); ++it) {
-        m_context->setValue(QString("param.%1").arg(it.key()), it.value(), "AlgorithmCoordinator");
+        context->setValue(QString("param.%1").arg(it.key()), it.value(), "AlgorithmCoordinator");
     }
 
     // 将选择的点设置到上下文（如果有）
     if (!points.isEmpty()) {
-        m_context->setValue(ContextKeys::SelectedPoints, QVariant::fromValue(points), "AlgorithmCoordinator");
+        context->setValue(ContextKeys::SelectedPoints, QVariant::fromValue(points), "AlgorithmCoordinator");
     }
 
     // 保存历史记录
-    m_context->setValue(QStringLiteral("history/%1/lastParameters").arg(descriptor.name), parameters, "AlgorithmCoordinator");
+    context->setValue(QStringLiteral("history/%1/lastParameters").arg(descriptor.name), parameters, "AlgorithmCoordinator");
     if (!points.isEmpty()) {
-        m_context->setValue(QStringLiteral("history/%1/lastPoints").arg(descriptor.name), QVariant::fromValue(points), "AlgorithmCoordinator");
+        context->setValue(QStringLiteral("history/%1/lastPoints").arg(descriptor.name), QVariant::fromValue(points), "AlgorithmCoordinator");
     }
+}
 
-    qDebug() << "[AlgorithmCoordinator] 提交算法" << descriptor.name;
-    qDebug() << "  上下文包含:" << m_context->keys().size() << "个键";
-    qDebug() << "  参数数量:" << parameters.size();
-    qDebug() << "  选点数量:" << points.size();
+void AlgorithmCoordinator::resetPending() { m_pending.reset(); }
 
-    // 使用异步执行接口（单线程模式，FIFO队列）
-    QString taskId = m_algorithmManager->executeAsync(descriptor.name, m_context);
+// ==================== 批量执行 ====================
 
-    if (taskId.isEmpty()) {
-        qCritical() << "[AlgorithmCoordinator] executeAsync 返回空 taskId，执行失败！";
-        emit algorithmFailed(descriptor.name, QStringLiteral("算法提交失败"));
-        return;
+bool AlgorithmCoordinator::isBatchTask(const QString& taskId) const
+{
+    return m_batch.has_value() && m_batch->progress.contains(taskId);
+}
+
+void AlgorithmCoordinator::completeBatchTask(const QString& taskId)
+{
+    m_batch->pendingTaskIds.remove(taskId);
+    m_batch->progress[taskId] = 100;
+
+    if (m_batch->pendingTaskIds.isEmpty()) {
+        finishBatch();
+    } else {
+        reportBatchProgress();
     }
+}
 
-    // 保存任务ID，用于未来可能的取消操作
-    m_currentTaskId = taskId;
+void AlgorithmCoordinator::reportBatchProgress()
+{
+    // 总进度 = 各任务进度的平均值；只在整数百分比变化时通知 UI
+    int sum = 0;
+    for (int value : m_batch->progress) {
+        sum += value;
+    }
+    const int total = m_batch->taskIds.size();
+    const int percentage = sum / total;
+    if (percentage == m_batch->lastReportedProgress) {
+        return;
+    }
+    m_batch->lastReportedProgress = percentage;
 
-    qDebug() << "[AlgorithmCoordinator] 算法已提交到异步队列，taskId =" << taskId;
+    const int finished = total - m_batch->pendingTaskIds.size();
+    emit algorithmProgress(m_batch->batchId, percentage,
+                           QStringLiteral("已完成 %1/%2 条曲线").arg(finished).arg(total));
 }
 
-void AlgorithmCoordinator::resetPending() { m_pending.reset(); }
+void AlgorithmCoordinator::finishBatch()
+{
+    const BatchRun batch = std::move(*m_batch);
+    m_batch.reset();
+
+    // 按勾选顺序汇总输出曲线
+    QVector<ThermalCurve> curves;
+    for (const QString& taskId : batch.taskIds) {
+        for (const ThermalCurve& curve : batch.outputs.value(taskId)) {
+            curves.append(curve);
+        }
+    }
+
+    qDebug() << "[AlgorithmCoordinator] 批次完成:" << batch.batchId
+             << "输出曲线:" << curves.size() << "失败:" << batch.failures.size();
+
+    if (curves.isEmpty()) {
+        const QString reason = batch.failures.isEmpty()
+            ? QStringLiteral("批量执行没有产生输出曲线")
+            : batch.failures.join('\n');
+        emit algorithmFailed(batch.algorithmName, reason);
+        return;
+    }
+
+    // 所有输出曲线作为一条历史记录提交
+    m_algorithmManager->addCurvesWithHistory(
+        curves, QStringLiteral("批量%1（%2 条曲线）").arg(batch.algorithmName).arg(curves.size()));
+
+    emit algorithmSucceeded(batch.algorithmName);
+
+    if (!batch.failures.isEmpty()) {
+        emit showMessage(QStringLiteral("批量执行 %1：%2 条曲线失败\n%3")
+                             .arg(batch.algorithmName)
+                             .arg(batch.failures.size())
+                             .arg(batch.failures.join('\n')));
+    }
+}
 
 // ==================== 异步执行槽函数实现 ====================
 
 void AlgorithmCoordinator::onAsyncAlgorithmStarted(const QString& taskId, const QString& algorithmName)
 {
+    // 批量任务的开始已在提交时以批次为单位通知
+    if (isBatchTask(taskId) || m_discardedBatchTaskIds.contains(taskId)) {
+        return;
+    }
+
     qDebug() << "[AlgorithmCoordinator] 异步任务开始执行:" << algorithmName << "taskId:" << taskId;
 
     // 转发信号到 UI 层（用于显示进度对话框等）
@@ -397,6 +635,17 @@ void AlgorithmCoordinator::onAsyncAlgorithmStarted(const QString& taskId, const
 
 void AlgorithmCoordinator::onAsyncAlgorithmProgress(const QString& taskId, int percentage, const QString& message)
 {
+    if (m_discardedBatchTaskIds.contains(taskId)) {
+        return;
+    }
+
+    // 批量任务：汇总为批次进度
+    if (isBatchTask(taskId)) {
+        m_batch->progress[taskId] = qBound(0, percentage, 100);
+        reportBatchProgress();
+        return;
+    }
+
     // 转发进度信号到 UI 层
     emit algorithmProgress(taskId, percentage, message);
 
@@ -412,6 +661,18 @@ void AlgorithmCoordinator::onAsyncAlgorithmFinished(
     qDebug() << "[AlgorithmCoordinator] 异步任务完成:" << algorithmName
              << "taskId:" << taskId << "耗时:" << elapsedMs << "ms";
 
+    // 已取消批次的任务：结果静默丢弃
+    if (takeDiscardedBatchTask(taskId)) {
+        return;
+    }
+
+    // 批量任务：收集输出曲线，全部结束后统一提交
+    if (isBatchTask(taskId)) {
+        m_batch->outputs.insert(taskId, result.curves());
+        completeBatchTask(taskId);
+        return;
+    }
+
     // 清除任务ID
     if (m_currentTaskId == taskId) {
         m_currentTaskId.clear();
@@ -439,6 +700,18 @@ void AlgorithmCoordinator::onAsyncAlgorithmFailed(
     qWarning() << "[AlgorithmCoordinator] 异步任务失败:" << algorithmName
                << "taskId:" << taskId << "错误:" << errorMessage;
 
+    // 已取消批次的任务：失败（通常是执行中被取消）不再提示
+    if (takeDiscardedBatchTask(taskId)) {
+        return;
+    }
+
+    // 批量任务：记录失败，不中断其余任务
+    if (isBatchTask(taskId)) {
+        m_batch->failures << QStringLiteral("%1: %2").arg(m_batch->sourceNames.value(taskId), errorMessage);
+        completeBatchTask(taskId);
+        return;
+    }
+
     // 清除任务ID
     if (m_currentTaskId == taskId) {
         m_currentTaskId.clear();
@@ -2,9 +2,13 @@
 #define APPLICATION_ALGORITHM_COORDINATOR_H
 
 #include "domain/algorithm/algorithm_descriptor.h"
+#include "domain/model/thermal_curve.h"
 #include "domain/model/thermal_data_point.h"
 #include <QObject>
 #include "domain/algorithm/i_thermal_algorithm.h"
+#include <QMap>
+#include <QSet>
+#include <QStringList>
 #include <QVector>
 #include <QPointF>
 #include <QVariantMap>
@@ -13,7 +17,7 @@
 class AlgorithmContext;
 class AlgorithmManager;
 class CurveManager;
-class ThermalCurve;
+class ProjectTreeManager;
 class AlgorithmResult;
 
 /**
@@ -28,7 +32,34 @@ class AlgorithmCoordinator : public QObject {
 public:
     explicit AlgorithmCoordinator(AlgorithmManager* manager, CurveManager* curveManager, AlgorithmContext* context, QObject* parent = nullptr);
 
+    /**
+     * @brief 注入项目树管理器（批量执行时从中读取勾选的曲线）
+     */
+    void setProjectTreeManager(ProjectTreeManager* projectTreeManager);
+
     void handleAlgorithmTriggered(const QString& algorithmName, const QVariantMap& presetParameters = {});
+
+    /**
+     * @brief 对项目树中所有勾选的曲线批量执行算法
+     *
+     * 每条曲线提交一个独立的异步任务，由线程池并行执行；任务结果延迟提交，
+     * 全部结束后所有输出曲线作为一条历史记录添加（一次撤销全部移除）。
+     * 进度以批次为单位通过 algorithmStarted/algorithmProgress 报告（taskId 为批次ID）。
+     *
+     * 仅支持不需要选点的算法；参数取 presetParameters，缺省项使用算法默认值。
+     *
+     * @param algorithmName 算法名称
+     * @param presetParameters 预设参数（所有曲线共用）
+     */
+    void handleBatchAlgorithmTriggered(const QString& algorithmName, const QVariantMap& presetParameters = {});
+
+    /**
+     * @brief 取消正在执行的批次（未完成的任务全部取消，已完成的结果丢弃）
+     * @param batchId 批次ID（algorithmStarted 信号中的 taskId）
+     * @return batchId 不是当前批次时返回 false
+     */
+    bool cancelBatch(const QString& batchId);
+
     void handleParameterSubmission(const QString& algorithmName, const QVariantMap& parameters);
     void handlePointSelectionResult(const QVector<ThermalDataPoint>& points);
     void cancelPendingRequest();
@@ -93,6 +124,21 @@ private:
         AwaitPoints
     };
 
+    /**
+     * @brief 正在执行的批次
+     */
+    struct BatchRun {
+        QString batchId;
+        QString algorithmName;
+        QStringList taskIds;                          ///< 按勾选顺序排列的任务ID
+        QSet<QString> pendingTaskIds;                 ///< 尚未结束的任务
+        QMap<QString, int> progress;                  ///< taskId -> 进度百分比
+        QMap<QString, QString> sourceNames;           ///< taskId -> 输入曲线名称
+        QMap<QString, QList<ThermalCurve>> outputs;   ///< taskId -> 输出曲线
+        QStringList failures;                         ///< 失败说明（曲线名称: 原因）
+        int lastReportedProgress = -1;
+    };
+
     struct PendingRequest {
         AlgorithmDescriptor descriptor;
         QString curveId;
@@ -105,16 +151,26 @@ private:
     bool ensurePrerequisites(const AlgorithmDescriptor& descriptor, ThermalCurve* curve);
     bool populateDefaultParameters(const AlgorithmDescriptor& descriptor, QVariantMap& parameters) const;
     void executeAlgorithm(const AlgorithmDescriptor& descriptor, ThermalCurve* curve, const QVariantMap& parameters, const QVector<ThermalDataPoint>& points);
+    void fillExecutionContext(AlgorithmContext* context, const AlgorithmDescriptor& descriptor, ThermalCurve* curve,
+                              const QVariantMap& parameters, const QVector<ThermalDataPoint>& points);
+    bool takeDiscardedBatchTask(const QString& taskId);
+    bool isBatchTask(const QString& taskId) const;
+    void completeBatchTask(const QString& taskId);
+    void reportBatchProgress();
+    void finishBatch();
     void resetPending();
     [[nodiscard]] std::optional<AlgorithmDescriptor> descriptorFor(const QString& algorithmName);
 
     AlgorithmManager* m_algorithmManager = nullptr;
     CurveManager* m_curveManager = nullptr;
     AlgorithmContext* m_context = nullptr;
+    ProjectTreeManager* m_projectTreeManager = nullptr;
     std::optional<PendingRequest> m_pending;
 
     // ==================== 异步执行状态 ====================
     QString m_currentTaskId;  ///< 当前正在执行的异步任务ID（用于取消）
+    std::optional<BatchRun> m_batch; ///< 当前批次（同一时间只允许一个批次）
+    QSet<QString> m_discardedBatchTaskIds; ///< 已取消批次中仍会返回结果的任务（结果到达时静默丢弃）
 };
 
 #endif // APPLICATION_ALGORITHM_COORDINATOR_H
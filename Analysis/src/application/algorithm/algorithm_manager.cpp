@@ -4,10 +4,13 @@
 #include "application/algorithm/algorithm_thread_manager.h"
 #include "application/curve/curve_manager.h"
 #include "application/history/add_curve_command.h"
+#include "application/history/add_curves_command.h"
 #include "application/history/history_manager.h"
 #include "domain/algorithm/i_thermal_algorithm.h"
 #include "domain/model/thermal_curve.h"
 #include <QColor>
+#include <QCryptographicHash>
+#include <QDataStream>
 #include <QDebug>
 #include <QUuid>
 #include <QMetaObject>
@@ -21,6 +24,8 @@ AlgorithmManager::AlgorithmManager(AlgorithmThreadManager* threadManager,
     Q_ASSERT(m_threadManager != nullptr);  // 依赖注入保证非空
     qDebug() << "构造:    AlgorithmManager";
 
+    setResultCacheCapacity(64 * 1024);  // 默认 64 MB
+
     // 注册元类型，用于跨线程信号传递
     qRegisterMetaType<AlgorithmTaskPtr>("AlgorithmTaskPtr");
     qRegisterMetaType<AlgorithmResult>("AlgorithmResult");
@@ -245,10 +250,35 @@ void AlgorithmManager::addCurveWithHistory(const ThermalCurve& curve)
     }
 }
 
+void AlgorithmManager::addCurvesWithHistory(const QVector<ThermalCurve>& curves, const QString& description)
+{
+    if (!m_curveManager) {
+        qWarning() << "CurveManager 为空，无法添加曲线";
+        return;
+    }
+
+    if (curves.isEmpty()) {
+        return;
+    }
+
+    // 使用历史管理添加曲线（整组作为一条历史记录）
+    if (m_historyManager) {
+        auto command = std::make_unique<AddCurvesCommand>(m_curveManager, curves, description);
+        m_historyManager->executeCommand(std::move(command));
+        qDebug() << "通过历史管理批量添加曲线:" << curves.size() << "条";
+    } else {
+        for (const ThermalCurve& curve : curves) {
+            m_curveManager->addCurve(curve);
+        }
+        m_curveManager->setActiveCurve(curves.last().id());
+        qDebug() << "直接批量添加曲线:" << curves.size() << "条";
+    }
+}
+
 void AlgorithmManager::createAndAddOutputCurve(
     IThermalAlgorithm* algorithm,
     ThermalCurve* parentCurve,
-    const QVector<ThermalDataPoint>& outputData,
+    const ThermalDataSeries& outputData,
     bool useHistoryManager)
 {
     if (!algorithm || !parentCurve || !m_curveManager) {
@@ -284,9 +314,116 @@ void AlgorithmManager::createAndAddOutputCurve(
     }
 }
 
+// ==================== 结果缓存 ====================
+
+void AlgorithmManager::setResultCacheCapacity(int kilobytes)
+{
+    m_resultCache.setMaxCost(qMax(0, kilobytes));
+}
+
+QString AlgorithmManager::resultCacheKey(IThermalAlgorithm* algorithm, AlgorithmContext* context) const
+{
+    if (m_resultCache.maxCost() <= 0 || !algorithm->descriptor().cacheable) {
+        return QString();
+    }
+
+    auto curve = context->get<ThermalCurve>(ContextKeys::ActiveCurve);
+    if (!curve.has_value()) {
+        return QString();
+    }
+
+    // 版本号全局唯一且随内容变化，因此无需对采样数据做哈希；
+    // 算法把输入曲线的项目名称、仪器/信号类型和元数据复制到输出曲线，这些属性变化不改版本号，须单独计入
+    QByteArray metadata;
+    {
+        QDataStream out(&metadata, QIODevice::WriteOnly);
+        const CurveMetadata& m = curve->getMetadata();
+        out << m.device << m.sampleName << m.sampleMass << m.additional;
+    }
+    QStringList parts;
+    parts << algorithm->name() << curve->id()
+          << QString::number(curve->getRawData().revision())
+          << QString::number(curve->getProcessedData().revision())
+          << curve->projectName()
+          << QString::number(static_cast<int>(curve->instrumentType()))
+          << QString::number(static_cast<int>(curve->signalType()))
+          << QString::fromLatin1(QCryptographicHash::hash(metadata, QCryptographicHash::Sha1).toHex());
+
+    // values() 返回按键排序的 QVariantMap，参数顺序因此固定；
+    // 数值统一按 double 格式化，使 5 与 5.0 得到同一个键
+    const QVariantMap params = context->values(QStringLiteral("param."));
+    for (auto it = params.constBegin(); it != params.constEnd(); ++it) {
+        const QVariant& value = it.value();
+        QString text;
+        switch (value.type()) {
+        case QVariant::Int:
+        case QVariant::UInt:
+        case QVariant::LongLong:
+        case QVariant::ULongLong:
+        case QVariant::Double:
+            text = QString::number(value.toDouble(), 'g', 17);
+            break;
+        case QVariant::Bool:
+        case QVariant::String:
+            text = value.toString();
+            break;
+        default:
+            // 列表、自定义类型等无法可靠规范化的参数：不缓存
+            return QString();
+        }
+        parts << it.key() + QLatin1Char('=') + text;
+    }
+
+    return parts.join(QChar(0x1F));  // 单元分隔符，避免与参数内容冲突
+}
+
+int AlgorithmManager::resultCacheCost(const AlgorithmResult& result)
+{
+    // 按曲线列数据估算（每个采样点 3 列 double）；原始/处理后数据共享缓冲区时只计一次
+    qint64 bytes = 0;
+    for (const ThermalCurve& curve : result.curves()) {
+        const ThermalDataSeries& processed = curve.getProcessedData();
+        const ThermalDataSeries& raw = curve.getRawData();
+        bytes += qint64(processed.size()) * 3 * qint64(sizeof(double));
+        if (!raw.isSharedWith(processed)) {
+            bytes += qint64(raw.size()) * 3 * qint64(sizeof(double));
+        }
+    }
+    return static_cast<int>(qMax<qint64>(1, bytes / 1024));
+}
+
+AlgorithmResult AlgorithmManager::withFreshCurveIds(const AlgorithmResult& result)
+{
+    const QList<ThermalCurve> curves = result.curves();
+    if (curves.isEmpty()) {
+        return result;
+    }
+
+    QMap<QString, QString> idMap;
+    for (const ThermalCurve& curve : curves) {
+        idMap.insert(curve.id(), QUuid::createUuid().toString());
+    }
+
+    AlgorithmResult copy = result;
+    for (int i = 0; i < curves.size(); ++i) {
+        ThermalCurve curve = curves[i];
+        curve.setId(idMap.value(curve.id()));
+        // 结果内部的父子关系同步改到新ID
+        if (idMap.contains(curve.parentId())) {
+            curve.setParentId(idMap.value(curve.parentId()));
+        }
+        if (i == 0) {
+            copy.setCurve(curve);
+        } else {
+            copy.addCurve(curve);
+        }
+    }
+    return copy;
+}
+
 // ==================== 异步执行实现 ====================
 
-QString AlgorithmManager::executeAsync(const QString& name, AlgorithmContext* context)
+QString AlgorithmManager::executeAsync(const QString& name, AlgorithmContext* context, ResultPolicy policy)
 {
     // 1. 验证算法
     IThermalAlgorithm* algorithm = getAlgorithm(name);
@@ -314,6 +451,24 @@ QString AlgorithmManager::executeAsync(const QString& name, AlgorithmContext* co
         return QString();
     }
 
+    // 3.5. 结果缓存：相同算法、参数与输入版本命中时直接复用，不再提交到线程池
+    const QString cacheKey = resultCacheKey(algorithm, context);
+    if (!cacheKey.isEmpty()) {
+        if (const AlgorithmResult* cached = m_resultCache.object(cacheKey)) {
+            const QString taskId = QUuid::createUuid().toString();
+            const AlgorithmResult result = withFreshCurveIds(*cached);
+            const bool deferred = (policy == ResultPolicy::Deferred);
+
+            qDebug() << "[AlgorithmManager] executeAsync: 命中结果缓存" << name << "任务" << taskId;
+
+            // 排队发布，保证调用方先拿到 taskId 再收到完成信号（与线程池路径一致）
+            QMetaObject::invokeMethod(this, [this, taskId, name, result, deferred]() {
+                publishResult(taskId, name, result, 0, deferred);
+            }, Qt::QueuedConnection);
+            return taskId;
+        }
+    }
+
     // 4. 创建上下文快照
     AlgorithmContext* contextSnapshot = context->clone();
     if (!contextSnapshot) {
@@ -325,11 +480,25 @@ QString AlgorithmManager::executeAsync(const QString& name, AlgorithmContext* co
     AlgorithmTaskPtr task = QSharedPointer<AlgorithmTask>::create(name, contextSnapshot);
     QString taskId = task->taskId();
 
+    // 5.5. 克隆算法实例，由任务独占（注册的实例只作原型，多个任务可并行执行）
+    task->setAlgorithm(algorithm->clone());
+    algorithm = task->algorithm();
+    if (!algorithm) {
+        qWarning() << "[AlgorithmManager] executeAsync: 算法克隆失败:" << name;
+        return QString();
+    }
+
     qDebug() << "[AlgorithmManager] executeAsync: 创建任务" << taskId
              << "算法:" << name;
 
     // 6. 记录活跃任务
     m_activeTasks[taskId] = task;
+    if (policy == ResultPolicy::Deferred) {
+        m_deferredTasks.insert(taskId);
+    }
+    if (!cacheKey.isEmpty()) {
+        m_taskCacheKeys.insert(taskId, cacheKey);
+    }
 
     // 7. 尝试获取工作线程
     auto [worker, thread] = m_threadManager->acquireWorker();
@@ -451,6 +620,8 @@ bool AlgorithmManager::cancelTask(const QString& taskId)
             // 从队列中移除
             m_taskQueue.removeAt(i);
             m_activeTasks.remove(taskId);
+            m_deferredTasks.remove(taskId);
+            m_taskCacheKeys.remove(taskId);
 
             qDebug() << "[AlgorithmManager] 从队列中移除任务" << taskId
                      << "剩余队列:" << m_taskQueue.size();
@@ -502,30 +673,49 @@ void AlgorithmManager::onWorkerFinished(const QString& taskId, const QVariant& r
         m_taskWorkers.remove(taskId);
     }
 
-    // 3. 处理结果
+    // 3. 写入结果缓存并发布结果
     AlgorithmResult algorithmResult = result.value<AlgorithmResult>();
+    const bool deferred = m_deferredTasks.remove(taskId);
+    const QString cacheKey = m_taskCacheKeys.take(taskId);
+
+    if (algorithmResult.isSuccess() && !cacheKey.isEmpty()) {
+        m_resultCache.insert(cacheKey, new AlgorithmResult(algorithmResult), resultCacheCost(algorithmResult));
+    }
+
+    publishResult(taskId, algorithmName, algorithmResult, elapsedMs, deferred);
+
+    // 4. 清理任务记录
+    m_activeTasks.remove(taskId);
+
+    qDebug() << "[AlgorithmManager] 任务" << taskId << "已清理，剩余活跃任务:" << m_activeTasks.size();
+}
 
+void AlgorithmManager::publishResult(const QString& taskId, const QString& algorithmName,
+                                     const AlgorithmResult& algorithmResult, qint64 elapsedMs, bool deferred)
+{
+    // Deferred 任务的结果由调用方统一提交，只发出完成/失败信号
     if (algorithmResult.isSuccess()) {
         // 成功：处理结果并发出信号
-        handleAlgorithmResult(algorithmResult);
+        if (!deferred) {
+            handleAlgorithmResult(algorithmResult);
+        }
 
         // 发出异步执行完成信号
         emit algorithmFinished(taskId, algorithmName, algorithmResult, elapsedMs);
 
         // 同时发出旧的兼容信号，供 AlgorithmCoordinator 监听
-        emit algorithmResultReady(algorithmName, algorithmResult);
+        if (!deferred) {
+            emit algorithmResultReady(algorithmName, algorithmResult);
+        }
     } else {
         // 失败：发出失败信号
         emit algorithmFailed(taskId, algorithmName, algorithmResult.errorMessage());
 
         // 同时发出旧的兼容信号
-        emit algorithmExecutionFailed(algorithmName, algorithmResult.errorMessage());
+        if (!deferred) {
+            emit algorithmExecutionFailed(algorithmName, algorithmResult.errorMessage());
+        }
     }
-
-    // 4. 清理任务记录
-    m_activeTasks.remove(taskId);
-
-    qDebug() << "[AlgorithmManager] 任务" << taskId << "已清理，剩余活跃任务:" << m_activeTasks.size();
 }
 
 void AlgorithmManager::onWorkerFailed(const QString& taskId, const QString& errorMessage)
@@ -554,6 +744,8 @@ void AlgorithmManager::onWorkerFailed(const QString& taskId, const QString& erro
 
     // 4. 清理任务记录
     m_activeTasks.remove(taskId);
+    m_deferredTasks.remove(taskId);
+    m_taskCacheKeys.remove(taskId);
 
     qDebug() << "[AlgorithmManager] 任务" << taskId << "已清理，剩余活跃任务:" << m_activeTasks.size();
 }
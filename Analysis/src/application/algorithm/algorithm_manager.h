@@ -3,6 +3,7 @@
 
 #include "domain/algorithm/i_thermal_algorithm.h"
 #include "algorithm_task.h"
+#include <QCache>
 #include <QMap>
 #include <QObject>
 #include <QString>
@@ -10,6 +11,7 @@
 #include <QVariantMap>
 #include <QQueue>
 #include <QSet>
+#include <QVector>
 
 // 前置声明
 class ThermalCurve;
@@ -27,6 +29,8 @@ class AlgorithmThreadManager;
  * - 通过 ApplicationContext 管理生命周期（依赖注入）
  * - 所有依赖（ThreadManager、HistoryManager）通过构造函数或 setter 注入
  * - 支持同步执行（executeWithContext）和异步执行（executeAsync）
+ * - 异步执行带结果缓存：descriptor().cacheable 的算法以相同参数作用于同一版本的曲线时，
+ *   直接复用上次的结果，不再提交到线程池
  */
 class AlgorithmManager : public QObject {
     Q_OBJECT
@@ -55,6 +59,14 @@ public:
      */
     void executeWithContext(const QString& name, AlgorithmContext* context);
 
+    /**
+     * @brief 异步任务结果的处理方式
+     */
+    enum class ResultPolicy {
+        Apply,    ///< 任务完成后立即处理结果（添加曲线、发出标注点等）
+        Deferred  ///< 只通过 algorithmFinished 返回结果，由调用方统一提交（批量执行）
+    };
+
     /**
      * @brief 异步执行算法（在工作线程中执行）
      *
@@ -63,15 +75,43 @@ public:
      * 执行流程：
      * 1. 验证算法和上下文有效性
      * 2. 调用 prepareContext() 验证数据完整性
+     * 2.5 可缓存的算法先查结果缓存，命中时排队发布缓存结果（曲线换新ID）并直接返回
      * 3. 创建上下文快照（context->clone()）
-     * 4. 创建任务并尝试分配工作线程
+     * 4. 创建任务（任务独占 algorithm->clone() 得到的算法实例）并尝试分配工作线程
      * 5. 如果所有线程忙，则加入队列等待
      *
      * @param name 算法名称
      * @param context 算法上下文（将被克隆）
+     * @param policy 结果处理方式（Deferred 时不添加曲线、不发出 algorithmResultReady）
      * @return 任务ID（UUID），用于跟踪和取消任务；失败返回空字符串
      */
-    QString executeAsync(const QString& name, AlgorithmContext* context);
+    QString executeAsync(const QString& name, AlgorithmContext* context,
+                         ResultPolicy policy = ResultPolicy::Apply);
+
+    /**
+     * @brief 将一组曲线作为单条历史记录添加（一次撤销全部移除）
+     *
+     * 用于提交 Deferred 任务收集到的输出曲线。
+     *
+     * @param curves 要添加的曲线
+     * @param description 历史记录描述
+     */
+    void addCurvesWithHistory(const QVector<ThermalCurve>& curves, const QString& description);
+
+    /**
+     * @brief 设置结果缓存容量
+     *
+     * 容量按缓存结果中曲线采样数据的大小估算（LRU 淘汰）。
+     * 缓存的曲线与画布上的曲线共享采样缓冲区，实际额外占用通常小于估算值。
+     *
+     * @param kilobytes 容量（KB），0 表示禁用缓存
+     */
+    void setResultCacheCapacity(int kilobytes);
+
+    /**
+     * @brief 清空结果缓存
+     */
+    void clearResultCache() { m_resultCache.clear(); }
 
     /**
      * @brief 取消正在执行或排队的任务
@@ -81,6 +121,13 @@ public:
      */
     bool cancelTask(const QString& taskId);
 
+    /**
+     * @brief 任务是否已交给工作线程执行
+     *
+     * 执行中的任务无法立即停止，取消后仍会发出 algorithmFinished 或 algorithmFailed。
+     */
+    bool isTaskRunning(const QString& taskId) const { return m_taskWorkers.contains(taskId); }
+
     /**
      * @brief 获取当前排队任务数量
      */
@@ -200,11 +247,42 @@ private:
     // 添加曲线（使用历史管理）
     void addCurveWithHistory(const ThermalCurve& curve);
 
+    /**
+     * @brief 发布任务结果（处理结果并发出完成/失败信号）
+     *
+     * 工作线程完成的任务与命中缓存的任务共用此路径。
+     *
+     * @param deferred 为 true 时不处理结果、不发出兼容信号（ResultPolicy::Deferred）
+     */
+    void publishResult(const QString& taskId, const QString& algorithmName,
+                       const AlgorithmResult& result, qint64 elapsedMs, bool deferred);
+
+    // ==================== 结果缓存 ====================
+
+    /**
+     * @brief 计算结果缓存键
+     *
+     * 键由算法名称、活动曲线（ID、原始/处理后数据版本号，以及算法会复制到输出曲线的项目名称、
+     * 仪器类型、信号类型和元数据）和排序后的 param.* 组成；曲线名称不影响输出，不计入。
+     * 算法不可缓存，或参数值无法规范化为字符串时返回空字符串。
+     */
+    QString resultCacheKey(IThermalAlgorithm* algorithm, AlgorithmContext* context) const;
+
+    /**
+     * @brief 估算结果的缓存代价（KB）
+     */
+    static int resultCacheCost(const AlgorithmResult& result);
+
+    /**
+     * @brief 复制缓存的结果并为输出曲线分配新ID（每次执行都产生新曲线）
+     */
+    static AlgorithmResult withFreshCurveIds(const AlgorithmResult& result);
+
     // 创建输出曲线的通用方法（向后兼容，已废弃）
     void createAndAddOutputCurve(
         IThermalAlgorithm* algorithm,
         ThermalCurve* parentCurve,
-        const QVector<ThermalDataPoint>& outputData,
+        const ThermalDataSeries& outputData,
         bool useHistoryManager = false);
 
     // ==================== 异步执行私有方法 ====================
@@ -264,7 +342,7 @@ private:
      */
     struct QueuedTask {
         AlgorithmTaskPtr task;           ///< 任务对象
-        IThermalAlgorithm* algorithm;    ///< 算法实例
+        IThermalAlgorithm* algorithm;    ///< 算法实例（任务独占的副本，由 task 持有）
         QString algorithmName;           ///< 算法名称（冗余，便于调试）
     };
 
@@ -272,6 +350,11 @@ private:
     QMap<QString, AlgorithmTaskPtr> m_activeTasks;     ///< 活跃任务映射（taskId -> task）
     QMap<QString, AlgorithmWorker*> m_taskWorkers;     ///< 任务-工作线程映射（taskId -> worker）
     QSet<AlgorithmWorker*> m_connectedWorkers;         ///< 已连接信号的工作线程集合
+    QSet<QString> m_deferredTasks;                     ///< 结果延迟提交的任务（ResultPolicy::Deferred）
+
+    // ==================== 结果缓存成员 ====================
+    QCache<QString, AlgorithmResult> m_resultCache;    ///< 缓存键 -> 结果（LRU，代价单位 KB）
+    QMap<QString, QString> m_taskCacheKeys;            ///< 执行中任务的缓存键（taskId -> key）
 
 public:
     void setHistoryManager(class HistoryManager* manager) { m_historyManager = manager; }
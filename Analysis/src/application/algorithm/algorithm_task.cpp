@@ -1,5 +1,6 @@
 #include "algorithm_task.h"
 #include "algorithm_context.h"
+#include "domain/algorithm/i_thermal_algorithm.h"
 #include "domain/model/thermal_curve.h"
 #include <QDebug>
 
@@ -10,14 +11,14 @@ AlgorithmTask::AlgorithmTask(const QString& algorithmName, AlgorithmContext* con
     , m_createdAt(QDateTime::currentDateTime())
     , m_isCancelled(false)
 {
-    // 线程安全处理：从上下文中提取原始曲线指针，创建深拷贝
-    // 这样工作线程访问的是独立的副本，不受主线程修改影响
+    // 线程安全处理：从上下文中提取原始曲线指针，创建副本
+    // 采样数据为写时复制的共享句柄，复制开销为常数；主线程后续修改会自动分离，不影响工作线程
     if (m_contextSnapshot) {
         auto curvePtr = m_contextSnapshot->get<ThermalCurve*>(ContextKeys::ActiveCurve);
         if (curvePtr.has_value() && curvePtr.value()) {
             ThermalCurve* originalCurve = curvePtr.value();
 
-            // 创建深拷贝（使用拷贝构造函数）
+            // 创建副本（使用拷贝构造函数，采样数据共享）
             m_curveCopy.reset(new ThermalCurve(*originalCurve));
 
             // 将深拷贝的指针替换到上下文中
@@ -46,3 +47,8 @@ AlgorithmTask::~AlgorithmTask()
     delete m_contextSnapshot;
     m_contextSnapshot = nullptr;
 }
+
+void AlgorithmTask::setAlgorithm(IThermalAlgorithm* algorithm)
+{
+    m_algorithm.reset(algorithm);
+}
@@ -8,6 +8,7 @@
 #include <QScopedPointer>
 
 class AlgorithmContext;
+class IThermalAlgorithm;
 class ThermalCurve;
 
 /**
@@ -18,6 +19,7 @@ class ThermalCurve;
  *
  * 设计要点：
  * - 任务独占上下文快照（m_contextSnapshot），析构时自动清理
+ * - 任务独占算法实例（由注册的原型 clone() 得到），不同任务可在多个工作线程上并行执行
  * - 使用 QUuid 生成全局唯一的任务ID
  * - 支持取消标志（m_isCancelled）
  * - 记录创建时间戳用于调试和监控
@@ -56,6 +58,17 @@ public:
      */
     AlgorithmContext* context() const { return m_contextSnapshot; }
 
+    /**
+     * @brief 设置任务独占的算法实例
+     * @param algorithm 算法实例（通常为注册原型的 clone()，任务接管所有权）
+     */
+    void setAlgorithm(IThermalAlgorithm* algorithm);
+
+    /**
+     * @brief 获取任务独占的算法实例
+     */
+    IThermalAlgorithm* algorithm() const { return m_algorithm.data(); }
+
     /**
      * @brief 检查任务是否被取消
      */
@@ -78,9 +91,12 @@ private:
     QDateTime m_createdAt;               ///< 创建时间戳
     bool m_isCancelled;                  ///< 取消标志
 
-    /// 曲线深拷贝（线程安全）- 从原始指针创建的副本，任务独占所有权
+    /// 曲线副本（线程安全）- 从原始指针创建的副本，任务独占所有权，采样数据为写时复制的共享句柄
     /// 创建后，上下文中的指针会被更新为指向这个拷贝
     QScopedPointer<ThermalCurve> m_curveCopy;
+
+    /// 任务独占的算法实例（克隆自注册的原型），随任务一起释放
+    QScopedPointer<IThermalAlgorithm> m_algorithm;
 };
 
 /// 智能指针类型别名
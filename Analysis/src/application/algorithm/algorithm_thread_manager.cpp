@@ -5,11 +5,10 @@
 
 AlgorithmThreadManager::AlgorithmThreadManager(QObject* parent)
     : QObject(parent)
-    , m_maxThreads(1)  // 默认单线程模式（v1.2 设计）
+    , m_maxThreads(qMax(1, QThread::idealThreadCount()))  // 默认按 CPU 核心数并行
 {
     qDebug() << "[ThreadManager] Initialized with maxThreads:" << m_maxThreads
-             << "(single-threaded async mode, idealThreadCount:"
-             << QThread::idealThreadCount() << ")";
+             << "(idealThreadCount:" << QThread::idealThreadCount() << ")";
 }
 
 AlgorithmThreadManager::~AlgorithmThreadManager()
@@ -14,16 +14,14 @@ class AlgorithmWorker;
  *
  * 设计要点：
  * - 通过 ApplicationContext 管理生命周期（依赖注入）
- * - 默认单线程模式（maxThreads = 1），适用于用户交互驱动的低并发场景
- * - 支持配置最大线程数（通过 setMaxThreads）
+ * - 默认线程数为 QThread::idealThreadCount()，不同曲线上的独立分析可并行执行
+ * - 支持配置最大线程数（通过 setMaxThreads，设为 1 即退回单线程 FIFO 模式）
  * - 工作线程按需创建，达到上限后等待空闲线程
  * - 析构时自动清理所有线程（quit + wait）
  *
- * 单线程模式优势：
- * - FIFO 执行顺序，简单直观
- * - 避免资源竞争和死锁
- * - 降低调试复杂度
- * - 适合峰面积计算等单个慢速算法场景
+ * 并行安全性：
+ * - 每个任务持有独立的算法实例（IThermalAlgorithm::clone()），进度报告器互不干扰
+ * - 任务使用上下文快照和曲线副本，采样数据为只读共享的写时复制缓冲区
  */
 class AlgorithmThreadManager : public QObject {
     Q_OBJECT
@@ -44,7 +42,7 @@ public:
 
     /**
      * @brief 设置最大线程数
-     * @param maxThreads 最大线程数（默认 1）
+     * @param maxThreads 最大线程数（默认 QThread::idealThreadCount()）
      *
      * 注意：只能在启动时调用，运行时修改无效（已创建的线程不会被销毁）。
      */
@@ -42,7 +42,7 @@ public slots:
     /**
      * @brief 执行算法任务（必须在工作线程中调用）
      * @param task 任务对象（使用 QSharedPointer）
-     * @param algorithm 算法实例（注意：从主线程共享，只读访问）
+     * @param algorithm 算法实例（任务独占的副本，生命周期由 task 管理）
      *
      * 执行流程：
      * 1. 验证参数有效性
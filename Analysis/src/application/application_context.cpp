@@ -1,10 +1,12 @@
 ﻿#include "application_context.h"
 
+#include "application/acquisition/simulated_stream_source.h"
 #include "application/algorithm/algorithm_context.h"
 #include "application/algorithm/algorithm_coordinator.h"
 #include "application/algorithm/algorithm_manager.h"
 #include "application/algorithm/algorithm_thread_manager.h"
 #include "application/curve/curve_manager.h"
+#include "application/history/autosave_manager.h"
 #include "application/history/history_manager.h"
 #include "application/project/project_tree_manager.h"
 #include "infrastructure/algorithm/baseline_correction_algorithm.h"
@@ -25,8 +27,7 @@ ApplicationContext::ApplicationContext(QObject* parent)
     // ==================== 正确的依赖注入初始化顺序 ====================
 
     // 1. 基础设施层（无依赖）
-    m_threadManager = new AlgorithmThreadManager(this);
-    m_threadManager->setMaxThreads(1);  // 配置：默认单线程模式
+    m_threadManager = new AlgorithmThreadManager(this);  // 默认线程数 = QThread::idealThreadCount()
 
     m_historyManager = new HistoryManager(this);
 
@@ -43,6 +44,8 @@ ApplicationContext::ApplicationContext(QObject* parent)
 
     m_algorithmContext = new AlgorithmContext(this);
 
+    m_autosaveManager = new AutosaveManager(m_curveManager, m_historyManager, this);
+
     m_algorithmCoordinator = new AlgorithmCoordinator(
         m_algorithmManager,
         m_curveManager,
@@ -51,6 +54,7 @@ ApplicationContext::ApplicationContext(QObject* parent)
     );
 
     m_projectTreeManager = new ProjectTreeManager(m_curveManager, this);
+    m_algorithmCoordinator->setProjectTreeManager(m_projectTreeManager);  // 批量执行读取勾选曲线
 
     // 4. 表示层（UI）
     m_chartView = new ChartView();
@@ -86,6 +90,7 @@ ApplicationContext::ApplicationContext(QObject* parent)
         this
     );
     m_mainController->setCurveViewController(m_curveViewController);
+    m_mainController->setAutosaveManager(m_autosaveManager);
 
     // ==================== 完整性校验与状态标记 ====================
     // 所有依赖注入完成后，调用 initialize() 进行完整性校验
@@ -101,7 +106,22 @@ ApplicationContext::~ApplicationContext()
     m_mainWindow = nullptr;
 }
 
-void ApplicationContext::start() { m_mainWindow->show(); }
+void ApplicationContext::start()
+{
+    m_mainWindow->show();
+
+    // 先询问是否恢复上次异常退出的自动保存，再开始新的日志
+    m_mainController->offerAutosaveRecovery();
+    m_autosaveManager->start();
+}
+
+void ApplicationContext::startSimulatedInstrument(const SimulatedInstrumentConfig& config)
+{
+    if (!m_simulatedSource) {
+        m_simulatedSource = new SimulatedStreamSource(m_curveManager, this);
+    }
+    m_simulatedSource->start(config);
+}
 
 void ApplicationContext::registerAlgorithms()
 {
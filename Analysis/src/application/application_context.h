@@ -15,6 +15,9 @@ class AlgorithmCoordinator;
 class AlgorithmThreadManager;
 class AlgorithmManager;
 class HistoryManager;
+class AutosaveManager;
+class SimulatedStreamSource;
+struct SimulatedInstrumentConfig;
 
 /**
  * @brief ApplicationContext 统一管理应用启动时的 MVC 各实例创建顺序。
@@ -41,6 +44,13 @@ public:
      */
     void start();
 
+    /**
+     * @brief 启动模拟仪器数据流（开发与压测实时采集链路用，见 SimulatedStreamSource）
+     *
+     * 须在 start() 之后调用；再次调用时替换上一个数据流。
+     */
+    void startSimulatedInstrument(const SimulatedInstrumentConfig& config);
+
 private:
     /**
      * @brief 注册所有内置算法到 AlgorithmManager
@@ -52,6 +62,8 @@ private:
     // Infrastructure（基础设施层）
     AlgorithmThreadManager* m_threadManager { nullptr };
     HistoryManager* m_historyManager { nullptr };
+    AutosaveManager* m_autosaveManager { nullptr };
+    SimulatedStreamSource* m_simulatedSource { nullptr }; // 按需创建
 
     // Application Layer（应用层）
     AlgorithmManager* m_algorithmManager { nullptr };
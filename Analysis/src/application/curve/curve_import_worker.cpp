@@ -0,0 +1,268 @@
+#include "curve_import_worker.h"
+#include "infrastructure/io/i_file_reader.h"
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QFileInfo>
+#include <QRunnable>
+#include <QThread>
+#include <QThreadPool>
+#include <QTimer>
+#include <atomic>
+#include <exception>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief 批量导入中的一个文件及其结果（结果只由读取它的线程池线程写入）
+ */
+struct FileImportJob {
+    QString filePath;
+    const IFileReader* reader = nullptr;
+    ThermalCurve curve;
+    QString error;
+    std::atomic<int> percentage { 0 };
+};
+
+/**
+ * @brief 在线程池中读取一个文件；进度写入 job，取消跟随整个批量任务
+ */
+class FileImportRunnable : public QRunnable, public IProgressReporter {
+public:
+    FileImportRunnable(const QVariantMap& config, const QAtomicInt* cancelled, FileImportJob* job)
+        : m_config(config)
+        , m_cancelled(cancelled)
+        , m_job(job)
+    {
+    }
+
+    void run() override
+    {
+        try {
+            m_job->curve = m_job->reader->read(m_job->filePath, m_config, this);
+            if (!shouldCancel() && m_job->curve.getRawData().isEmpty()) {
+                m_job->error = QStringLiteral("无法读取文件或文件中没有可解析的数据");
+            }
+        } catch (const std::exception& e) {
+            m_job->error = QStringLiteral("读取文件失败：%1").arg(QString::fromLocal8Bit(e.what()));
+        } catch (...) {
+            m_job->error = QStringLiteral("读取文件时发生未知异常");
+        }
+        m_job->percentage.store(100);
+    }
+
+    void reportProgress(int percentage, const QString& /*message*/) override
+    {
+        m_job->percentage.store(qBound(0, percentage, 100));
+    }
+
+    bool shouldCancel() const override { return m_cancelled->loadAcquire() != 0; }
+
+private:
+    QVariantMap m_config;
+    const QAtomicInt* m_cancelled;
+    FileImportJob* m_job;
+};
+
+} // namespace
+
+CurveImportWorker::CurveImportWorker(QObject* parent)
+    : QObject(parent)
+{
+    qDebug() << "构造:    CurveImportWorker";
+
+    // 子对象随 moveToThread() 一起移动到导入线程，在导入线程中启动与触发
+    m_followTimer = new QTimer(this);
+    m_followTimer->setInterval(FollowIntervalMs);
+    connect(m_followTimer, &QTimer::timeout, this, &CurveImportWorker::pollFollowedFiles);
+}
+
+CurveImportWorker::~CurveImportWorker() = default;
+
+void CurveImportWorker::importFile(const CurveImportTaskPtr& task)
+{
+    if (!task || !task->reader) {
+        qWarning() << "[CurveImportWorker] importFile called with invalid task";
+        emit importFailed(task ? task->taskId : QString(), QStringLiteral("无效的导入任务"));
+        return;
+    }
+
+    // 排队期间已被取消的任务直接跳过
+    if (task->cancelled.loadAcquire()) {
+        emit importCancelled(task->taskId);
+        return;
+    }
+
+    m_currentTask = task;
+    emit importStarted(task->taskId, task->filePath);
+    qDebug() << "[CurveImportWorker] 开始导入" << task->filePath << "thread:" << QThread::currentThread();
+
+    QElapsedTimer timer;
+    timer.start();
+
+    try {
+        ThermalCurve curve = task->reader->read(task->filePath, task->config, this);
+
+        if (shouldCancel()) {
+            qDebug() << "[CurveImportWorker] 导入已取消:" << task->filePath;
+            emit importCancelled(task->taskId);
+        } else if (curve.getRawData().isEmpty()) {
+            emit importFailed(task->taskId, QStringLiteral("无法读取文件或文件中没有可解析的数据：%1").arg(task->filePath));
+        } else {
+            qDebug() << "[CurveImportWorker] 导入完成:" << task->filePath << "耗时" << timer.elapsed() << "ms";
+            emit importFinished(task->taskId, curve);
+        }
+    } catch (const std::exception& e) {
+        qCritical() << "[CurveImportWorker] 读取文件失败:" << task->filePath << "错误:" << e.what();
+        emit importFailed(task->taskId, QStringLiteral("读取文件失败：%1").arg(QString::fromLocal8Bit(e.what())));
+    } catch (...) {
+        qCritical() << "[CurveImportWorker] 读取文件时发生未知异常:" << task->filePath;
+        emit importFailed(task->taskId, QStringLiteral("读取文件时发生未知异常"));
+    }
+
+    m_currentTask.clear();
+}
+
+void CurveImportWorker::importFiles(const CurveImportTaskPtr& task)
+{
+    if (!task || task->filePaths.isEmpty() || task->readers.size() != task->filePaths.size()) {
+        qWarning() << "[CurveImportWorker] importFiles called with invalid task";
+        emit importFailed(task ? task->taskId : QString(), QStringLiteral("无效的导入任务"));
+        return;
+    }
+    if (task->cancelled.loadAcquire()) {
+        emit importCancelled(task->taskId);
+        return;
+    }
+
+    m_currentTask = task;
+    emit importStarted(task->taskId, task->filePath);
+
+    QElapsedTimer timer;
+    timer.start();
+
+    const int fileCount = task->filePaths.size();
+    std::vector<FileImportJob> jobs(static_cast<size_t>(fileCount));
+    for (int i = 0; i < fileCount; ++i) {
+        jobs[size_t(i)].filePath = task->filePaths[i];
+        jobs[size_t(i)].reader = task->readers[i];
+    }
+
+    // 每个文件由一个线程顺序读取；文件间并发，并发数受核数与磁盘并发限制
+    QThreadPool pool;
+    pool.setMaxThreadCount(qBound(1, qMin(QThread::idealThreadCount(), MaxConcurrentFiles), fileCount));
+    for (FileImportJob& job : jobs) {
+        pool.start(new FileImportRunnable(task->config, &task->cancelled, &job));
+    }
+
+    int lastPercentage = -1;
+    while (!pool.waitForDone(100)) {
+        int total = 0;
+        int done = 0;
+        for (const FileImportJob& job : jobs) {
+            const int percentage = job.percentage.load();
+            total += percentage;
+            done += percentage >= 100 ? 1 : 0;
+        }
+        const int percentage = total / fileCount;
+        if (percentage != lastPercentage) {
+            lastPercentage = percentage;
+            reportProgress(percentage, QStringLiteral("已完成 %1/%2 个文件").arg(done).arg(fileCount));
+        }
+    }
+
+    if (shouldCancel()) {
+        qDebug() << "[CurveImportWorker] 批量导入已取消:" << task->filePath;
+        emit importCancelled(task->taskId);
+        m_currentTask.clear();
+        return;
+    }
+
+    QVector<ThermalCurve> curves;
+    QStringList errors;
+    curves.reserve(fileCount);
+    for (FileImportJob& job : jobs) {
+        if (job.error.isEmpty()) {
+            curves.append(std::move(job.curve));
+        } else {
+            errors.append(QStringLiteral("%1：%2").arg(QFileInfo(job.filePath).fileName(), job.error));
+        }
+    }
+
+    qDebug() << "[CurveImportWorker] 批量导入完成:" << task->filePath << "成功" << curves.size() << "/" << fileCount
+             << "耗时" << timer.elapsed() << "ms";
+    if (curves.isEmpty()) {
+        emit importFailed(task->taskId, errors.join('\n'));
+    } else {
+        emit importBatchFinished(task->taskId, curves, errors);
+    }
+    m_currentTask.clear();
+}
+
+void CurveImportWorker::followFile(const QString& curveId, const IFileReader* reader, const QString& filePath,
+                                   const QVariantMap& config, qint64 offset)
+{
+    std::unique_ptr<IFileFollower> follower = reader ? reader->createFollower(filePath, config, offset) : nullptr;
+    if (!follower) {
+        emit followStopped(curveId, QStringLiteral("该文件格式不支持跟随读取"));
+        return;
+    }
+
+    m_followers[curveId] = std::move(follower);
+    if (!m_followTimer->isActive()) {
+        m_followTimer->start();
+    }
+    qDebug() << "[CurveImportWorker] 开始跟随文件" << filePath << "曲线:" << curveId << "起始位置:" << offset;
+}
+
+void CurveImportWorker::stopFollowing(const QString& curveId)
+{
+    if (m_followers.erase(curveId) > 0) {
+        qDebug() << "[CurveImportWorker] 停止跟随曲线" << curveId;
+    }
+    if (m_followers.empty()) {
+        m_followTimer->stop();
+    }
+}
+
+void CurveImportWorker::stopAllFollowing()
+{
+    m_followers.clear();
+    m_followTimer->stop();
+}
+
+void CurveImportWorker::pollFollowedFiles()
+{
+    for (auto it = m_followers.begin(); it != m_followers.end();) {
+        ThermalDataSeries samples;
+        const IFileFollower::PollResult result = it->second->poll(&samples);
+        if (result == IFileFollower::PollResult::Appended) {
+            emit followDataAppended(it->first, samples);
+        } else if (result == IFileFollower::PollResult::Truncated || result == IFileFollower::PollResult::Failed) {
+            qWarning() << "[CurveImportWorker] 停止跟随曲线" << it->first << ":" << it->second->errorString();
+            emit followStopped(it->first, it->second->errorString());
+            it = m_followers.erase(it);
+            continue;
+        }
+        ++it;
+    }
+    if (m_followers.empty()) {
+        m_followTimer->stop();
+    }
+}
+
+// IProgressReporter 接口实现
+
+void CurveImportWorker::reportProgress(int percentage, const QString& message)
+{
+    if (!m_currentTask) {
+        return;
+    }
+    // 通过 Qt 信号槽机制排队传递到主线程
+    emit importProgress(m_currentTask->taskId, percentage, message);
+}
+
+bool CurveImportWorker::shouldCancel() const
+{
+    return m_currentTask && m_currentTask->cancelled.loadAcquire() != 0;
+}
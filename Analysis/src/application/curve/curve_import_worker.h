@@ -0,0 +1,133 @@
+#ifndef CURVE_IMPORT_WORKER_H
+#define CURVE_IMPORT_WORKER_H
+
+#include "domain/algorithm/i_progress_reporter.h"
+#include "domain/model/thermal_curve.h"
+#include <QAtomicInt>
+#include <QObject>
+#include <QSharedPointer>
+#include <QString>
+#include <QStringList>
+#include <QVariantMap>
+#include <QVector>
+#include <memory>
+#include <map>
+
+class IFileFollower;
+class IFileReader;
+class QTimer;
+
+/**
+ * @brief 一次文件导入任务
+ *
+ * 由 CurveManager 创建并持有，导入线程只读访问；取消标志可在任意线程设置。
+ */
+struct CurveImportTask {
+    QString taskId;                      ///< 任务唯一ID（UUID）
+    QString filePath;                    ///< 文件路径
+    QVariantMap config;                  ///< 用户导入配置
+    const IFileReader* reader = nullptr; ///< 读取器（由 CurveManager 持有，生命周期长于任务）
+    QAtomicInt cancelled;                ///< 取消标志（非 0 表示已请求取消）
+
+    // 批量导入（importFiles）：filePath 为所在文件夹，各文件与其读取器一一对应
+    QStringList filePaths;
+    QVector<const IFileReader*> readers;
+};
+
+using CurveImportTaskPtr = QSharedPointer<CurveImportTask>;
+
+/**
+ * @brief 文件导入工作线程执行器
+ *
+ * 在独立的 I/O 线程中调用 IFileReader::read()，实现 IProgressReporter 接口，
+ * 使读取器能够报告解析进度并响应取消。
+ *
+ * 设计要点：
+ * - 由 CurveManager 创建并通过 moveToThread() 移动到导入线程
+ * - 通过排队调用 importFile() 执行任务，多个导入按提交顺序依次执行
+ * - 取消通过任务的原子标志实现，不依赖导入线程的事件循环
+ * - 结果通过信号排队传回 CurveManager（主线程）
+ *
+ * 信号流程：
+ * 1. importStarted(taskId, filePath) - 开始读取
+ * 2. importProgress(taskId, percentage, message) - 进度更新
+ * 3. importFinished(taskId, curve) / importFailed(taskId, error) / importCancelled(taskId)
+ *
+ * 批量导入：importFiles() 在线程池中同时读取多个文件（并发数受 CPU 核数与 MaxConcurrentFiles 限制），
+ * 全部完成后以一个 importBatchFinished(taskId, curves, errors) 按文件顺序送回所有曲线。
+ *
+ * 跟随模式：followFile() 之后由导入线程中的定时器按 FollowIntervalMs 轮询文件，
+ * 每次只解析新追加的字节，增量通过 followDataAppended(curveId, samples) 送回主线程，
+ * 直到 stopFollowing() 或文件被截断/读取失败（followStopped）。轮询与导入在同一线程中依次执行。
+ */
+class CurveImportWorker : public QObject, public IProgressReporter {
+    Q_OBJECT
+
+public:
+    explicit CurveImportWorker(QObject* parent = nullptr);
+    ~CurveImportWorker() override;
+
+    // IProgressReporter 接口实现（仅在导入线程中由读取器调用）
+    void reportProgress(int percentage, const QString& message = QString()) override;
+    bool shouldCancel() const override;
+
+public slots:
+    /**
+     * @brief 执行导入任务（必须在导入线程中调用）
+     * @param task 导入任务
+     */
+    void importFile(const CurveImportTaskPtr& task);
+
+    /**
+     * @brief 并发读取批量导入任务中的所有文件（必须在导入线程中调用）
+     * @param task 批量导入任务（filePaths/readers）
+     *
+     * 部分文件失败时其余曲线照常返回，失败原因放在 errors 中；全部失败时发射 importFailed。
+     */
+    void importFiles(const CurveImportTaskPtr& task);
+
+    /**
+     * @brief 开始跟随读取文件新追加的数据（必须在导入线程中调用）
+     * @param curveId 接收增量的曲线
+     * @param reader 初次导入所用的读取器（由 CurveManager 持有）
+     * @param filePath 文件路径
+     * @param config 初次导入的配置
+     * @param offset 初次导入已解析的字节数
+     */
+    void followFile(const QString& curveId, const IFileReader* reader, const QString& filePath, const QVariantMap& config,
+                    qint64 offset);
+
+    /**
+     * @brief 停止跟随（必须在导入线程中调用；曲线未在跟随时不做任何操作）
+     */
+    void stopFollowing(const QString& curveId);
+
+    /**
+     * @brief 停止所有跟随并停止轮询定时器（必须在导入线程中调用，导入线程退出前调用）
+     */
+    void stopAllFollowing();
+
+signals:
+    void importStarted(const QString& taskId, const QString& filePath);
+    void importProgress(const QString& taskId, int percentage, const QString& message);
+    void importFinished(const QString& taskId, const ThermalCurve& curve);
+    void importFailed(const QString& taskId, const QString& errorMessage);
+    void importCancelled(const QString& taskId);
+    void importBatchFinished(const QString& taskId, const QVector<ThermalCurve>& curves, const QStringList& errors);
+
+    void followDataAppended(const QString& curveId, const ThermalDataSeries& samples);
+    void followStopped(const QString& curveId, const QString& reason);
+
+public:
+    static constexpr int FollowIntervalMs = 500; ///< 跟随模式的轮询间隔
+    static constexpr int MaxConcurrentFiles = 8; ///< 批量导入同时读取的最大文件数（限制磁盘并发）
+
+private:
+    void pollFollowedFiles();
+
+    CurveImportTaskPtr m_currentTask; ///< 当前执行的任务（仅导入线程访问）
+    QTimer* m_followTimer = nullptr;  ///< 跟随轮询定时器（子对象，随工作对象移动到导入线程）
+    std::map<QString, std::unique_ptr<IFileFollower>> m_followers; ///< 正在跟随的曲线（仅导入线程访问）
+};
+
+#endif // CURVE_IMPORT_WORKER_H
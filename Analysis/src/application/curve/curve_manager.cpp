@@ -1,6 +1,13 @@
 #include "curve_manager.h"
+#include "infrastructure/io/project_file_reader.h"
+#include "infrastructure/io/project_file_writer.h"
+#include "infrastructure/io/tcurve_file_reader.h"
+#include "infrastructure/io/tcurve_file_writer.h"
 #include "infrastructure/io/text_file_reader.h"
 #include <QDebug>
+#include <QFileInfo>
+#include <QThread>
+#include <QUuid>
 #include <typeinfo>
 
 CurveManager::CurveManager(QObject* parent)
@@ -8,10 +15,26 @@ CurveManager::CurveManager(QObject* parent)
     , m_activeCurveId("")
 {
     qDebug() << "构造:    CurveManager";
+    qRegisterMetaType<ThermalCurve>("ThermalCurve");
+    qRegisterMetaType<ThermalDataSeries>("ThermalDataSeries");
+    qRegisterMetaType<QVector<ThermalCurve>>("QVector<ThermalCurve>");
     registerDefaultReaders();
 }
 
-CurveManager::~CurveManager() = default;
+CurveManager::~CurveManager()
+{
+    if (!m_importThread) {
+        return;
+    }
+
+    // 取消所有未完成的导入并等待导入线程退出（读取器在下一次检查取消标志时返回）
+    for (const CurveImportTaskPtr& task : qAsConst(m_importTasks)) {
+        task->cancelled.storeRelease(1);
+    }
+    m_importThread->quit();
+    m_importThread->wait();
+    delete m_importWorker;
+}
 
 void CurveManager::addCurve(const ThermalCurve& curve)
 {
@@ -24,12 +47,34 @@ void CurveManager::addCurve(const ThermalCurve& curve)
     qDebug() << "曲线已添加到管理器。ID:" << curve.id();
 }
 
+void CurveManager::addCurves(const QVector<ThermalCurve>& curves)
+{
+    QStringList curveIds;
+    curveIds.reserve(curves.size());
+    for (const ThermalCurve& curve : curves) {
+        if (curve.id().isEmpty() || m_curves.contains(curve.id())) {
+            qWarning() << "尝试添加一个ID为空或重复的曲线:" << curve.id();
+            continue;
+        }
+        m_curves.insert(curve.id(), curve);
+        curveIds.append(curve.id());
+    }
+
+    if (!curveIds.isEmpty()) {
+        emit curvesAdded(curveIds);
+        qDebug() << "CurveManager: 已批量添加" << curveIds.size() << "条曲线";
+    }
+}
+
 void CurveManager::clearCurves()
 {
     if (m_curves.isEmpty()) {
         return;
     }
 
+    for (const QString& curveId : m_followedCurveIds.values()) {
+        stopFollowing(curveId);
+    }
     m_curves.clear();
     m_activeCurveId.clear();
 
@@ -45,6 +90,7 @@ bool CurveManager::removeCurve(const QString& curveId)
         return false;
     }
 
+    stopFollowing(curveId);
     m_curves.remove(curveId);
 
     if (m_activeCurveId == curveId) {
@@ -88,6 +134,7 @@ int CurveManager::removeCurveRecursively(const QString& curveId)
 void CurveManager::registerDefaultReaders()
 {
     m_readers.push_back(std::make_unique<TextFileReader>());
+    m_readers.push_back(std::make_unique<TCurveFileReader>());
     // 未来可以在此处添加更多的读取器
 }
 
@@ -145,31 +192,39 @@ FilePreviewData CurveManager::readFilePreview(const QString& filePath) const
     return FilePreviewData();
 }
 
-QString CurveManager::loadCurveFromFileWithConfig(const QString& filePath, const QVariantMap& config)
+const IFileReader* CurveManager::findReader(const QString& filePath) const
 {
-    const IFileReader* reader = nullptr;
     for (const auto& r : m_readers) {
         if (r->canRead(filePath)) {
-            reader = r.get();
-            break;
+            return r.get();
         }
     }
+    return nullptr;
+}
 
+QString CurveManager::insertLoadedCurve(ThermalCurve curve)
+{
+    const QString curveId = curve.id();
+
+    if (m_curves.contains(curveId)) {
+        qWarning() << "ID为" << curveId << "的曲线已存在，将被覆盖。";
+    }
+
+    m_curves.insert(curveId, std::move(curve));
+    emit curveAdded(curveId);
+    return curveId;
+}
+
+QString CurveManager::loadCurveFromFileWithConfig(const QString& filePath, const QVariantMap& config)
+{
+    const IFileReader* reader = findReader(filePath);
     if (!reader) {
         qWarning() << "CurveManager::loadCurveFromFileWithConfig - 未找到适用于文件的读取器:" << filePath;
         return QString();
     }
 
     try {
-        ThermalCurve newCurve = reader->read(filePath, config);
-        const QString curveId = newCurve.id();
-
-        if (m_curves.contains(curveId)) {
-            qWarning() << "ID为" << curveId << "的曲线已存在，将被覆盖。";
-        }
-
-        m_curves.insert(curveId, std::move(newCurve));
-        emit curveAdded(curveId);
+        const QString curveId = insertLoadedCurve(reader->read(filePath, config));
         qDebug() << "CurveManager::loadCurveFromFileWithConfig - 成功加载曲线:" << curveId;
         return curveId;  // 返回曲线ID
 
@@ -179,6 +234,274 @@ QString CurveManager::loadCurveFromFileWithConfig(const QString& filePath, const
     }
 }
 
+QString CurveManager::loadCurveFromFileAsync(const QString& filePath, const QVariantMap& config)
+{
+    const IFileReader* reader = findReader(filePath);
+    if (!reader) {
+        qWarning() << "CurveManager::loadCurveFromFileAsync - 未找到适用于文件的读取器:" << filePath;
+        return QString();
+    }
+
+    ensureImportThread();
+
+    CurveImportTaskPtr task(new CurveImportTask);
+    task->taskId = QUuid::createUuid().toString();
+    task->filePath = filePath;
+    task->config = config;
+    task->reader = reader;
+    m_importTasks.insert(task->taskId, task);
+
+    CurveImportWorker* worker = m_importWorker;
+    QMetaObject::invokeMethod(worker, [worker, task]() { worker->importFile(task); }, Qt::QueuedConnection);
+
+    qDebug() << "CurveManager::loadCurveFromFileAsync - 已提交导入任务:" << task->taskId << filePath;
+    return task->taskId;
+}
+
+QString CurveManager::loadCurvesFromFilesAsync(const QStringList& filePaths, const QVariantMap& config)
+{
+    CurveImportTaskPtr task(new CurveImportTask);
+    task->taskId = QUuid::createUuid().toString();
+    task->config = config;
+    task->config.remove(FileReaderOptions::FollowFile);
+    for (const QString& filePath : filePaths) {
+        const IFileReader* reader = findReader(filePath);
+        if (!reader) {
+            qWarning() << "CurveManager::loadCurvesFromFilesAsync - 未找到适用于文件的读取器:" << filePath;
+            continue;
+        }
+        task->filePaths.append(filePath);
+        task->readers.append(reader);
+    }
+    if (task->filePaths.isEmpty()) {
+        return QString();
+    }
+    task->filePath = QFileInfo(task->filePaths.first()).absolutePath();
+
+    ensureImportThread();
+    m_importTasks.insert(task->taskId, task);
+
+    CurveImportWorker* worker = m_importWorker;
+    QMetaObject::invokeMethod(worker, [worker, task]() { worker->importFiles(task); }, Qt::QueuedConnection);
+
+    qDebug() << "CurveManager::loadCurvesFromFilesAsync - 已提交批量导入任务:" << task->taskId << "文件数:"
+             << task->filePaths.size();
+    return task->taskId;
+}
+
+bool CurveManager::cancelImport(const QString& taskId)
+{
+    const CurveImportTaskPtr task = m_importTasks.value(taskId);
+    if (!task) {
+        qWarning() << "CurveManager::cancelImport - 导入任务不存在或已结束:" << taskId;
+        return false;
+    }
+
+    task->cancelled.storeRelease(1);
+    qDebug() << "CurveManager::cancelImport - 已请求取消导入:" << taskId;
+    return true;
+}
+
+bool CurveManager::appendCurveData(const QString& curveId, const ThermalDataSeries& samples)
+{
+    auto it = m_curves.find(curveId);
+    if (it == m_curves.end()) {
+        qWarning() << "CurveManager::appendCurveData - 曲线不存在:" << curveId;
+        return false;
+    }
+    if (samples.isEmpty()) {
+        return false;
+    }
+
+    const int firstNewIndex = it->getRawData().size();
+    it->appendRawData(samples);
+    emit curveDataAppended(curveId, firstNewIndex);
+    return true;
+}
+
+void CurveManager::stopFollowing(const QString& curveId)
+{
+    if (!m_followedCurveIds.remove(curveId)) {
+        return;
+    }
+
+    CurveImportWorker* worker = m_importWorker;
+    QMetaObject::invokeMethod(worker, [worker, curveId]() { worker->stopFollowing(curveId); }, Qt::QueuedConnection);
+    emit followStopped(curveId, QString());
+}
+
+bool CurveManager::saveCurveToFile(const QString& curveId, const QString& filePath, QString* errorMessage) const
+{
+    const auto it = m_curves.constFind(curveId);
+    if (it == m_curves.constEnd()) {
+        qWarning() << "CurveManager::saveCurveToFile - 曲线不存在:" << curveId;
+        if (errorMessage) {
+            *errorMessage = QStringLiteral("曲线不存在");
+        }
+        return false;
+    }
+
+    TCurveFileWriter writer;
+    if (!writer.write(it.value(), filePath)) {
+        if (errorMessage) {
+            *errorMessage = writer.errorString();
+        }
+        return false;
+    }
+    return true;
+}
+
+bool CurveManager::saveProject(const QString& filePath, const ProjectViewState& viewState, QString* errorMessage) const
+{
+    ProjectDocument document;
+    document.curves = orderParentFirst(m_curves);
+    document.activeCurveId = m_activeCurveId;
+    document.viewState = viewState;
+
+    ProjectFileWriter writer;
+    if (!writer.write(document, filePath)) {
+        if (errorMessage) {
+            *errorMessage = writer.errorString();
+        }
+        return false;
+    }
+    return true;
+}
+
+bool CurveManager::readProject(const QString& filePath, ProjectDocument* document, QString* errorMessage) const
+{
+    ProjectFileReader reader;
+    if (!reader.read(filePath, document)) {
+        if (errorMessage) {
+            *errorMessage = reader.errorString();
+        }
+        return false;
+    }
+    return true;
+}
+
+void CurveManager::restoreProject(const ProjectDocument& document)
+{
+    clearCurves();
+
+    addCurves(document.curves);
+
+    if (m_curves.contains(document.activeCurveId)) {
+        setActiveCurve(document.activeCurveId);
+    } else if (!document.curves.isEmpty()) {
+        setActiveCurve(document.curves.last().id());
+    }
+
+    qDebug() << "CurveManager::restoreProject - 已恢复" << m_curves.size() << "条曲线";
+}
+
+void CurveManager::ensureImportThread()
+{
+    if (m_importThread) {
+        return;
+    }
+
+    m_importThread = new QThread(this);
+    m_importThread->setObjectName(QStringLiteral("CurveImportThread"));
+    m_importWorker = new CurveImportWorker();
+    m_importWorker->moveToThread(m_importThread);
+
+    // 工作对象的信号跨线程排队传回主线程
+    connect(m_importWorker, &CurveImportWorker::importStarted, this, &CurveManager::importStarted);
+    connect(m_importWorker, &CurveImportWorker::importProgress, this, &CurveManager::importProgress);
+    connect(m_importWorker, &CurveImportWorker::importFinished, this, &CurveManager::onImportWorkerFinished);
+    connect(m_importWorker, &CurveImportWorker::importBatchFinished, this, &CurveManager::onImportWorkerBatchFinished);
+    connect(m_importWorker, &CurveImportWorker::importFailed, this, &CurveManager::onImportWorkerFailed);
+    connect(m_importWorker, &CurveImportWorker::importCancelled, this, &CurveManager::onImportWorkerCancelled);
+    connect(m_importWorker, &CurveImportWorker::followDataAppended, this, &CurveManager::onFollowDataAppended);
+    connect(m_importWorker, &CurveImportWorker::followStopped, this, &CurveManager::onFollowWorkerStopped);
+
+    // 跟随定时器属于导入线程，须在导入线程退出前于该线程中停止
+    CurveImportWorker* worker = m_importWorker;
+    connect(m_importThread, &QThread::finished, worker, [worker]() { worker->stopAllFollowing(); }, Qt::DirectConnection);
+
+    m_importThread->start();
+}
+
+void CurveManager::onImportWorkerFinished(const QString& taskId, const ThermalCurve& curve)
+{
+    const CurveImportTaskPtr task = m_importTasks.take(taskId);
+
+    // 读取完成后、结果送达前被取消的任务不再加入管理器
+    if (!task || task->cancelled.loadAcquire()) {
+        emit importCancelled(taskId);
+        return;
+    }
+
+    const QString curveId = insertLoadedCurve(curve);
+    qDebug() << "CurveManager: 异步导入完成，曲线:" << curveId;
+    emit importFinished(taskId, curveId);
+
+    // 跟随模式：从初次导入解析到的位置继续读取新追加的数据
+    if (task->config.value(FileReaderOptions::FollowFile).toBool() && m_curves.contains(curveId)) {
+        const qint64 offset = curve.getMetadata().additional.value(FileReaderOptions::ParsedBytes).toLongLong();
+        m_followedCurveIds.insert(curveId);
+        CurveImportWorker* worker = m_importWorker;
+        const IFileReader* reader = task->reader;
+        const QString filePath = task->filePath;
+        const QVariantMap config = task->config;
+        QMetaObject::invokeMethod(
+            worker, [=]() { worker->followFile(curveId, reader, filePath, config, offset); }, Qt::QueuedConnection);
+    }
+}
+
+void CurveManager::onImportWorkerBatchFinished(const QString& taskId, const QVector<ThermalCurve>& curves,
+                                               const QStringList& errors)
+{
+    const CurveImportTaskPtr task = m_importTasks.take(taskId);
+    if (!task || task->cancelled.loadAcquire()) {
+        emit importCancelled(taskId);
+        return;
+    }
+
+    addCurves(curves);
+
+    QStringList curveIds;
+    curveIds.reserve(curves.size());
+    for (const ThermalCurve& curve : curves) {
+        if (m_curves.contains(curve.id())) {
+            curveIds.append(curve.id());
+        }
+    }
+    qDebug() << "CurveManager: 批量导入完成，曲线数:" << curveIds.size() << "失败文件数:" << errors.size();
+    emit importBatchFinished(taskId, curveIds, errors);
+}
+
+void CurveManager::onImportWorkerFailed(const QString& taskId, const QString& errorMessage)
+{
+    m_importTasks.remove(taskId);
+    qWarning() << "CurveManager: 异步导入失败:" << errorMessage;
+    emit importFailed(taskId, errorMessage);
+}
+
+void CurveManager::onImportWorkerCancelled(const QString& taskId)
+{
+    m_importTasks.remove(taskId);
+    emit importCancelled(taskId);
+}
+
+void CurveManager::onFollowDataAppended(const QString& curveId, const ThermalDataSeries& samples)
+{
+    // 停止跟随后仍可能收到已排队的增量
+    if (!m_followedCurveIds.contains(curveId)) {
+        return;
+    }
+    appendCurveData(curveId, samples);
+}
+
+void CurveManager::onFollowWorkerStopped(const QString& curveId, const QString& reason)
+{
+    if (m_followedCurveIds.remove(curveId)) {
+        qWarning() << "CurveManager: 曲线停止跟随源文件" << curveId << reason;
+        emit followStopped(curveId, reason);
+    }
+}
+
 ThermalCurve* CurveManager::getCurve(const QString& curveId)
 {
     auto it = m_curves.find(curveId);
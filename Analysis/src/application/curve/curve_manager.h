@@ -1,16 +1,21 @@
 #ifndef CURVEMANAGER_H
 #define CURVEMANAGER_H
 
+#include "application/curve/curve_import_worker.h"
+#include "domain/model/project_document.h"
 #include "domain/model/thermal_curve.h"
 #include "infrastructure/io/i_file_reader.h"
+#include <QHash>
 #include <QMap>
 #include <QObject>
+#include <QSet>
 #include <QString>
 #include <memory>
 #include <vector>
 
 // 前置声明
 struct FilePreviewData;
+class QThread;
 
 /**
  * @brief CurveManager 管理应用中的所有热分析曲线
@@ -18,7 +23,8 @@ struct FilePreviewData;
  * 职责：
  * - 曲线的增删改查
  * - 活动曲线管理
- * - 从文件加载曲线
+ * - 从文件加载曲线（同步，或在导入线程中异步读取）
+ * - 跟随正在增长的数据文件，把新追加的采样追加到曲线末尾
  * - 发射曲线状态变化信号
  */
 class CurveManager : public QObject {
@@ -38,6 +44,15 @@ public:
      */
     void addCurve(const ThermalCurve& curve);
 
+    /**
+     * @brief 一次添加多条曲线
+     * @param curves 要添加的曲线（父曲线须在子曲线之前）
+     *
+     * 全部加入后只发射一次 curvesAdded，视图一次性更新，而不是每条曲线重建一次。
+     * ID为空或重复的曲线被跳过。
+     */
+    void addCurves(const QVector<ThermalCurve>& curves);
+
     /**
      * @brief 从文件加载曲线
      * @param filePath 文件路径
@@ -68,6 +83,112 @@ public:
      */
     QString loadCurveFromFileWithConfig(const QString& filePath, const QVariantMap& config);
 
+    /**
+     * @brief 在导入线程中异步加载曲线（支持用户配置）
+     * @param filePath 文件路径
+     * @param config 用户导入配置（列映射、单位等）
+     * @return 导入任务ID，未找到读取器时返回空字符串
+     *
+     * 文件在独立的导入线程中读取，期间发射 importStarted/importProgress；
+     * 读取完成后曲线经排队信号回到主线程加入管理器（发射 curveAdded），
+     * 最后发射 importFinished。失败或取消时分别发射 importFailed/importCancelled。
+     * 多个导入按提交顺序依次执行。
+     *
+     * config 中 FileReaderOptions::FollowFile 为 true 且读取器支持时，导入完成后继续跟随文件：
+     * 新追加的采样经 appendCurveData() 追加到曲线（发射 curveDataAppended），
+     * 直到 stopFollowing()、曲线被删除或文件被截断（发射 followStopped）。
+     */
+    QString loadCurveFromFileAsync(const QString& filePath, const QVariantMap& config);
+
+    /**
+     * @brief 在导入线程中并发加载多个文件（同一套用户配置）
+     * @param filePaths 文件路径（曲线按此顺序加入）
+     * @param config 用户导入配置（列映射、单位等），对所有文件生效
+     * @return 导入任务ID，没有任何文件找到读取器时返回空字符串
+     *
+     * 各文件在线程池中并发读取，进度通过 importProgress 汇总报告。全部读完后所有曲线
+     * 一次性加入管理器（发射一次 curvesAdded），再发射 importBatchFinished；
+     * 全部文件失败时发射 importFailed。找不到读取器的文件记为失败。不支持跟随模式。
+     */
+    QString loadCurvesFromFilesAsync(const QStringList& filePaths, const QVariantMap& config);
+
+    /**
+     * @brief 取消导入任务
+     * @param taskId 导入任务ID
+     * @return 任务存在（排队中或正在读取）返回 true
+     *
+     * 读取器在下一次检查取消标志时停止，随后发射 importCancelled。
+     */
+    bool cancelImport(const QString& taskId);
+
+    /**
+     * @brief 是否有尚未结束的导入任务
+     */
+    bool hasPendingImports() const { return !m_importTasks.isEmpty(); }
+
+    /**
+     * @brief 在曲线末尾追加采样
+     * @param curveId 曲线ID
+     * @param samples 新采样（列含义与单位须与曲线已有数据一致）
+     * @return 曲线存在且 samples 非空时返回 true
+     *
+     * 跟随文件与实时数据源共用此入口。只追加原始数据，处理后数据与原始数据共享时随之增长。
+     * 追加后发射 curveDataAppended，视图只需绘制新增的点。
+     */
+    bool appendCurveData(const QString& curveId, const ThermalDataSeries& samples);
+
+    /**
+     * @brief 曲线是否正在跟随其源文件
+     */
+    bool isFollowing(const QString& curveId) const { return m_followedCurveIds.contains(curveId); }
+
+    /**
+     * @brief 停止跟随曲线的源文件，已追加的数据保留
+     *
+     * 曲线正在跟随时发射 followStopped（原因为空）。
+     */
+    void stopFollowing(const QString& curveId);
+
+    /**
+     * @brief 将曲线保存为二进制 .tcurve 文件
+     * @param curveId 曲线ID
+     * @param filePath 目标文件路径
+     * @param errorMessage 失败原因（可选）
+     * @return 保存成功返回 true
+     *
+     * .tcurve 由已注册的 TCurveFileReader 读取，重新打开时直接映射列数据，无需重新解析文本。
+     */
+    bool saveCurveToFile(const QString& curveId, const QString& filePath, QString* errorMessage = nullptr) const;
+
+    /**
+     * @brief 将所有曲线（含父子关系与派生曲线）连同视图状态保存为 .tproj 项目文件
+     * @param filePath 目标文件路径
+     * @param viewState 由视图层收集的勾选状态、标注点与浮动标签
+     * @param errorMessage 失败原因（可选）
+     * @return 保存成功返回 true
+     */
+    bool saveProject(const QString& filePath, const ProjectViewState& viewState, QString* errorMessage = nullptr) const;
+
+    /**
+     * @brief 读取 .tproj 项目文件（不修改当前曲线）
+     * @param filePath 项目文件路径
+     * @param document 输出：项目内容
+     * @param errorMessage 失败原因（可选）
+     * @return 读取成功返回 true
+     *
+     * 只解析索引块，各曲线的采样数据保持映射在文件中，首次绘制或分析时才读入。
+     */
+    bool readProject(const QString& filePath, ProjectDocument* document, QString* errorMessage = nullptr) const;
+
+    /**
+     * @brief 用项目内容替换当前所有曲线
+     * @param document 由 readProject() 读取的项目
+     *
+     * 先清空现有曲线（发射 curvesCleared），再按父曲线在前的顺序一次性添加（发射一次 curvesAdded），
+     * 最后恢复活动曲线。视图状态由调用方在此之前交给视图层。
+     */
+    void restoreProject(const ProjectDocument& document);
+
     /**
      * @brief 根据ID获取曲线
      * @param curveId 曲线ID
@@ -166,6 +287,12 @@ signals:
      */
     void curveAdded(const QString& curveId);
 
+    /**
+     * @brief 当一批曲线被一次性添加时发射（批量导入、恢复项目），不再逐条发射 curveAdded
+     * @param curveIds 新添加的曲线ID（父曲线在前）
+     */
+    void curvesAdded(const QStringList& curveIds);
+
     /**
      * @brief 当活动曲线改变时发射
      * @param curveId 新的活动曲线ID
@@ -178,6 +305,13 @@ signals:
      */
     void curveDataChanged(const QString& curveId);
 
+    /**
+     * @brief 当采样被追加到曲线末尾时发射
+     * @param curveId 曲线ID
+     * @param firstNewIndex 第一个新采样的索引（追加前的点数）
+     */
+    void curveDataAppended(const QString& curveId, int firstNewIndex);
+
     /**
      * @brief 当所有曲线被清空时发射
      */
@@ -189,17 +323,88 @@ signals:
      */
     void curveRemoved(const QString& curveId);
 
+    // ==================== 异步导入信号 ====================
+
+    /**
+     * @brief 导入任务开始读取文件时发射
+     */
+    void importStarted(const QString& taskId, const QString& filePath);
+
+    /**
+     * @brief 导入进度更新
+     * @param percentage 进度百分比 (0-100)
+     */
+    void importProgress(const QString& taskId, int percentage, const QString& message);
+
+    /**
+     * @brief 导入完成，曲线已加入管理器
+     * @param curveId 新曲线ID
+     */
+    void importFinished(const QString& taskId, const QString& curveId);
+
+    /**
+     * @brief 批量导入完成，成功的曲线已加入管理器
+     * @param curveIds 新曲线ID（按文件顺序）
+     * @param errors 失败文件的说明（"文件名：原因"），全部成功时为空
+     */
+    void importBatchFinished(const QString& taskId, const QStringList& curveIds, const QStringList& errors);
+
+    /**
+     * @brief 导入失败
+     */
+    void importFailed(const QString& taskId, const QString& errorMessage);
+
+    /**
+     * @brief 导入被取消
+     */
+    void importCancelled(const QString& taskId);
+
+    /**
+     * @brief 曲线停止跟随源文件
+     * @param reason 停止原因；由 stopFollowing() 或删除曲线主动停止时为空
+     */
+    void followStopped(const QString& curveId, const QString& reason);
+
+private slots:
+    void onImportWorkerFinished(const QString& taskId, const ThermalCurve& curve);
+    void onImportWorkerBatchFinished(const QString& taskId, const QVector<ThermalCurve>& curves, const QStringList& errors);
+    void onImportWorkerFailed(const QString& taskId, const QString& errorMessage);
+    void onImportWorkerCancelled(const QString& taskId);
+    void onFollowDataAppended(const QString& curveId, const ThermalDataSeries& samples);
+    void onFollowWorkerStopped(const QString& curveId, const QString& reason);
+
 private:
     /**
      * @brief 注册默认的文件读取器
      *
-     * 当前注册 TextFileReader 用于读取 .txt 和 .csv 文件
+     * 当前注册 TextFileReader 用于读取 .txt 和 .csv 文件，TCurveFileReader 用于读取 .tcurve 文件
      */
     void registerDefaultReaders();
 
+    /**
+     * @brief 查找能读取指定文件的读取器
+     */
+    const IFileReader* findReader(const QString& filePath) const;
+
+    /**
+     * @brief 将读取到的曲线加入管理器并发射 curveAdded
+     * @return 曲线ID
+     */
+    QString insertLoadedCurve(ThermalCurve curve);
+
+    /**
+     * @brief 按需创建导入线程与工作对象
+     */
+    void ensureImportThread();
+
     QMap<QString, ThermalCurve> m_curves;
     std::vector<std::unique_ptr<IFileReader>> m_readers;
     QString m_activeCurveId;
+
+    QThread* m_importThread = nullptr;                ///< 导入线程（按需创建）
+    CurveImportWorker* m_importWorker = nullptr;      ///< 导入工作对象（位于导入线程）
+    QHash<QString, CurveImportTaskPtr> m_importTasks; ///< 尚未结束的导入任务
+    QSet<QString> m_followedCurveIds;                 ///< 正在跟随源文件的曲线
 };
 
 #endif // CURVEMANAGER_H
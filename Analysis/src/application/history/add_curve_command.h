@@ -26,7 +26,7 @@ public:
 
 private:
     CurveManager* m_curveManager = nullptr;
-    ThermalCurve m_curveData;
+    ThermalCurve m_curveData; // 曲线快照（采样数据为共享句柄，不额外占用内存）
     QString m_previousActiveId;
     QString m_description;
     bool m_hasExecuted = false;
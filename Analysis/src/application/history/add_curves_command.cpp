@@ -0,0 +1,85 @@
+#include "add_curves_command.h"
+
+#include "application/curve/curve_manager.h"
+#include <QDebug>
+
+AddCurvesCommand::AddCurvesCommand(CurveManager* manager, const QVector<ThermalCurve>& curves, QString description)
+    : m_curveManager(manager)
+    , m_curves(curves)
+    , m_description(std::move(description))
+{
+    if (m_description.isEmpty()) {
+        m_description = QObject::tr("添加 %1 条曲线").arg(m_curves.size());
+    }
+}
+
+bool AddCurvesCommand::execute()
+{
+    if (!m_curveManager) {
+        qWarning() << "AddCurvesCommand::execute - CurveManager 为空";
+        return false;
+    }
+
+    if (m_curves.isEmpty()) {
+        qWarning() << "AddCurvesCommand::execute - 没有要添加的曲线";
+        return false;
+    }
+
+    for (const ThermalCurve& curve : m_curves) {
+        if (curve.id().isEmpty()) {
+            qWarning() << "AddCurvesCommand::execute - 曲线 ID 为空";
+            return false;
+        }
+    }
+
+    if (m_previousActiveId.isEmpty()) {
+        if (ThermalCurve* active = m_curveManager->getActiveCurve()) {
+            m_previousActiveId = active->id();
+        }
+    }
+
+    m_curveManager->addCurves(m_curves);
+    m_curveManager->setActiveCurve(m_curves.last().id());
+    m_hasExecuted = true;
+
+    qDebug() << "AddCurvesCommand: 已添加" << m_curves.size() << "条曲线";
+    return true;
+}
+
+bool AddCurvesCommand::undo()
+{
+    if (!m_curveManager) {
+        qWarning() << "AddCurvesCommand::undo - CurveManager 为空";
+        return false;
+    }
+
+    if (!m_hasExecuted) {
+        qWarning() << "AddCurvesCommand::undo - 命令尚未执行";
+        return false;
+    }
+
+    // 逆序删除，与添加顺序对称；个别曲线已不存在时继续删除其余曲线
+    bool allRemoved = true;
+    for (int i = m_curves.size() - 1; i >= 0; --i) {
+        if (!m_curveManager->removeCurve(m_curves[i].id())) {
+            qWarning() << "AddCurvesCommand::undo - 删除曲线失败，ID:" << m_curves[i].id();
+            allRemoved = false;
+        }
+    }
+
+    if (!m_previousActiveId.isEmpty()) {
+        m_curveManager->setActiveCurve(m_previousActiveId);
+    }
+
+    m_hasExecuted = false;
+    qDebug() << "AddCurvesCommand: 已撤销" << m_curves.size() << "条曲线";
+    return allRemoved;
+}
+
+bool AddCurvesCommand::redo()
+{
+    // redo 与首次执行行为一致，但不重置 m_previousActiveId
+    return execute();
+}
+
+QString AddCurvesCommand::description() const { return m_description; }
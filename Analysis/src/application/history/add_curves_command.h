@@ -0,0 +1,39 @@
+#ifndef ADDCURVESCOMMAND_H
+#define ADDCURVESCOMMAND_H
+
+#include "domain/algorithm/i_command.h"
+#include "domain/model/thermal_curve.h"
+#include <QString>
+#include <QVector>
+
+class CurveManager;
+
+/**
+ * @brief AddCurvesCommand 将一组曲线的添加操作封装为单条可撤销命令。
+ *
+ * 用于批量算法：对多条勾选曲线执行同一算法后，所有输出曲线作为一个历史条目提交，
+ * 一次撤销即可全部移除。
+ *
+ * execute()   : 按顺序添加所有曲线，并激活最后一条。
+ * undo()      : 逆序删除所有曲线，并将活动曲线恢复为执行前的值。
+ * redo()      : 重新添加所有曲线并激活最后一条。
+ */
+class AddCurvesCommand : public ICommand {
+public:
+    AddCurvesCommand(CurveManager* manager, const QVector<ThermalCurve>& curves, QString description = QString());
+
+    bool execute() override;
+    bool undo() override;
+    bool redo() override;
+
+    QString description() const override;
+
+private:
+    CurveManager* m_curveManager = nullptr;
+    QVector<ThermalCurve> m_curves; // 曲线快照（采样数据为共享句柄，不额外占用内存）
+    QString m_previousActiveId;
+    QString m_description;
+    bool m_hasExecuted = false;
+};
+
+#endif // ADDCURVESCOMMAND_H
@@ -0,0 +1,325 @@
+#include "autosave_manager.h"
+#include "application/curve/curve_manager.h"
+#include "application/history/autosave_worker.h"
+#include "application/history/history_manager.h"
+#include "domain/model/project_document.h"
+#include <QDebug>
+#include <QDir>
+#include <QFileInfo>
+#include <QStandardPaths>
+#include <QThread>
+
+namespace {
+
+/**
+ * @brief 复制原始数据从 firstIndex 起的尾部（含逐点元数据），不与曲线共享缓冲区
+ */
+ThermalDataSeries copyTail(const ThermalDataSeries& raw, int firstIndex)
+{
+    const int count = raw.size() - firstIndex;
+    const ColumnView<double> temperatures = raw.temperatures().mid(firstIndex, count);
+    const ColumnView<double> times = raw.times().mid(firstIndex, count);
+    const ColumnView<double> values = raw.values().mid(firstIndex, count);
+    ThermalDataSeries tail = ThermalDataSeries::fromColumns(QVector<double>(temperatures.begin(), temperatures.end()),
+                                                            QVector<double>(times.begin(), times.end()),
+                                                            QVector<double>(values.begin(), values.end()));
+    if (raw.hasMetadata()) {
+        for (int i = 0; i < count; ++i) {
+            const QVariantMap metadata = raw.metadataAt(firstIndex + i);
+            if (!metadata.isEmpty()) {
+                tail.setMetadataAt(i, metadata);
+            }
+        }
+    }
+    return tail;
+}
+
+} // namespace
+
+AutosaveManager::AutosaveManager(CurveManager* curveManager, HistoryManager* historyManager, QObject* parent)
+    : QObject(parent)
+    , m_curveManager(curveManager)
+    , m_historyManager(historyManager)
+    , m_lockFile(journalPath() + QStringLiteral(".lock"))
+{
+    Q_ASSERT(m_curveManager);
+    Q_ASSERT(m_historyManager);
+
+    m_flushTimer.setSingleShot(true);
+    m_flushTimer.setInterval(1000);
+    connect(&m_flushTimer, &QTimer::timeout, this, &AutosaveManager::flush);
+
+    connect(m_curveManager, &CurveManager::curveAdded, this, &AutosaveManager::onCurveAdded);
+    connect(m_curveManager, &CurveManager::curvesAdded, this, &AutosaveManager::onCurvesAdded);
+    connect(m_curveManager, &CurveManager::curveRemoved, this, &AutosaveManager::onCurveRemoved);
+    connect(m_curveManager, &CurveManager::curvesCleared, this, &AutosaveManager::onCurvesCleared);
+    connect(m_curveManager, &CurveManager::curveDataChanged, this, &AutosaveManager::onCurveDataChanged);
+    connect(m_curveManager, &CurveManager::curveDataAppended, this, &AutosaveManager::onCurveDataAppended);
+    connect(m_curveManager, &CurveManager::activeCurveChanged, this, &AutosaveManager::scheduleFlush);
+    connect(m_historyManager, &HistoryManager::historyChanged, this, &AutosaveManager::onHistoryChanged);
+
+    qDebug() << "构造:  AutosaveManager";
+}
+
+AutosaveManager::~AutosaveManager()
+{
+    if (!m_thread) {
+        return;
+    }
+
+    // 正常退出：未提交的变化不再写入，删除日志
+    m_flushTimer.stop();
+    postToWorker([](AutosaveWorker* worker) { worker->finishJournal(true); });
+    waitForPendingWrites();
+
+    m_thread->quit();
+    m_thread->wait();
+    delete m_worker;
+}
+
+QString AutosaveManager::journalPath() const
+{
+    const QString directory = QStandardPaths::writableLocation(QStandardPaths::AppLocalDataLocation);
+    return QDir(directory).filePath(QStringLiteral("autosave.tjournal"));
+}
+
+bool AutosaveManager::acquireJournalLock()
+{
+    if (m_lockFile.isLocked()) {
+        return true;
+    }
+    QDir().mkpath(QFileInfo(journalPath()).absolutePath());
+    m_lockFile.setStaleLockTime(0); // 锁由进程号判断是否失效，不按时间
+    if (!m_lockFile.tryLock(0)) {
+        qWarning() << "AutosaveManager: 自动保存日志正被其他实例使用，本实例不自动保存:" << journalPath();
+        return false;
+    }
+    return true;
+}
+
+bool AutosaveManager::hasRecoverableJournal()
+{
+    return acquireJournalLock() && QFileInfo(journalPath()).size() > 0;
+}
+
+bool AutosaveManager::recover(ProjectDocument* document, int* batchCount, QString* errorMessage)
+{
+    if (!acquireJournalLock()) {
+        if (errorMessage) {
+            *errorMessage = QStringLiteral("自动保存日志正被其他实例使用");
+        }
+        return false;
+    }
+    return AutosaveJournal::recover(journalPath(), document, batchCount, errorMessage);
+}
+
+void AutosaveManager::start()
+{
+    if (m_started || !acquireJournalLock()) {
+        return;
+    }
+
+    m_thread = new QThread(this);
+    m_thread->setObjectName(QStringLiteral("AutosaveThread"));
+    m_worker = new AutosaveWorker();
+    m_worker->moveToThread(m_thread);
+    connect(m_worker, &AutosaveWorker::compactionRequested, this, &AutosaveManager::onCompactionRequested);
+    m_thread->start(QThread::LowPriority);
+    m_started = true;
+
+    const QString filePath = journalPath();
+    postToWorker([filePath](AutosaveWorker* worker) { worker->startJournal(filePath); });
+
+    // 第一个批次：当前全部曲线
+    m_cleared = true;
+    m_addedCurveIds.clear();
+    m_appendedCurveIds.clear();
+    m_removedCurveIds.clear();
+    m_journaledSizes.clear();
+    for (auto it = m_curveManager->getAllCurves().constBegin(); it != m_curveManager->getAllCurves().constEnd(); ++it) {
+        m_addedCurveIds.insert(it.key());
+    }
+    m_lastUndoCount = m_historyManager->undoCount();
+    m_lastRedoCount = m_historyManager->redoCount();
+    flush();
+
+    qDebug() << "AutosaveManager: 已开始自动保存到" << filePath;
+}
+
+void AutosaveManager::waitForPendingWrites()
+{
+    QMutexLocker locker(&m_pendingMutex);
+    while (m_pendingWrites > 0) {
+        m_pendingDone.wait(&m_pendingMutex);
+    }
+}
+
+void AutosaveManager::onCurveAdded(const QString& curveId)
+{
+    m_removedCurveIds.remove(curveId);
+    m_addedCurveIds.insert(curveId);
+    scheduleFlush();
+}
+
+void AutosaveManager::onCurvesAdded(const QStringList& curveIds)
+{
+    for (const QString& curveId : curveIds) {
+        m_removedCurveIds.remove(curveId);
+        m_addedCurveIds.insert(curveId);
+    }
+    scheduleFlush();
+}
+
+void AutosaveManager::onCurveRemoved(const QString& curveId)
+{
+    m_addedCurveIds.remove(curveId);
+    m_appendedCurveIds.remove(curveId);
+    m_removedCurveIds.insert(curveId);
+    scheduleFlush();
+}
+
+void AutosaveManager::onCurveDataChanged(const QString& curveId)
+{
+    // 与新增相同：按ID整条覆盖日志中的曲线
+    m_addedCurveIds.insert(curveId);
+    m_appendedCurveIds.remove(curveId);
+    scheduleFlush();
+}
+
+void AutosaveManager::onCurveDataAppended(const QString& curveId, int firstNewIndex)
+{
+    Q_UNUSED(firstNewIndex); // 起始下标以上次写入日志时的点数为准，可合并多次追加
+    if (!m_addedCurveIds.contains(curveId)) {
+        m_appendedCurveIds.insert(curveId);
+    }
+    scheduleFlush();
+}
+
+void AutosaveManager::onCurvesCleared()
+{
+    m_cleared = true;
+    m_addedCurveIds.clear();
+    m_appendedCurveIds.clear();
+    m_removedCurveIds.clear();
+    scheduleFlush();
+}
+
+void AutosaveManager::onHistoryChanged()
+{
+    const int undoCount = m_historyManager->undoCount();
+    const int redoCount = m_historyManager->redoCount();
+    if (undoCount < m_lastUndoCount && redoCount > m_lastRedoCount) {
+        m_commandDescriptions.append(QStringLiteral("撤销 %1").arg(m_historyManager->redoDescription()));
+    } else if (undoCount > 0 && (undoCount != m_lastUndoCount || redoCount != m_lastRedoCount)) {
+        m_commandDescriptions.append(m_historyManager->undoDescription());
+    }
+    m_lastUndoCount = undoCount;
+    m_lastRedoCount = redoCount;
+}
+
+void AutosaveManager::onCompactionRequested()
+{
+    if (!m_started) {
+        return;
+    }
+
+    // 快照须与日志中最后一个批次之后的状态一致，先提交累积的变化（有变化时计时器必在运行）
+    if (m_flushTimer.isActive()) {
+        m_flushTimer.stop();
+        flush();
+    }
+
+    const QVector<ThermalCurve> curves = orderParentFirst(m_curveManager->getAllCurves());
+    m_journaledSizes.clear();
+    for (const ThermalCurve& curve : curves) {
+        m_journaledSizes.insert(curve.id(), curve.getRawData().size());
+    }
+    const ThermalCurve* active = m_curveManager->getActiveCurve();
+    const QString activeCurveId = active ? active->id() : QString();
+    postToWorker([curves, activeCurveId](AutosaveWorker* worker) { worker->compact(curves, activeCurveId); });
+}
+
+void AutosaveManager::scheduleFlush()
+{
+    // 不重启计时器：持续变化时也至少每个间隔提交一次
+    if (m_started && !m_flushTimer.isActive()) {
+        m_flushTimer.start();
+    }
+}
+
+void AutosaveManager::flush()
+{
+    if (!m_started) {
+        return;
+    }
+
+    AutosaveBatch batch;
+    batch.commandDescriptions = m_commandDescriptions;
+    batch.cleared = m_cleared;
+    batch.removedCurveIds = m_removedCurveIds.values();
+    if (m_cleared) {
+        m_journaledSizes.clear();
+    }
+    for (const QString& curveId : qAsConst(m_removedCurveIds)) {
+        m_journaledSizes.remove(curveId);
+    }
+
+    // 日志中没有的曲线、或点数比日志中少（数据被替换）的曲线只能整条写入
+    for (const QString& curveId : qAsConst(m_appendedCurveIds)) {
+        const ThermalCurve* curve = m_curveManager->getCurve(curveId);
+        const auto journaled = m_journaledSizes.constFind(curveId);
+        if (!curve || journaled == m_journaledSizes.constEnd() || curve->getRawData().size() < journaled.value()) {
+            m_addedCurveIds.insert(curveId);
+            continue;
+        }
+        const int firstIndex = journaled.value();
+        const int count = curve->getRawData().size() - firstIndex;
+        if (count == 0) {
+            continue;
+        }
+        batch.appends.append({ curveId, firstIndex, copyTail(curve->getRawData(), firstIndex) });
+        m_journaledSizes.insert(curveId, firstIndex + count);
+    }
+
+    batch.curves.reserve(m_addedCurveIds.size());
+    for (const QString& curveId : qAsConst(m_addedCurveIds)) {
+        if (const ThermalCurve* curve = m_curveManager->getCurve(curveId)) {
+            batch.curves.append(*curve); // 共享采样缓冲区，不复制数据
+            m_journaledSizes.insert(curveId, curve->getRawData().size());
+        }
+    }
+    if (const ThermalCurve* active = m_curveManager->getActiveCurve()) {
+        batch.activeCurveId = active->id();
+    }
+
+    m_commandDescriptions.clear();
+    m_cleared = false;
+    m_addedCurveIds.clear();
+    m_appendedCurveIds.clear();
+    m_removedCurveIds.clear();
+
+    postToWorker([batch](AutosaveWorker* worker) { worker->writeBatch(batch); });
+}
+
+void AutosaveManager::postToWorker(std::function<void(AutosaveWorker*)> task)
+{
+    {
+        QMutexLocker locker(&m_pendingMutex);
+        ++m_pendingWrites;
+    }
+    AutosaveWorker* worker = m_worker;
+    QMetaObject::invokeMethod(
+        worker,
+        [this, worker, task]() {
+            task(worker);
+            finishPendingWrite();
+        },
+        Qt::QueuedConnection);
+}
+
+void AutosaveManager::finishPendingWrite()
+{
+    QMutexLocker locker(&m_pendingMutex);
+    --m_pendingWrites;
+    m_pendingDone.wakeAll();
+}
@@ -0,0 +1,134 @@
+#ifndef AUTOSAVE_MANAGER_H
+#define AUTOSAVE_MANAGER_H
+
+#include <QHash>
+#include <QLockFile>
+#include <QMutex>
+#include <QObject>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+#include <QTimer>
+#include <QWaitCondition>
+#include <functional>
+
+class AutosaveWorker;
+class CurveManager;
+class HistoryManager;
+class QThread;
+struct ProjectDocument;
+
+/**
+ * @brief AutosaveManager 在后台把曲线变化增量追加到自动保存日志，用于崩溃后恢复
+ *
+ * 监听 CurveManager 的增删/清空/数据变化/活动曲线信号记录变化的曲线，并从 HistoryManager
+ * 记录期间执行、撤销、重做的命令描述。变化合并一段时间（默认 1 秒）后组成一个批次，
+ * 只携带变化曲线的共享副本（不复制采样数据）排队交给自动保存线程写入日志，
+ * 主线程不做任何文件 I/O。自动保存线程写完即释放这些副本；日志过大时由它请求压缩，
+ * 主线程再提交一份当前全部曲线的快照（见 AutosaveWorker）。
+ *
+ * 新增或被修改的曲线以整条为增量单位；跟随文件、实时采集的曲线只在末尾追加采样，
+ * 每个批次只写入自上次写入以来追加的部分（主线程复制的尾部），日志增长与数据增长相当。
+ * 标注点与浮动标签属于视图状态，不写入日志。
+ *
+ * 正常退出时删除日志；日志仍然存在说明上次异常退出，可通过 recover() 恢复。
+ * 日志由锁文件保护，同时运行的第二个实例不使用自动保存。
+ */
+class AutosaveManager : public QObject {
+    Q_OBJECT
+
+public:
+    AutosaveManager(CurveManager* curveManager, HistoryManager* historyManager, QObject* parent = nullptr);
+    ~AutosaveManager() override;
+
+    /**
+     * @brief 自动保存日志路径（应用本地数据目录下的 autosave.tjournal）
+     */
+    QString journalPath() const;
+
+    /**
+     * @brief 是否存在上次异常退出留下的日志
+     */
+    bool hasRecoverableJournal();
+
+    /**
+     * @brief 从日志恢复曲线（不修改当前曲线）
+     * @param document 输出：曲线（父曲线在前）与活动曲线
+     * @param batchCount 输出：重放的批次数（可选）
+     * @param errorMessage 失败原因（可选）
+     */
+    bool recover(ProjectDocument* document, int* batchCount = nullptr, QString* errorMessage = nullptr);
+
+    /**
+     * @brief 开始自动保存：新建日志，并把当前全部曲线作为第一个批次写入
+     *
+     * 会覆盖已有日志，须在决定是否恢复之后调用。
+     */
+    void start();
+
+    /**
+     * @brief 设置变化合并的时间间隔（毫秒）
+     */
+    void setInterval(int msec) { m_flushTimer.setInterval(msec); }
+
+    /**
+     * @brief 阻塞直到已提交的批次全部写完
+     *
+     * 自动保存线程会读取曲线的采样数据；覆盖写入可能被映射的 .tproj/.tcurve 前须先调用
+     * （见 ColumnBlockIO::releaseMappings()）。
+     */
+    void waitForPendingWrites();
+
+private slots:
+    void onCurveAdded(const QString& curveId);
+    void onCurvesAdded(const QStringList& curveIds);
+    void onCurveRemoved(const QString& curveId);
+    void onCurveDataChanged(const QString& curveId);
+    void onCurveDataAppended(const QString& curveId, int firstNewIndex);
+    void onCurvesCleared();
+    void onHistoryChanged();
+
+    /**
+     * @brief 提交未写入的变化，再把当前全部曲线的快照交给自动保存线程压缩日志
+     */
+    void onCompactionRequested();
+
+    /**
+     * @brief 把累积的变化组成批次交给自动保存线程
+     */
+    void flush();
+
+private:
+    bool acquireJournalLock();
+    void scheduleFlush();
+    void postToWorker(std::function<void(AutosaveWorker*)> task);
+    void finishPendingWrite();
+
+    CurveManager* m_curveManager;     // 非拥有指针
+    HistoryManager* m_historyManager; // 非拥有指针
+
+    QThread* m_thread = nullptr;
+    AutosaveWorker* m_worker = nullptr; // 拥有指针（在自动保存线程中运行）
+    QLockFile m_lockFile;
+    bool m_started = false;
+
+    // 自上次提交以来的变化
+    QTimer m_flushTimer;
+    QSet<QString> m_addedCurveIds;    // 新增或数据有变化的曲线（整条写入）
+    QSet<QString> m_appendedCurveIds; // 只在末尾追加了采样的曲线（只写入追加部分）
+    QSet<QString> m_removedCurveIds;
+    bool m_cleared = false;
+    QStringList m_commandDescriptions;
+    int m_lastUndoCount = 0;
+    int m_lastRedoCount = 0;
+
+    // 各曲线已写入日志的原始数据点数（追加记录的起始下标）
+    QHash<QString, int> m_journaledSizes;
+
+    // 已提交但尚未写完的任务数
+    QMutex m_pendingMutex;
+    QWaitCondition m_pendingDone;
+    int m_pendingWrites = 0;
+};
+
+#endif // AUTOSAVE_MANAGER_H
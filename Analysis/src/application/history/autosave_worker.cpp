@@ -0,0 +1,88 @@
+#include "autosave_worker.h"
+#include <QDebug>
+
+AutosaveWorker::AutosaveWorker(QObject* parent)
+    : QObject(parent)
+{
+}
+
+void AutosaveWorker::startJournal(const QString& filePath)
+{
+    m_curveBytes.clear();
+    m_compactionRequested = false;
+    m_journalOpen = m_journal.create(filePath);
+}
+
+void AutosaveWorker::writeBatch(const AutosaveBatch& batch)
+{
+    if (batch.cleared) {
+        m_curveBytes.clear();
+    }
+    for (const QString& curveId : batch.removedCurveIds) {
+        m_curveBytes.remove(curveId);
+    }
+    for (const ThermalCurve& curve : batch.curves) {
+        m_curveBytes.insert(curve.id(), curveBytes(curve));
+    }
+    for (const AutosaveAppend& append : batch.appends) {
+        m_curveBytes[append.curveId] += qint64(append.samples.size()) * 3 * qint64(sizeof(double));
+    }
+
+    if (!m_journalOpen) {
+        return;
+    }
+    if (!m_journal.appendBatch(batch)) {
+        qWarning() << "AutosaveWorker: 追加自动保存批次失败:" << m_journal.errorString();
+        return;
+    }
+
+    const qint64 journalSize = m_journal.size();
+    if (!m_compactionRequested && journalSize > qMax(CompactMinimumBytes, 2 * totalBytes())) {
+        m_compactionRequested = true;
+        emit compactionRequested();
+    }
+}
+
+void AutosaveWorker::compact(const QVector<ThermalCurve>& curves, const QString& activeCurveId)
+{
+    m_compactionRequested = false;
+    m_curveBytes.clear();
+    for (const ThermalCurve& curve : curves) {
+        m_curveBytes.insert(curve.id(), curveBytes(curve));
+    }
+    if (m_journalOpen) {
+        m_journal.compact(curves, activeCurveId);
+    }
+}
+
+void AutosaveWorker::finishJournal(bool removeJournal)
+{
+    if (removeJournal) {
+        m_journal.remove();
+    } else {
+        m_journal.close();
+    }
+    m_journalOpen = false;
+    m_curveBytes.clear();
+    m_compactionRequested = false;
+}
+
+qint64 AutosaveWorker::curveBytes(const ThermalCurve& curve)
+{
+    const ThermalDataSeries& raw = curve.getRawData();
+    const ThermalDataSeries& processed = curve.getProcessedData();
+    qint64 bytes = qint64(raw.size()) * 3 * qint64(sizeof(double));
+    if (!processed.isSharedWith(raw)) {
+        bytes += qint64(processed.size()) * 3 * qint64(sizeof(double));
+    }
+    return bytes;
+}
+
+qint64 AutosaveWorker::totalBytes() const
+{
+    qint64 bytes = 0;
+    for (qint64 curveSize : m_curveBytes) {
+        bytes += curveSize;
+    }
+    return bytes;
+}
@@ -0,0 +1,72 @@
+#ifndef AUTOSAVE_WORKER_H
+#define AUTOSAVE_WORKER_H
+
+#include "domain/model/thermal_curve.h"
+#include "infrastructure/io/autosave_journal.h"
+#include <QHash>
+#include <QObject>
+#include <QString>
+
+/**
+ * @brief 自动保存线程执行器
+ *
+ * 由 AutosaveManager 创建并移动到自动保存线程，所有方法都通过排队调用在该线程中执行。
+ * 写完批次后不保留曲线（否则主线程每次修改曲线都要分离出整份采样副本），只记录各曲线的数据量；
+ * 日志大小超过数据量的两倍（且不小于 CompactMinimumBytes）时发出 compactionRequested()，
+ * 由主线程取当前全部曲线的快照交给 compact()。
+ */
+class AutosaveWorker : public QObject {
+    Q_OBJECT
+
+public:
+    static constexpr qint64 CompactMinimumBytes = 8 * 1024 * 1024;
+
+    explicit AutosaveWorker(QObject* parent = nullptr);
+
+    /**
+     * @brief 创建新日志并清空数据量记录
+     */
+    void startJournal(const QString& filePath);
+
+    /**
+     * @brief 追加批次到日志并更新各曲线的数据量，日志过大时请求压缩
+     */
+    void writeBatch(const AutosaveBatch& batch);
+
+    /**
+     * @brief 以主线程提供的快照压缩日志
+     * @param curves 当前全部曲线（父曲线在前）
+     * @param activeCurveId 活动曲线
+     */
+    void compact(const QVector<ThermalCurve>& curves, const QString& activeCurveId);
+
+    /**
+     * @brief 关闭日志并清空数据量记录
+     * @param removeJournal 是否删除日志文件（正常退出时删除）
+     */
+    void finishJournal(bool removeJournal);
+
+signals:
+    /**
+     * @brief 日志需要压缩（在 compact() 完成之前只发出一次）
+     */
+    void compactionRequested();
+
+private:
+    /**
+     * @brief 曲线的采样数据量（字节），作为该曲线在压缩后日志中大小的估计
+     */
+    static qint64 curveBytes(const ThermalCurve& curve);
+
+    /**
+     * @brief 全部曲线的采样数据量（字节）
+     */
+    qint64 totalBytes() const;
+
+    AutosaveJournal m_journal;
+    bool m_journalOpen = false;
+    QHash<QString, qint64> m_curveBytes; // 曲线ID → 数据量（不持有曲线，避免主线程写入时分离副本）
+    bool m_compactionRequested = false;
+};
+
+#endif // AUTOSAVE_WORKER_H
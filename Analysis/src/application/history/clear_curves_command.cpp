@@ -52,10 +52,8 @@ bool ClearCurvesCommand::undo()
         return false;
     }
 
-    // 恢复所有曲线
-    for (const ThermalCurve& curve : m_savedCurves) {
-        m_curveManager->addCurve(curve);
-    }
+    // 恢复所有曲线（父曲线在前，一次性加入）
+    m_curveManager->addCurves(orderParentFirst(m_savedCurves));
 
     // 恢复活动曲线
     if (!m_savedActiveId.isEmpty()) {
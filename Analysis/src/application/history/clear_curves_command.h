@@ -31,7 +31,7 @@ public:
 
 private:
     CurveManager* m_curveManager = nullptr;
-    QMap<QString, ThermalCurve> m_savedCurves;  ///< 保存被清空的曲线
+    QMap<QString, ThermalCurve> m_savedCurves;  ///< 保存被清空的曲线（采样数据为共享句柄）
     QString m_savedActiveId;                     ///< 保存被清空前的活动曲线ID
     QString m_description;
     bool m_hasExecuted = false;
@@ -46,6 +46,14 @@ bool HistoryManager::undo()
     return performStackOperation(m_undoStack, m_redoStack, &ICommand::undo, "撤销");
 }
 
+bool HistoryManager::undoIfTop(const ICommand* command)
+{
+    if (!command || m_undoStack.empty() || m_undoStack.back().get() != command) {
+        return false;
+    }
+    return undo();
+}
+
 bool HistoryManager::redo()
 {
     return performStackOperation(m_redoStack, m_undoStack, &ICommand::redo, "重做");
@@ -93,6 +101,10 @@ int HistoryManager::undoCount() const { return m_undoStack.size(); }
 
 int HistoryManager::redoCount() const { return m_redoStack.size(); }
 
+QString HistoryManager::undoDescription() const { return m_undoStack.empty() ? QString() : m_undoStack.back()->description(); }
+
+QString HistoryManager::redoDescription() const { return m_redoStack.empty() ? QString() : m_redoStack.back()->description(); }
+
 void HistoryManager::clear()
 {
     m_undoStack.clear();
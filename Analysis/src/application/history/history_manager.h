@@ -44,6 +44,15 @@ public:
      */
     bool undo();
 
+    /**
+     * @brief 仅当撤销栈顶正是 command 时撤销它。
+     *
+     * 用于撤销异步流程中自己提交的命令：期间用户可能又执行了其他命令，不能盲目撤销栈顶。
+     * @param command 之前传给 executeCommand() 的命令（只比较地址，不会解引用）
+     * @return 栈顶是该命令且撤销成功时返回 true。
+     */
+    bool undoIfTop(const ICommand* command);
+
     /**
      * @brief 重做最近被撤销的命令。
      * @return 如果重做成功返回 true，否则返回 false。
@@ -74,6 +83,18 @@ public:
      */
     int redoCount() const;
 
+    /**
+     * @brief 获取撤销栈顶命令的描述。
+     * @return 下一次撤销将撤回的命令描述，撤销栈为空时返回空字符串。
+     */
+    QString undoDescription() const;
+
+    /**
+     * @brief 获取重做栈顶命令的描述。
+     * @return 下一次重做将重新执行的命令描述，重做栈为空时返回空字符串。
+     */
+    QString redoDescription() const;
+
     /**
      * @brief 清空所有历史记录。
      */
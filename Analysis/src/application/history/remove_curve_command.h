@@ -60,7 +60,7 @@ private:
     CurveManager* m_curveManager = nullptr;
     QString m_targetCurveId;                     ///< 目标曲线ID
     bool m_cascadeDelete = false;                ///< 是否级联删除
-    QVector<ThermalCurve> m_deletedCurves;       ///< 被删除的曲线列表（按删除顺序）
+    QVector<ThermalCurve> m_deletedCurves;       ///< 被删除的曲线列表（按删除顺序，采样数据为共享句柄）
     QString m_previousActiveId;                  ///< 删除前的活动曲线ID
     QString m_description;
     bool m_hasExecuted = false;
@@ -18,6 +18,7 @@ ProjectTreeManager::ProjectTreeManager(CurveManager* curveManager, QObject* pare
 
     // 连接 CurveManager 信号
     connect(m_curveManager, &CurveManager::curveAdded, this, &ProjectTreeManager::onCurveAdded);
+    connect(m_curveManager, &CurveManager::curvesAdded, this, &ProjectTreeManager::onCurvesAdded);
     connect(m_curveManager, &CurveManager::curveRemoved, this, &ProjectTreeManager::onCurveRemoved);
     connect(m_curveManager, &CurveManager::curvesCleared, this, &ProjectTreeManager::onCurvesCleared);
 
@@ -58,6 +59,11 @@ void ProjectTreeManager::setCurveChecked(const QString& curveId, bool checked)
     emit curveCheckStateChanged(curveId, checked);
 }
 
+void ProjectTreeManager::setCurvesInitiallyUnchecked(const QStringList& curveIds)
+{
+    m_initiallyUnchecked = QSet<QString>(curveIds.begin(), curveIds.end());
+}
+
 void ProjectTreeManager::setActiveCurve(const QString& curveId)
 {
     QStandardItem* item = findCurveItem(curveId);
@@ -121,8 +127,9 @@ void ProjectTreeManager::onCurveAdded(const QString& curveId)
     // 查找或创建项目节点
     QStandardItem* projectItem = findOrCreateProjectItem(curve->projectName());
 
-    // 创建曲线节点(新添加的曲线默认勾选)
-    QStandardItem* curveItem = createCurveItem(*curve, true);
+    // 创建曲线节点(新添加的曲线默认勾选,恢复项目时保存为未勾选的曲线除外)
+    const bool checked = !m_initiallyUnchecked.remove(curveId);
+    QStandardItem* curveItem = createCurveItem(*curve, checked);
 
     // 如果有父曲线,添加到父曲线下;否则添加到项目节点下
     if (!curve->parentId().isEmpty()) {
@@ -138,7 +145,14 @@ void ProjectTreeManager::onCurveAdded(const QString& curveId)
     }
 
     // 发射勾选状态变化信号
-    emit curveCheckStateChanged(curveId, true);
+    emit curveCheckStateChanged(curveId, checked);
+}
+
+void ProjectTreeManager::onCurvesAdded(const QStringList& curveIds)
+{
+    for (const QString& curveId : curveIds) {
+        onCurveAdded(curveId);
+    }
 }
 
 void ProjectTreeManager::onCurveRemoved(const QString& curveId)
@@ -5,6 +5,7 @@
 #include <QStandardItemModel>
 #include <QStandardItem>
 #include <QMap>
+#include <QSet>
 #include <QString>
 #include <QStringList>
 
@@ -46,6 +47,14 @@ public:
      */
     void setCurveChecked(const QString& curveId, bool checked);
 
+    /**
+     * @brief 指定一批即将添加的曲线以未勾选状态加入树中（用于恢复项目）
+     * @param curveIds 曲线ID列表；每个ID在对应曲线添加时生效一次
+     *
+     * 其余新添加的曲线仍默认勾选。
+     */
+    void setCurvesInitiallyUnchecked(const QStringList& curveIds);
+
     /**
      * @brief 设置活动曲线（高亮显示）
      * @param curveId 曲线ID
@@ -72,6 +81,11 @@ public slots:
      */
     void onCurveAdded(const QString& curveId);
 
+    /**
+     * @brief 响应 CurveManager 的批量添加信号（父曲线在前，逐条插入节点）
+     */
+    void onCurvesAdded(const QStringList& curveIds);
+
     /**
      * @brief 响应 CurveManager 的曲线移除信号
      */
@@ -171,6 +185,7 @@ private:
     QStandardItem* createCurveItem(const ThermalCurve& curve, bool checked = false);
 
     CurveManager* m_curveManager;      // 曲线管理器
+    QSet<QString> m_initiallyUnchecked; // 添加时不勾选的曲线（恢复项目时设置）
     QStandardItemModel* m_model;        // Qt 标准模型
 };
 
@@ -0,0 +1,60 @@
+#include "algorithm_descriptor.h"
+
+namespace {
+
+bool fail(QString* error, const QString& reason)
+{
+    if (error) {
+        *error = reason;
+    }
+    return false;
+}
+
+bool isNumericType(QVariant::Type type)
+{
+    return type == QVariant::Int || type == QVariant::UInt || type == QVariant::LongLong
+        || type == QVariant::ULongLong || type == QVariant::Double;
+}
+
+} // namespace
+
+bool validateAlgorithmParameters(const AlgorithmDescriptor& descriptor, const QVariantMap& parameters, QString* error)
+{
+    for (const AlgorithmParameterDefinition& param : descriptor.parameters) {
+        const QString name = param.label.isEmpty() ? param.key : param.label;
+        if (!parameters.contains(param.key)) {
+            continue; // 缺失的参数由算法使用自身默认值（必填项由调用方补全默认值时检查）
+        }
+
+        // 1. 类型：能无损转换为声明的类型（如 "12" 对 Int 合法，"abc" 不合法）
+        QVariant value = parameters.value(param.key);
+        if (param.valueType != QVariant::Invalid && !value.convert(int(param.valueType))) {
+            return fail(error, QStringLiteral("参数 %1 的取值类型无效").arg(name));
+        }
+
+        // 2. 数值范围（闭区间）
+        if (isNumericType(param.valueType)) {
+            const double number = value.toDouble();
+            if (param.constraints.contains(QStringLiteral("min"))
+                && number < param.constraints.value(QStringLiteral("min")).toDouble()) {
+                return fail(error, QStringLiteral("参数 %1 不能小于 %2")
+                                       .arg(name, param.constraints.value(QStringLiteral("min")).toString()));
+            }
+            if (param.constraints.contains(QStringLiteral("max"))
+                && number > param.constraints.value(QStringLiteral("max")).toDouble()) {
+                return fail(error, QStringLiteral("参数 %1 不能大于 %2")
+                                       .arg(name, param.constraints.value(QStringLiteral("max")).toString()));
+            }
+        }
+
+        // 3. 可选值列表
+        if (param.constraints.contains(QStringLiteral("options"))) {
+            const QStringList options = param.constraints.value(QStringLiteral("options")).toStringList();
+            if (!options.contains(value.toString())) {
+                return fail(error, QStringLiteral("参数 %1 的取值 \"%2\" 不在可选范围内（%3）")
+                                       .arg(name, value.toString(), options.join(QStringLiteral(", "))));
+            }
+        }
+    }
+    return true;
+}
@@ -5,6 +5,7 @@
 #include <QString>
 #include <QStringList>
 #include <QVariant>
+#include <QVariantMap>
 
 /**
  * @brief 定义算法交互类型
@@ -33,7 +34,7 @@ struct AlgorithmParameterDefinition {
     QVariant::Type valueType = QVariant::Invalid;
     QVariant defaultValue;       //!< 默认值（用于自动执行或预填）
     bool required = true;        //!< 是否必填
-    QVariantMap constraints;     //!< 约束信息（如 { "min":1, "max":100 } ）
+    QVariantMap constraints;     //!< 约束信息："min"/"max"（数值参数，闭区间）、"options"（可选值 QStringList）
 };
 
 /**
@@ -49,8 +50,23 @@ struct AlgorithmDescriptor {
     QString pointSelectionHint;
     QStringList prerequisites; //!< 执行前所需的上下文键（AlgorithmContext 内）
     QStringList produces;      //!< 执行完成后写回的上下文键
+    bool cacheable = false;    //!< 结果只由活动曲线数据与 param.* 决定，可被 AlgorithmManager 缓存复用
 };
 
+/**
+ * @brief 按描述信息校验参数取值
+ *
+ * 逐个检查描述中声明且 parameters 中存在的参数：取值必须能转换为声明的类型，
+ * 并满足 constraints 中的 "min"、"max"、"options"。缺失的参数与描述中未声明的键不做检查。
+ *
+ * @param descriptor 算法描述
+ * @param parameters 参数键值（通常已由默认值补全）
+ * @param error 校验失败时输出原因（可为空）
+ * @return 全部参数合法时返回 true
+ */
+bool validateAlgorithmParameters(const AlgorithmDescriptor& descriptor, const QVariantMap& parameters,
+                                 QString* error = nullptr);
+
 Q_DECLARE_METATYPE(AlgorithmDescriptor)
 Q_DECLARE_METATYPE(AlgorithmParameterDefinition)
 
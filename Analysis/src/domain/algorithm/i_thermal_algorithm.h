@@ -83,6 +83,20 @@ public:
     // 接口必须有虚析构函数
     virtual ~IThermalAlgorithm() = default;
 
+    /**
+     * @brief 创建算法的独立副本（原型模式）
+     *
+     * AlgorithmManager 中注册的实例只作为原型；每个异步任务执行前克隆一份，
+     * 由任务独占，因此多个工作线程可以同时执行同一算法而互不干扰
+     * （setProgressReporter() 只作用于该任务自己的副本）。
+     *
+     * 实现通常为 `return new MyAlgorithm(*this);`，副本保留默认参数等配置，
+     * 但不继承进度报告器。
+     *
+     * @return 新的算法实例（调用方拥有所有权）
+     */
+    virtual IThermalAlgorithm* clone() const = 0;
+
     // ==================== 核心接口方法 ====================
 
     /**
@@ -326,6 +340,15 @@ protected:
         return false;
     }
 
+protected:
+    IThermalAlgorithm() = default;
+
+    /**
+     * @brief 复制构造（供 clone() 使用）：副本不继承进度报告器，由执行它的 Worker 重新设置
+     */
+    IThermalAlgorithm(const IThermalAlgorithm&) {}
+    IThermalAlgorithm& operator=(const IThermalAlgorithm&) = delete;
+
 private:
     mutable IProgressReporter* m_progressReporter = nullptr;  ///< 进度报告器（由 Worker 设置，mutable 允许在 const 方法中调用）
 };
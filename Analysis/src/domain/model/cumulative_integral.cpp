@@ -0,0 +1,92 @@
+#include "cumulative_integral.h"
+#include "monotonic_segment_index.h"
+#include <QtGlobal>
+#include <utility>
+
+CumulativeIntegral::CumulativeIntegral(const ColumnView<double>& x, const ColumnView<double>& y)
+{
+    const int n = qMin(x.size(), y.size());
+    if (n == 0) {
+        return;
+    }
+
+    m_cumulative.resize(n);
+    double cum = 0.0;
+
+    // 第一个点的积分为0
+    m_cumulative[0] = 0.0;
+
+    for (int i = 1; i < n; ++i) {
+        const double dx = x[i] - x[i - 1];
+        if (!qFuzzyIsNull(dx)) {
+            cum += 0.5 * (y[i - 1] + y[i]) * dx; // 梯形法则
+        }
+        m_cumulative[i] = cum;
+    }
+}
+
+double CumulativeIntegral::integrate(const ColumnView<double>& x, const ColumnView<double>& y,
+                                     const MonotonicSegmentIndex& segments, double lo, double hi) const
+{
+    if (m_cumulative.size() < 2 || m_cumulative.size() != x.size()) {
+        return 0.0;
+    }
+    if (lo > hi) {
+        std::swap(lo, hi);
+    }
+
+    double area = 0.0;
+    for (const MonotonicSegmentIndex::Segment& segment : segments.segments()) {
+        // 沿采样顺序计入：降序段的 dx < 0
+        const double ascendingArea = integrateSegment(x, y, segment, lo, hi);
+        area += segment.ascending ? ascendingArea : -ascendingArea;
+    }
+    return area;
+}
+
+double CumulativeIntegral::integrateSegment(const ColumnView<double>& x, const ColumnView<double>& y,
+                                            const MonotonicSegmentIndex::Segment& segment, double lo, double hi) const
+{
+    if (m_cumulative.size() < 2 || m_cumulative.size() != x.size()) {
+        return 0.0;
+    }
+    if (lo > hi) {
+        std::swap(lo, hi);
+    }
+
+    // 区间裁剪到本段的 X 范围
+    const double segMin = segment.ascending ? x[segment.first] : x[segment.last];
+    const double segMax = segment.ascending ? x[segment.last] : x[segment.first];
+    const double clippedLo = qMax(lo, segMin);
+    const double clippedHi = qMin(hi, segMax);
+    if (clippedHi <= clippedLo) {
+        return 0.0;
+    }
+
+    // 定位两个端点所在的点对（bracket 返回的起点即包含端点的点对）
+    int kLo = 0;
+    int kHi = 0;
+    int unused = 0;
+    MonotonicSegmentIndex::bracket(x, segment, clippedLo, clippedLo, kLo, unused);
+    MonotonicSegmentIndex::bracket(x, segment, clippedHi, clippedHi, kHi, unused);
+
+    // 前缀积分的 dx 带符号：降序段从 clippedHi 走到 clippedLo 累积的是 -(升序积分)，
+    // 两种方向的升序积分因此都是 atHi - atLo
+    const double atLo = valueAt(x, y, kLo, clippedLo);
+    const double atHi = valueAt(x, y, kHi, clippedHi);
+    return atHi - atLo;
+}
+
+double CumulativeIntegral::valueAt(const ColumnView<double>& x, const ColumnView<double>& y, int k, double t) const
+{
+    const double x0 = x[k];
+    const double x1 = x[k + 1];
+    const double dx = t - x0;
+    if (qFuzzyIsNull(x1 - x0) || qFuzzyIsNull(dx)) {
+        return m_cumulative[k];
+    }
+
+    // 端点处线性插值，补足部分梯形
+    const double yt = y[k] + (y[k + 1] - y[k]) * (dx / (x1 - x0));
+    return m_cumulative[k] + 0.5 * (y[k] + yt) * dx;
+}
@@ -0,0 +1,67 @@
+#ifndef CUMULATIVEINTEGRAL_H
+#define CUMULATIVEINTEGRAL_H
+
+#include "monotonic_segment_index.h"
+#include "thermal_data_series.h"
+#include <QVector>
+
+/**
+ * @brief 累积梯形积分（前缀积分）
+ *
+ * values()[i] = ∫ y dx 从第 0 个点沿采样顺序积分到第 i 个点（梯形法则，dx 带符号）。
+ * 与积分算法输出的曲线相同，任意区间的面积因此可由两次端点查找得到：
+ * 在单调段内二分定位端点所在的点对，再对端点处做线性插值补足部分梯形，
+ * 每次查询 O(段数 · log N)，与区间内的点数无关。
+ *
+ * 由 ThermalDataSeries::cumulativeIntegral() 按版本懒构建并缓存。
+ */
+class CumulativeIntegral {
+public:
+    CumulativeIntegral() = default;
+
+    /**
+     * @brief 由 X/Y 列构建前缀积分（不保存列本身，查询时需传入同一组列）
+     */
+    CumulativeIntegral(const ColumnView<double>& x, const ColumnView<double>& y);
+
+    /**
+     * @brief 各采样点处的累积积分值（第一个点为 0）
+     */
+    const QVector<double>& values() const { return m_cumulative; }
+
+    /**
+     * @brief 计算 X 落在 [lo, hi] 内部分的面积 ∫ y dx
+     *
+     * 非单调曲线逐段累加，X 递减的段按 dx < 0 计入（与逐点梯形求和一致）。
+     * 区间超出数据范围的部分不计入。
+     *
+     * @param x 构建时使用的 X 列
+     * @param y 构建时使用的 Y 列
+     * @param segments X 列的单调段索引
+     * @param lo 区间下界
+     * @param hi 区间上界（小于 lo 时自动交换）
+     */
+    double integrate(const ColumnView<double>& x, const ColumnView<double>& y,
+                     const MonotonicSegmentIndex& segments, double lo, double hi) const;
+
+    /**
+     * @brief 计算单个单调段中 X 落在 [lo, hi] 内部分的面积，按 X 升序积分（与段的方向无关）
+     *
+     * 降温段与升温段上同一形状的峰得到相同符号的面积，适合需要与基线面积相减的测量。
+     * 区间超出本段 X 范围的部分不计入。
+     *
+     * @param segment x 的单调段索引中的一段
+     */
+    double integrateSegment(const ColumnView<double>& x, const ColumnView<double>& y,
+                            const MonotonicSegmentIndex::Segment& segment, double lo, double hi) const;
+
+private:
+    /**
+     * @brief 点对 (k, k+1) 内从第 k 个点积分到 X = t 处的累积值
+     */
+    double valueAt(const ColumnView<double>& x, const ColumnView<double>& y, int k, double t) const;
+
+    QVector<double> m_cumulative;
+};
+
+#endif // CUMULATIVEINTEGRAL_H
@@ -0,0 +1,191 @@
+#include "min_max_decimator.h"
+#include <QtGlobal>
+
+namespace {
+
+/**
+ * @brief 采样区间 [first, last]（闭区间）
+ */
+struct SampleRange {
+    int first = 0;
+    int last = 0;
+};
+
+/**
+ * @brief 追加一个下标（与上一个相同时跳过，相邻单调段共享折返点）
+ */
+inline void emitIndex(QVector<int>& out, int index)
+{
+    if (out.isEmpty() || out.last() != index) {
+        out.append(index);
+    }
+}
+
+/**
+ * @brief 按采样顺序输出一个桶的最小/最大值点
+ */
+inline void emitBucket(QVector<int>& out, int minIndex, int maxIndex)
+{
+    if (minIndex < 0) {
+        return;
+    }
+    emitIndex(out, qMin(minIndex, maxIndex));
+    emitIndex(out, qMax(minIndex, maxIndex));
+}
+
+/**
+ * @brief 逐点扫描 [first, last] 并输出其最小/最大值点
+ */
+void emitScanned(QVector<int>& out, const ColumnView<double>& y, int first, int last)
+{
+    if (first > last) {
+        return;
+    }
+    int minIndex = first;
+    int maxIndex = first;
+    for (int i = first + 1; i <= last; ++i) {
+        if (y[i] < y[minIndex]) {
+            minIndex = i;
+        }
+        if (y[i] > y[maxIndex]) {
+            maxIndex = i;
+        }
+    }
+    emitBucket(out, minIndex, maxIndex);
+}
+
+/**
+ * @brief 用金字塔第 level 层输出 [first, last] 内各块的极值点
+ *
+ * 区间两端与块边界不对齐的部分（各不足一块）逐点扫描，合为一个桶输出。
+ */
+void emitPyramidBlocks(QVector<int>& out, const ColumnView<double>& y, const MinMaxPyramid& pyramid, int level,
+                       int first, int last)
+{
+    const int size = MinMaxPyramid::blockSize(level);
+    const MinMaxPyramid::Level& blocks = pyramid.level(level);
+
+    int i = first;
+    if (i % size != 0) {
+        const int headLast = qMin(last, (i / size + 1) * size - 1);
+        emitScanned(out, y, i, headLast);
+        i = headLast + 1;
+    }
+    for (; i + size - 1 <= last; i += size) {
+        const int b = i / size;
+        emitBucket(out, blocks.minIndex[b], blocks.maxIndex[b]);
+    }
+    emitScanned(out, y, i, last);
+}
+
+} // namespace
+
+QVector<int> MinMaxDecimator::decimate(const ColumnView<double>& x, const ColumnView<double>& y,
+                                       const MonotonicSegmentIndex& segments, double xMin, double xMax, int bucketCount,
+                                       const MinMaxPyramid* pyramid)
+{
+    QVector<int> indices;
+    if (x.isEmpty()) {
+        return indices;
+    }
+    if (x.size() == 1) {
+        indices.append(0);
+        return indices;
+    }
+
+    // 1. 每个单调段内二分定位可见区间（含两端紧邻的一个点）。采样下标相接的区间合并为一个：
+    //    传感器抖动把 X 列切成大量细碎的单调段时，它们合成少数几个连续区间，不必逐段输出端点
+    QVector<SampleRange> ranges;
+    int visibleCount = 0;
+    for (const MonotonicSegmentIndex::Segment& segment : segments.segments()) {
+        SampleRange range;
+        if (!MonotonicSegmentIndex::bracket(x, segment, xMin, xMax, range.first, range.last)) {
+            continue;
+        }
+        if (!ranges.isEmpty() && range.first <= ranges.last().last + 1) {
+            SampleRange& merged = ranges.last();
+            visibleCount += qMax(0, range.last - merged.last);
+            merged.last = qMax(merged.last, range.last);
+        } else {
+            ranges.append(range);
+            visibleCount += range.last - range.first + 1;
+        }
+    }
+
+    // 2. 可见点不多时原样输出
+    const bool decimating = bucketCount > 0 && xMax > xMin && visibleCount > 2 * bucketCount;
+    bool collapsed = false;
+
+    // 合并后区间仍与桶数相当（曲线反复进出可见范围）时，仅各区间端点就会超出绘制预算：
+    // 退化为对整个可见下标跨度 [首个区间起点, 末个区间终点] 抽稀，跨度内范围外的采样画在绘图区之外
+    if (decimating && ranges.size() > bucketCount / 2) {
+        const SampleRange span = { ranges.first().first, ranges.last().last };
+        ranges = { span };
+        visibleCount = span.last - span.first + 1;
+        collapsed = true;
+    }
+    indices.reserve(decimating ? 4 * bucketCount + 4 * ranges.size() : visibleCount);
+    if (!decimating) {
+        for (const SampleRange& range : ranges) {
+            for (int i = range.first; i <= range.last; ++i) {
+                emitIndex(indices, i);
+            }
+        }
+        return indices;
+    }
+
+    // 3. 每桶平均至少一个最细层块时，区间内部直接取金字塔对应层的块极值，开销与桶数成正比
+    const int level = (pyramid && pyramid->sampleCount() == y.size())
+        ? pyramid->levelForBlockSize(visibleCount / bucketCount) : -1;
+    if (level >= 0) {
+        for (const SampleRange& range : ranges) {
+            emitIndex(indices, range.first);
+            emitPyramidBlocks(indices, y, *pyramid, level, range.first + 1, range.last - 1);
+            emitIndex(indices, range.last);
+        }
+        return indices;
+    }
+
+    // 4. 整段跨度中 X 反复进出可见范围，按 X 分桶时桶号来回切换，输出随往返次数增长：
+    //    没有可用的金字塔层时改为按下标把跨度等分为 bucketCount 段，逐段输出极值点
+    if (collapsed) {
+        const SampleRange& span = ranges.first();
+        const qint64 inner = span.last - span.first - 1;
+        emitIndex(indices, span.first);
+        for (int b = 0; b < bucketCount; ++b) {
+            emitScanned(indices, y, span.first + 1 + int(inner * b / bucketCount),
+                        span.first + int(inner * (b + 1) / bucketCount));
+        }
+        emitIndex(indices, span.last);
+        return indices;
+    }
+
+    // 5. 放大后每桶采样较少：区间内部按 X 分桶，只保留每桶的最小/最大值点；区间端点原样保留
+    const double bucketWidth = (xMax - xMin) / bucketCount;
+    for (const SampleRange& range : ranges) {
+        emitIndex(indices, range.first);
+
+        int bucket = -1;
+        int minIndex = -1;
+        int maxIndex = -1;
+        for (int i = range.first + 1; i < range.last; ++i) {
+            const int b = qBound(0, int((x[i] - xMin) / bucketWidth), bucketCount - 1);
+            if (b != bucket) {
+                emitBucket(indices, minIndex, maxIndex);
+                bucket = b;
+                minIndex = maxIndex = i;
+                continue;
+            }
+            if (y[i] < y[minIndex]) {
+                minIndex = i;
+            }
+            if (y[i] > y[maxIndex]) {
+                maxIndex = i;
+            }
+        }
+        emitBucket(indices, minIndex, maxIndex);
+
+        emitIndex(indices, range.last);
+    }
+    return indices;
+}
@@ -0,0 +1,42 @@
+#ifndef MINMAXDECIMATOR_H
+#define MINMAXDECIMATOR_H
+
+#include "min_max_pyramid.h"
+#include "monotonic_segment_index.h"
+#include <QVector>
+
+/**
+ * @brief 按屏幕像素桶做最小/最大值抽稀（绘图用的细节层次）
+ *
+ * 把 X 落在 [xMin, xMax] 内的部分等分为 bucketCount 个 X 桶，每桶只保留 Y 最小和最大的两个采样点
+ * （按采样顺序输出）。每个像素列内折线实际覆盖的竖直范围与全分辨率绘制相同，尖峰不会被削掉，
+ * 绘制的点数约为 2 × bucketCount，与曲线总点数无关。
+ *
+ * 非单调的 X 列（回温、折返）按单调段分别定位可见区间，采样下标相接的区间合并后依次抽稀、拼接；
+ * 每个区间两端紧邻可见范围的采样点原样保留，使折线一直延伸到绘图区边缘。抖动造成的大量细碎单调段
+ * 因此合成少数区间；合并后区间数仍超过 bucketCount / 2 时，改为对整个可见下标跨度抽稀，
+ * 输出点数始终受桶数限制。可见点数不超过 2 × bucketCount 时不抽稀，直接返回全部可见点。
+ *
+ * 提供 Y 列的 MinMaxPyramid 且每个桶平均不少于一个最细层块的采样时，改为按下标取金字塔中块大小最接近
+ * 每桶采样数的一层，直接输出各块的极值点（2～4 × bucketCount 个），不再逐点扫描可见范围；
+ * 放大到每桶不足一个最细层块时才逐点读取可见的原始采样。
+ */
+class MinMaxDecimator {
+public:
+    /**
+     * @brief 抽稀可见范围内的采样
+     * @param x X 列
+     * @param y Y 列
+     * @param segments X 列的单调段索引
+     * @param xMin 可见范围下界
+     * @param xMax 可见范围上界
+     * @param bucketCount 桶数（通常为绘图区宽度的像素数）
+     * @param pyramid Y 列的最小/最大值金字塔（可为空，为空时总是逐点扫描）
+     * @return 保留的采样点下标（按绘制顺序）
+     */
+    static QVector<int> decimate(const ColumnView<double>& x, const ColumnView<double>& y,
+                                 const MonotonicSegmentIndex& segments, double xMin, double xMax, int bucketCount,
+                                 const MinMaxPyramid* pyramid = nullptr);
+};
+
+#endif // MINMAXDECIMATOR_H
@@ -0,0 +1,141 @@
+#include "min_max_pyramid.h"
+#include <QtGlobal>
+
+MinMaxPyramid::MinMaxPyramid(const ColumnView<double>& y)
+{
+    append(y);
+}
+
+void MinMaxPyramid::append(const ColumnView<double>& y)
+{
+    const int oldCount = m_sampleCount;
+    const int n = y.size();
+    if (n < oldCount) {
+        // 采样变少说明不是追加，整体重建
+        m_levels.clear();
+        m_sampleCount = 0;
+        append(y);
+        return;
+    }
+    if (n == oldCount || n == 0) {
+        return;
+    }
+    m_sampleCount = n;
+
+    for (int l = 0;; ++l) {
+        const int size = blockSize(l);
+        const int blocks = (n + size - 1) / size;
+        if (l == m_levels.size()) {
+            m_levels.append(Level());
+        }
+        Level& level = m_levels[l];
+
+        // 原末尾不完整的块和新增的块需要重算，之前的完整块不变
+        const int firstDirty = qMin(oldCount / size, level.minIndex.size());
+        level.minIndex.resize(blocks);
+        level.maxIndex.resize(blocks);
+
+        if (l == 0) {
+            for (int b = firstDirty; b < blocks; ++b) {
+                const int first = b * size;
+                const int last = qMin(n, first + size);
+                int minIndex = first;
+                int maxIndex = first;
+                for (int i = first + 1; i < last; ++i) {
+                    if (y[i] < y[minIndex]) {
+                        minIndex = i;
+                    }
+                    if (y[i] > y[maxIndex]) {
+                        maxIndex = i;
+                    }
+                }
+                level.minIndex[b] = minIndex;
+                level.maxIndex[b] = maxIndex;
+            }
+        } else {
+            const Level& lower = m_levels.at(l - 1);
+            const int lowerBlocks = lower.minIndex.size();
+            for (int b = firstDirty; b < blocks; ++b) {
+                int minIndex = lower.minIndex[2 * b];
+                int maxIndex = lower.maxIndex[2 * b];
+                if (2 * b + 1 < lowerBlocks) {
+                    const int rightMin = lower.minIndex[2 * b + 1];
+                    const int rightMax = lower.maxIndex[2 * b + 1];
+                    if (y[rightMin] < y[minIndex]) {
+                        minIndex = rightMin;
+                    }
+                    if (y[rightMax] > y[maxIndex]) {
+                        maxIndex = rightMax;
+                    }
+                }
+                level.minIndex[b] = minIndex;
+                level.maxIndex[b] = maxIndex;
+            }
+        }
+
+        if (blocks == 1) {
+            break;
+        }
+    }
+}
+
+bool MinMaxPyramid::rangeMinMax(const ColumnView<double>& y, int first, int last, int& minIndex, int& maxIndex) const
+{
+    first = qMax(first, 0);
+    last = qMin(last, m_sampleCount - 1);
+    if (first > last) {
+        return false;
+    }
+
+    minIndex = maxIndex = first;
+    const auto take = [&](int candidateMin, int candidateMax) {
+        if (y[candidateMin] < y[minIndex]) {
+            minIndex = candidateMin;
+        }
+        if (y[candidateMax] > y[maxIndex]) {
+            maxIndex = candidateMax;
+        }
+    };
+
+    // 1. 两端与最细层块边界不对齐的部分逐点比较
+    int i = first;
+    while (i <= last && i % BaseBlockSize != 0) {
+        take(i, i);
+        ++i;
+    }
+    int j = last;
+    while (j >= i && (j + 1) % BaseBlockSize != 0) {
+        take(j, j);
+        --j;
+    }
+    if (i > j) {
+        return true;
+    }
+
+    // 2. 中间的完整块自底向上合并：区间左端为右孩子、右端为左孩子时单独取出，其余交给上一层
+    int lo = i / BaseBlockSize;
+    int hi = (j + 1) / BaseBlockSize - 1;
+    for (int l = 0; l < m_levels.size() && lo <= hi; ++l) {
+        const Level& level = m_levels.at(l);
+        if (lo % 2 == 1) {
+            take(level.minIndex[lo], level.maxIndex[lo]);
+            ++lo;
+        }
+        if (hi % 2 == 0 && lo <= hi) {
+            take(level.minIndex[hi], level.maxIndex[hi]);
+            --hi;
+        }
+        lo /= 2;
+        hi = (hi + 1) / 2 - 1;
+    }
+    return true;
+}
+
+int MinMaxPyramid::levelForBlockSize(int maxBlockSize) const
+{
+    int result = -1;
+    for (int l = 0; l < m_levels.size() && blockSize(l) <= maxBlockSize; ++l) {
+        result = l;
+    }
+    return result;
+}
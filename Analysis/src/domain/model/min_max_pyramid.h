@@ -0,0 +1,74 @@
+#ifndef MINMAXPYRAMID_H
+#define MINMAXPYRAMID_H
+
+#include "thermal_data_series.h"
+#include <QVector>
+
+/**
+ * @brief 测量值列的多分辨率最小/最大值金字塔
+ *
+ * 第 l 层把采样按下标切成大小为 blockSize(l) = 2^(BaseBlockShift + l) 的块，记录每块 Y 最小、最大的采样点下标；
+ * 上一层由下一层相邻两块合并得到，最粗一层只有一块。所有层合计约占 N 字节。
+ *
+ * 块按采样下标而不是按 X 划分，同一份金字塔因此同时服务温度横轴和时间横轴：
+ * 抽稀时按可见采样数与像素数之比选层，直接输出该层各块的极值点（见 MinMaxDecimator），
+ * 每次缩放的开销与像素数成正比，与曲线点数无关。
+ *
+ * 各层合起来也是一棵自底向上的线段树：rangeMinMax() 把任意下标区间拆成 O(log N) 个块，
+ * 配合 X 列上的二分定位即可求出 X 范围内的 Y 极值（见 ThermalDataSeries::valueRange()）。
+ *
+ * 由 ThermalDataSeries::valuePyramid() 按版本懒构建并缓存；在末尾追加采样时增量更新（见 append()）。
+ */
+class MinMaxPyramid {
+public:
+    static constexpr int BaseBlockShift = 4;                  ///< 最细一层每块 16 个采样点
+    static constexpr int BaseBlockSize = 1 << BaseBlockShift;
+
+    /**
+     * @brief 一层中各块的极值点下标
+     */
+    struct Level {
+        QVector<int> minIndex; // 块内 Y 最小的采样点
+        QVector<int> maxIndex; // 块内 Y 最大的采样点
+    };
+
+    MinMaxPyramid() = default;
+
+    /**
+     * @brief 由 Y 列构建金字塔（不保存列本身）
+     */
+    explicit MinMaxPyramid(const ColumnView<double>& y);
+
+    /**
+     * @brief 更新到末尾追加了采样的 Y 列（前 sampleCount() 个采样必须未变）
+     *
+     * 只重算原末尾不完整的块和新增的块，开销 O(追加点数 + 层数 · BaseBlockSize)。
+     */
+    void append(const ColumnView<double>& y);
+
+    int sampleCount() const { return m_sampleCount; }
+    int levelCount() const { return m_levels.size(); }
+    const Level& level(int l) const { return m_levels.at(l); }
+    static int blockSize(int l) { return 1 << (BaseBlockShift + l); }
+
+    /**
+     * @brief 块大小不超过 maxBlockSize 的最粗一层
+     * @return 最细一层的块也比 maxBlockSize 大（应直接读取原始采样）时返回 -1
+     */
+    int levelForBlockSize(int maxBlockSize) const;
+
+    /**
+     * @brief 采样区间 [first, last]（闭区间）内 Y 最小、最大的采样点
+     *
+     * 区间内部拆成各层的完整块（每层至多两块），两端不足一个最细层块的部分逐点比较，开销 O(log N)。
+     * @param y 构建金字塔所用的 Y 列
+     * @return 区间为空时返回 false
+     */
+    bool rangeMinMax(const ColumnView<double>& y, int first, int last, int& minIndex, int& maxIndex) const;
+
+private:
+    QVector<Level> m_levels;
+    int m_sampleCount = 0;
+};
+
+#endif // MINMAXPYRAMID_H
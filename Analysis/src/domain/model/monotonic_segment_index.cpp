@@ -0,0 +1,109 @@
+#include "monotonic_segment_index.h"
+#include <QtGlobal>
+#include <algorithm>
+#include <functional>
+
+MonotonicSegmentIndex::MonotonicSegmentIndex(const ColumnView<double>& x)
+{
+    const int n = x.size();
+    if (n < 2) {
+        return;
+    }
+
+    // 相等的相邻点（dx == 0）归入当前段，不改变方向
+    int first = 0;
+    int direction = 0; // 0=尚未确定，1=递增，-1=递减
+    for (int i = 1; i < n; ++i) {
+        const double dx = x[i] - x[i - 1];
+        const int step = (dx > 0.0) ? 1 : (dx < 0.0 ? -1 : 0);
+        if (step == 0) {
+            continue;
+        }
+        if (direction == 0) {
+            direction = step;
+        } else if (step != direction) {
+            // 折返点 i-1 同时是上一段的段尾和下一段的段首
+            m_segments.append({ first, i - 1, direction > 0 });
+            first = i - 1;
+            direction = step;
+        }
+    }
+    m_segments.append({ first, n - 1, direction >= 0 });
+}
+
+bool MonotonicSegmentIndex::range(const ColumnView<double>& x, double& minX, double& maxX) const
+{
+    if (m_segments.isEmpty()) {
+        return false;
+    }
+
+    minX = x[m_segments.first().first];
+    maxX = minX;
+    for (const Segment& segment : m_segments) {
+        minX = qMin(minX, qMin(x[segment.first], x[segment.last]));
+        maxX = qMax(maxX, qMax(x[segment.first], x[segment.last]));
+    }
+    return true;
+}
+
+bool MonotonicSegmentIndex::bracket(const ColumnView<double>& x, const Segment& segment, double lo, double hi,
+                                    int& firstSample, int& lastSample)
+{
+    const double* begin = x.data() + segment.first;
+    const double* end = x.data() + segment.last + 1;
+
+    const double segMin = segment.ascending ? x[segment.first] : x[segment.last];
+    const double segMax = segment.ascending ? x[segment.last] : x[segment.first];
+    if (hi < segMin || lo > segMax) {
+        return false;
+    }
+
+    if (segment.ascending) {
+        // 最后一个 x <= lo 的点，到第一个 x >= hi 的点
+        firstSample = static_cast<int>(std::upper_bound(begin, end, lo) - x.data()) - 1;
+        lastSample = static_cast<int>(std::lower_bound(begin, end, hi) - x.data());
+    } else {
+        // 递减段：最后一个 x >= hi 的点，到第一个 x <= lo 的点
+        firstSample = static_cast<int>(std::upper_bound(begin, end, hi, std::greater<double>()) - x.data()) - 1;
+        lastSample = static_cast<int>(std::lower_bound(begin, end, lo, std::greater<double>()) - x.data());
+    }
+
+    firstSample = qBound(segment.first, firstSample, segment.last - 1);
+    lastSample = qBound(firstSample + 1, lastSample, segment.last);
+    return true;
+}
+
+int MonotonicSegmentIndex::nearest(const ColumnView<double>& x, double value) const
+{
+    if (m_segments.isEmpty()) {
+        return x.isEmpty() ? -1 : 0;
+    }
+
+    int best = -1;
+    double bestDist = 0.0;
+    const auto consider = [&](int i) {
+        const double dist = qAbs(x[i] - value);
+        if (best < 0 || dist < bestDist || (dist == bestDist && i < best)) {
+            best = i;
+            bestDist = dist;
+        }
+    };
+
+    for (const Segment& segment : m_segments) {
+        const double* begin = x.data() + segment.first;
+        const double* end = x.data() + segment.last + 1;
+        const auto firstNotBefore = [&](double v) {
+            return segment.ascending ? std::lower_bound(begin, end, v) : std::lower_bound(begin, end, v, std::greater<double>());
+        };
+
+        // 候选：第一个不在 value 之前的点，以及它之前的一串等值点中的第一个
+        const int i = static_cast<int>(firstNotBefore(value) - x.data());
+        if (i <= segment.last) {
+            consider(i);
+        }
+        if (i > segment.first) {
+            consider(static_cast<int>(firstNotBefore(x[i - 1]) - x.data()));
+        }
+    }
+    return best;
+}
@@ -0,0 +1,77 @@
+#ifndef MONOTONICSEGMENTINDEX_H
+#define MONOTONICSEGMENTINDEX_H
+
+#include "thermal_data_series.h"
+#include <QVector>
+
+/**
+ * @brief 横轴列的单调段索引
+ *
+ * 将 X 列划分为若干最大单调（非严格）段，使区间查询可以在每段内二分定位，
+ * 而不必扫描整条曲线。升温/降温程序通常只有一段；
+ * 含回温、恒温回摆等折返的曲线会被拆成多段，相邻段共享折返点。
+ *
+ * 索引按 ThermalDataSeries 的版本懒构建并缓存（见 ThermalDataSeries::xSegments()），
+ * 构建一次 O(N)，之后每次查询 O(段数 · log N)。
+ */
+class MonotonicSegmentIndex {
+public:
+    /**
+     * @brief 单调段（采样点下标闭区间）
+     */
+    struct Segment {
+        int first = 0;         // 段首采样点
+        int last = 0;          // 段尾采样点（last > first）
+        bool ascending = true; // true=X 非递减，false=X 非递增
+    };
+
+    MonotonicSegmentIndex() = default;
+
+    /**
+     * @brief 由 X 列构建索引（不保存列本身，查询时需传入同一列）
+     */
+    explicit MonotonicSegmentIndex(const ColumnView<double>& x);
+
+    const QVector<Segment>& segments() const { return m_segments; }
+
+    /**
+     * @brief 整列是否单调（0 或 1 段）
+     */
+    bool isMonotonic() const { return m_segments.size() <= 1; }
+
+    /**
+     * @brief 整列的 X 范围（由各段端点求得，O(段数)）
+     * @return 列为空或只有一个点时返回 false
+     */
+    bool range(const ColumnView<double>& x, double& minX, double& maxX) const;
+
+    /**
+     * @brief 在单调段内二分查找覆盖 [lo, hi] 的采样区间
+     *
+     * 返回的 [firstSample, lastSample] 满足：段内所有与 [lo, hi] 相交的相邻点对
+     * (k, k+1) 都有 firstSample <= k < lastSample。区间与段不相交时返回 false。
+     *
+     * @param x 构建索引时使用的 X 列
+     * @param segment 目标段
+     * @param lo 区间下界
+     * @param hi 区间上界（hi >= lo）
+     * @param firstSample 输出：起始采样点下标
+     * @param lastSample 输出：结束采样点下标
+     */
+    static bool bracket(const ColumnView<double>& x, const Segment& segment, double lo, double hi,
+                        int& firstSample, int& lastSample);
+
+    /**
+     * @brief X 最接近 value 的采样点（每段内二分查找，O(段数 · log N)）
+     *
+     * 距离相同时返回下标最小的点，与从头逐点扫描的结果一致。
+     * @param x 构建索引时使用的 X 列
+     * @return 列为空时返回 -1
+     */
+    int nearest(const ColumnView<double>& x, double value) const;
+
+private:
+    QVector<Segment> m_segments;
+};
+
+#endif // MONOTONICSEGMENTINDEX_H
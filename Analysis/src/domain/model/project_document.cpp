@@ -0,0 +1,34 @@
+#include "project_document.h"
+#include <QDebug>
+#include <QSet>
+
+QVector<ThermalCurve> orderParentFirst(const QMap<QString, ThermalCurve>& curves)
+{
+    QVector<ThermalCurve> ordered;
+    ordered.reserve(curves.size());
+    QSet<QString> added;
+
+    // 逐轮加入父曲线已加入（或不存在）的曲线；某轮没有进展说明存在循环引用
+    bool progressed = true;
+    while (ordered.size() < curves.size() && progressed) {
+        progressed = false;
+        for (const ThermalCurve& curve : curves) {
+            if (added.contains(curve.id())) {
+                continue;
+            }
+            const QString parentId = curve.parentId();
+            if (parentId.isEmpty() || !curves.contains(parentId) || added.contains(parentId)) {
+                ordered.append(curve);
+                added.insert(curve.id());
+                progressed = true;
+            }
+        }
+    }
+    for (const ThermalCurve& curve : curves) {
+        if (!added.contains(curve.id())) {
+            qWarning() << "orderParentFirst - 曲线父子关系存在循环:" << curve.id();
+            ordered.append(curve);
+        }
+    }
+    return ordered;
+}
@@ -0,0 +1,60 @@
+#ifndef PROJECTDOCUMENT_H
+#define PROJECTDOCUMENT_H
+
+#include "thermal_curve.h"
+#include <QColor>
+#include <QList>
+#include <QMap>
+#include <QPointF>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+/**
+ * @brief 曲线上的一组标注点（算法生成的特征点）
+ */
+struct CurveMarkerSet {
+    QString curveId;
+    QList<QPointF> points; // 数据坐标（温度, 值）
+    QColor color = Qt::red;
+    double size = 12.0;
+};
+
+/**
+ * @brief 锚定在曲线数据坐标上的浮动标签（如峰面积结果）
+ */
+struct CurveLabelAnnotation {
+    QString curveId;
+    QString text;
+    QPointF anchor; // 数据坐标（温度, 值）
+};
+
+/**
+ * @brief 项目中随曲线保存的视图状态
+ */
+struct ProjectViewState {
+    QStringList hiddenCurveIds;           // 未勾选（不绘制）的曲线
+    QVector<CurveMarkerSet> markers;      // 各曲线的标注点
+    QVector<CurveLabelAnnotation> labels; // 数据锚定的浮动标签
+};
+
+/**
+ * @brief 一个完整的项目：曲线图、活动曲线与视图状态
+ *
+ * curves 按父曲线在前、子曲线在后的顺序排列，按此顺序逐条添加即可重建父子关系。
+ */
+struct ProjectDocument {
+    QVector<ThermalCurve> curves;
+    QString activeCurveId;
+    ProjectViewState viewState;
+};
+
+/**
+ * @brief 按父曲线在前、子曲线在后的顺序排列曲线
+ * @param curves 曲线ID到曲线的映射
+ *
+ * 父曲线不在 curves 中的曲线视为顶层曲线；父子关系存在循环时，剩余曲线按原顺序追加。
+ */
+QVector<ThermalCurve> orderParentFirst(const QMap<QString, ThermalCurve>& curves);
+
+#endif // PROJECTDOCUMENT_H
@@ -33,9 +33,9 @@ InstrumentType ThermalCurve::instrumentType() const { return m_instrumentType; }
 
 SignalType ThermalCurve::signalType() const { return m_signalType; }
 
-const QVector<ThermalDataPoint>& ThermalCurve::getRawData() const { return m_rawData; }
+const ThermalDataSeries& ThermalCurve::getRawData() const { return m_rawData; }
 
-const QVector<ThermalDataPoint>& ThermalCurve::getProcessedData() const { return m_processedData; }
+const ThermalDataSeries& ThermalCurve::getProcessedData() const { return m_processedData; }
 
 const CurveMetadata& ThermalCurve::getMetadata() const { return m_metadata; }
 
@@ -49,6 +49,8 @@ bool ThermalCurve::isStronglyBound() const { return m_isStronglyBound; }
 
 bool ThermalCurve::isMainCurve() const { return m_isMainCurve; }
 
+void ThermalCurve::setId(const QString& id) { m_id = id; }
+
 void ThermalCurve::setName(const QString& name) { m_name = name; }
 
 void ThermalCurve::setProjectName(const QString& projectName) { m_projectName = projectName; }
@@ -57,13 +59,26 @@ void ThermalCurve::setInstrumentType(InstrumentType type) { m_instrumentType = t
 
 void ThermalCurve::setSignalType(SignalType type) { m_signalType = type; }
 
-void ThermalCurve::setRawData(const QVector<ThermalDataPoint>& data)
+void ThermalCurve::setRawData(const ThermalDataSeries& data)
 {
     m_rawData = data;
-    m_processedData = data; // 初始状态下，处理后的数据是原始数据的副本
+    m_processedData = data; // 初始状态下，处理后的数据与原始数据共享同一缓冲区（写时复制）
 }
 
-void ThermalCurve::setProcessedData(const QVector<ThermalDataPoint>& data) { m_processedData = data; }
+void ThermalCurve::setProcessedData(const ThermalDataSeries& data) { m_processedData = data; }
+
+void ThermalCurve::appendRawData(const ThermalDataSeries& samples)
+{
+    // 先释放处理后数据对共享缓冲区的引用，追加时就不必分离出整份副本
+    const bool shared = m_processedData.isSharedWith(m_rawData);
+    if (shared) {
+        m_processedData = ThermalDataSeries();
+    }
+    m_rawData.append(samples);
+    if (shared) {
+        m_processedData = m_rawData;
+    }
+}
 
 void ThermalCurve::setMetadata(const CurveMetadata& metadata) { m_metadata = metadata; }
 
@@ -1,7 +1,7 @@
 #ifndef THERMALCURVE_H
 #define THERMALCURVE_H
 
-#include "thermal_data_point.h"
+#include "thermal_data_series.h"
 #include <QString>
 #include <QVariantMap>
 #include <QVector>
@@ -65,6 +65,9 @@ enum class PlotStyle {
  *
  * 它持有从文件加载的原始、不可变的数据，以及一份可由算法处理的数据副本。
  * 这样可以方便地实现撤销/重做和重置功能。
+ *
+ * 采样数据以 ThermalDataSeries 句柄保存（共享缓冲区 + 写时复制），
+ * 因此复制 ThermalCurve（撤销命令、算法上下文快照）不会复制采样数据。
  */
 class ThermalCurve {
 public:
@@ -77,8 +80,8 @@ public:
     QString projectName() const;
     InstrumentType instrumentType() const;
     SignalType signalType() const;
-    const QVector<ThermalDataPoint>& getRawData() const;
-    const QVector<ThermalDataPoint>& getProcessedData() const;
+    const ThermalDataSeries& getRawData() const;
+    const ThermalDataSeries& getProcessedData() const;
     const CurveMetadata& getMetadata() const;
     QString parentId() const;
     PlotStyle plotStyle() const;
@@ -87,12 +90,24 @@ public:
     bool isMainCurve() const;
 
     // --- 设置器 ---
+    /**
+     * @brief 更换曲线ID（仅用于尚未加入 CurveManager 的副本，如复用缓存的算法结果）
+     */
+    void setId(const QString& id);
     void setName(const QString& name);
     void setProjectName(const QString& projectName);
     void setInstrumentType(InstrumentType type);
     void setSignalType(SignalType type);
-    void setRawData(const QVector<ThermalDataPoint>& data);
-    void setProcessedData(const QVector<ThermalDataPoint>& data);
+    void setRawData(const ThermalDataSeries& data);
+    void setProcessedData(const ThermalDataSeries& data);
+
+    /**
+     * @brief 在原始数据末尾追加采样（跟随仍在写入的文件、实时采集）
+     *
+     * 处理后数据与原始数据共享缓冲区时追加后继续共享，不复制已有采样；
+     * 不共享时（处理后数据来自算法）只追加原始数据。
+     */
+    void appendRawData(const ThermalDataSeries& samples);
     void setMetadata(const CurveMetadata& metadata);
     void setParentId(const QString& parentId);
     void setPlotStyle(PlotStyle style);
@@ -130,8 +145,8 @@ private:
     bool m_isMainCurve = false;              // 判断是否是主曲线（从文件导入的数据源）
     PlotStyle m_plotStyle = PlotStyle::Line; // 默认折线
 
-    QVector<ThermalDataPoint> m_rawData;       // 原始数据 (只读)
-    QVector<ThermalDataPoint> m_processedData; // 处理后数据
+    ThermalDataSeries m_rawData;       // 原始数据 (只读，列式存储)
+    ThermalDataSeries m_processedData; // 处理后数据 (列式存储)
 
     CurveMetadata m_metadata; // 实验参数
 };
@@ -0,0 +1,379 @@
+#include "thermal_data_series.h"
+#include "cumulative_integral.h"
+#include "min_max_pyramid.h"
+#include "monotonic_segment_index.h"
+#include <QDebug>
+#include <QMutexLocker>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+namespace {
+
+/**
+ * @brief 生成全局唯一的缓冲区版本号（线程安全）
+ */
+quint64 nextRevision()
+{
+    static std::atomic<quint64> counter{0};
+    return ++counter;
+}
+
+/**
+ * @brief 所有空序列共享的缓冲区，避免默认构造时分配内存
+ */
+const QSharedDataPointer<ThermalDataSeriesData>& sharedEmptyData()
+{
+    static const QSharedDataPointer<ThermalDataSeriesData> empty(new ThermalDataSeriesData());
+    return empty;
+}
+
+QVector<double> copyColumn(const double* data, int size)
+{
+    QVector<double> column(size);
+    std::copy(data, data + size, column.begin());
+    return column;
+}
+
+} // namespace
+
+// ==================== ThermalDataSeriesData ====================
+
+ThermalDataSeriesData::ThermalDataSeriesData()
+    : revision(nextRevision())
+{
+}
+
+ThermalDataSeriesData::ThermalDataSeriesData(const ThermalDataSeriesData& other)
+    : QSharedData(other)
+    , temperatures(other.temperatures)
+    , times(other.times)
+    , values(other.values)
+    , external(other.external)
+    , metadata(other.metadata)
+    , revision(nextRevision())
+{
+    // 分离意味着即将写入，外部存储的列在此复制到私有缓冲区
+    materialize();
+}
+
+void ThermalDataSeriesData::materialize()
+{
+    if (!external) {
+        return;
+    }
+    temperatures = copyColumn(external->temperatures(), external->size());
+    times = copyColumn(external->times(), external->size());
+    values = copyColumn(external->values(), external->size());
+    external.reset();
+}
+
+// ==================== ThermalDataSeries ====================
+
+ThermalDataSeries::ThermalDataSeries()
+    : d(sharedEmptyData())
+{
+}
+
+ThermalDataSeries::ThermalDataSeries(const QVector<ThermalDataPoint>& points)
+    : d(new ThermalDataSeriesData())
+{
+    reserve(points.size());
+    for (const ThermalDataPoint& point : points) {
+        append(point);
+    }
+}
+
+ThermalDataSeries ThermalDataSeries::fromColumns(QVector<double> temperatures, QVector<double> times, QVector<double> values)
+{
+    ThermalDataSeries series;
+    if (temperatures.size() != values.size() || times.size() != values.size()) {
+        qWarning() << "ThermalDataSeries::fromColumns - 列长度不一致:" << temperatures.size() << times.size()
+                   << values.size();
+        return series;
+    }
+
+    series.d = new ThermalDataSeriesData();
+    series.d->temperatures = std::move(temperatures);
+    series.d->times = std::move(times);
+    series.d->values = std::move(values);
+    return series;
+}
+
+ThermalDataSeries ThermalDataSeries::fromExternal(QSharedPointer<const ExternalColumnStorage> storage)
+{
+    ThermalDataSeries series;
+    if (!storage || storage->size() == 0) {
+        return series;
+    }
+
+    series.d = new ThermalDataSeriesData();
+    series.d->external = std::move(storage);
+    return series;
+}
+
+QVector<double> ThermalDataSeries::temperatureColumn() const
+{
+    return d->external ? copyColumn(d->external->temperatures(), d->count()) : d->temperatures;
+}
+
+QVector<double> ThermalDataSeries::timeColumn() const
+{
+    return d->external ? copyColumn(d->external->times(), d->count()) : d->times;
+}
+
+QVector<double> ThermalDataSeries::valueColumn() const
+{
+    return d->external ? copyColumn(d->external->values(), d->count()) : d->values;
+}
+
+ThermalDataSeries ThermalDataSeries::withValues(QVector<double> values) const
+{
+    if (values.size() != size()) {
+        qWarning() << "ThermalDataSeries::withValues - 列长度不一致:" << values.size() << size();
+        return ThermalDataSeries();
+    }
+
+    // 分离出的新缓冲区只复制列句柄（QVector 隐式共享），温度/时间列仍与原序列共用内存
+    ThermalDataSeries series(*this);
+    series.d->values = std::move(values);
+    return series;
+}
+
+void ThermalDataSeries::reserve(int size)
+{
+    detachColumns();
+    d->temperatures.reserve(size);
+    d->times.reserve(size);
+    d->values.reserve(size);
+}
+
+void ThermalDataSeries::clear()
+{
+    d = sharedEmptyData();
+}
+
+ThermalDataPoint ThermalDataSeries::at(int i) const
+{
+    ThermalDataPoint point;
+    point.temperature = d->temperatureData()[i];
+    point.time = d->timeData()[i];
+    point.value = d->valueData()[i];
+    if (!d->metadata.isEmpty()) {
+        point.metadata = d->metadata.value(i);
+    }
+    return point;
+}
+
+void ThermalDataSeries::append(double temperature, double time, double value)
+{
+    detachColumns();
+    d->temperatures.append(temperature);
+    d->times.append(time);
+    d->values.append(value);
+    touch();
+}
+
+void ThermalDataSeries::append(const ThermalDataPoint& point)
+{
+    if (!point.metadata.isEmpty()) {
+        d->metadata.insert(size(), point.metadata);
+    }
+    append(point.temperature, point.time, point.value);
+}
+
+void ThermalDataSeries::append(const ThermalDataSeries& other)
+{
+    if (other.isEmpty()) {
+        return;
+    }
+
+    // 先持有 other 的引用：追加自身时分离不会使源数据失效
+    const ThermalDataSeries source = other;
+    const int offset = size();
+
+    // 末尾追加不改变前缀，已构建的金字塔只需增量更新（const 访问，不触发分离）
+    QSharedPointer<const MinMaxPyramid> pyramid;
+    {
+        QMutexLocker locker(&d.constData()->cacheMutex);
+        pyramid = d.constData()->valuePyramid;
+    }
+
+    const int count = source.size();
+    detachColumns();
+    d->temperatures.resize(offset + count);
+    d->times.resize(offset + count);
+    d->values.resize(offset + count);
+    std::memcpy(d->temperatures.data() + offset, source.temperatures().data(), size_t(count) * sizeof(double));
+    std::memcpy(d->times.data() + offset, source.times().data(), size_t(count) * sizeof(double));
+    std::memcpy(d->values.data() + offset, source.values().data(), size_t(count) * sizeof(double));
+    for (auto it = source.d->metadata.constBegin(); it != source.d->metadata.constEnd(); ++it) {
+        d->metadata.insert(offset + it.key(), it.value());
+    }
+    touch();
+
+    if (pyramid) {
+        // 先释放旧的共享指针，缓存已清空时各层数组只剩 extended 持有，可原地扩展
+        MinMaxPyramid extended = *pyramid;
+        pyramid.reset();
+        extended.append(values());
+        d->valuePyramid = QSharedPointer<const MinMaxPyramid>::create(std::move(extended));
+    }
+}
+
+void ThermalDataSeries::setValue(int i, double value)
+{
+    detachColumns();
+    d->values[i] = value;
+    touch();
+}
+
+void ThermalDataSeries::setMetadataAt(int i, const QVariantMap& metadata)
+{
+    if (metadata.isEmpty()) {
+        d->metadata.remove(i);
+    } else {
+        d->metadata.insert(i, metadata);
+    }
+    touch();
+}
+
+QSharedPointer<const MonotonicSegmentIndex> ThermalDataSeries::xSegments(bool useTimeAxis) const
+{
+    QMutexLocker locker(&d->cacheMutex);
+    QSharedPointer<const MonotonicSegmentIndex>& cached = useTimeAxis ? d->timeSegments : d->temperatureSegments;
+    if (!cached) {
+        cached = QSharedPointer<const MonotonicSegmentIndex>::create(xColumn(useTimeAxis));
+    }
+    return cached;
+}
+
+QSharedPointer<const CumulativeIntegral> ThermalDataSeries::cumulativeIntegral(bool useTimeAxis) const
+{
+    QMutexLocker locker(&d->cacheMutex);
+    QSharedPointer<const CumulativeIntegral>& cached = useTimeAxis ? d->timeIntegral : d->temperatureIntegral;
+    if (!cached) {
+        cached = QSharedPointer<const CumulativeIntegral>::create(xColumn(useTimeAxis), values());
+    }
+    return cached;
+}
+
+QSharedPointer<const MinMaxPyramid> ThermalDataSeries::valuePyramid() const
+{
+    QMutexLocker locker(&d->cacheMutex);
+    if (!d->valuePyramid) {
+        d->valuePyramid = QSharedPointer<const MinMaxPyramid>::create(values());
+    }
+    return d->valuePyramid;
+}
+
+double ThermalDataSeries::integrate(double lo, double hi, bool useTimeAxis) const
+{
+    const QSharedPointer<const MonotonicSegmentIndex> segments = xSegments(useTimeAxis);
+    const QSharedPointer<const CumulativeIntegral> integral = cumulativeIntegral(useTimeAxis);
+    return integral->integrate(xColumn(useTimeAxis), values(), *segments, lo, hi);
+}
+
+bool ThermalDataSeries::valueRange(double lo, double hi, bool useTimeAxis, double& minValue, double& maxValue) const
+{
+    const ColumnView<double> xs = xColumn(useTimeAxis);
+    const ColumnView<double> ys = values();
+    if (xs.size() == 1) {
+        if (xs[0] < lo || xs[0] > hi) {
+            return false;
+        }
+        minValue = maxValue = ys[0];
+        return true;
+    }
+
+    const QSharedPointer<const MonotonicSegmentIndex> segments = xSegments(useTimeAxis);
+    const QSharedPointer<const MinMaxPyramid> pyramid = valuePyramid();
+    bool found = false;
+    const auto takeRange = [&](int first, int last) {
+        int minIndex = 0;
+        int maxIndex = 0;
+        if (!pyramid->rangeMinMax(ys, first, last, minIndex, maxIndex)) {
+            return;
+        }
+        if (!found) {
+            minValue = ys[minIndex];
+            maxValue = ys[maxIndex];
+            found = true;
+        } else {
+            minValue = qMin(minValue, ys[minIndex]);
+            maxValue = qMax(maxValue, ys[maxIndex]);
+        }
+    };
+
+    // 采样下标相接的可见区间合并后再查金字塔：抖动造成的大量细碎单调段只需一次 O(log N) 查询
+    int spanFirst = -1;
+    int spanLast = -1;
+    for (const MonotonicSegmentIndex::Segment& segment : segments->segments()) {
+        int first = 0;
+        int last = 0;
+        if (!MonotonicSegmentIndex::bracket(xs, segment, lo, hi, first, last)) {
+            continue;
+        }
+        // bracket() 含两端紧邻范围外的点，段内单调，只需从两端剔除
+        while (first <= last && (xs[first] < lo || xs[first] > hi)) {
+            ++first;
+        }
+        while (last >= first && (xs[last] < lo || xs[last] > hi)) {
+            --last;
+        }
+        if (first > last) {
+            continue;
+        }
+        if (spanFirst >= 0 && first <= spanLast + 1) {
+            spanLast = qMax(spanLast, last);
+            continue;
+        }
+        if (spanFirst >= 0) {
+            takeRange(spanFirst, spanLast);
+        }
+        spanFirst = first;
+        spanLast = last;
+    }
+    if (spanFirst >= 0) {
+        takeRange(spanFirst, spanLast);
+    }
+    return found;
+}
+
+int ThermalDataSeries::nearestIndex(double x, bool useTimeAxis) const
+{
+    if (isEmpty()) {
+        return -1;
+    }
+    return xSegments(useTimeAxis)->nearest(xColumn(useTimeAxis), x);
+}
+
+QVector<ThermalDataPoint> ThermalDataSeries::toPoints() const
+{
+    QVector<ThermalDataPoint> points;
+    points.reserve(size());
+    for (int i = 0; i < size(); ++i) {
+        points.append(at(i));
+    }
+    return points;
+}
+
+void ThermalDataSeries::touch()
+{
+    d->revision = nextRevision();
+
+    // 分离后的缓冲区只被当前句柄持有，无需加锁
+    if (d->temperatureSegments || d->timeSegments || d->temperatureIntegral || d->timeIntegral || d->valuePyramid) {
+        d->temperatureSegments.reset();
+        d->timeSegments.reset();
+        d->temperatureIntegral.reset();
+        d->timeIntegral.reset();
+        d->valuePyramid.reset();
+    }
+}
+
+void ThermalDataSeries::detachColumns()
+{
+    // 非 const 访问会先分离共享缓冲区（复制构造时已复制外部列），未共享时在此复制
+    d->materialize();
+}
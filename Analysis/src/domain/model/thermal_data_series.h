@@ -0,0 +1,356 @@
+#ifndef THERMALDATASERIES_H
+#define THERMALDATASERIES_H
+
+#include "thermal_data_point.h"
+#include <QHash>
+#include <QMetaType>
+#include <QMutex>
+#include <QSharedData>
+#include <QSharedDataPointer>
+#include <QSharedPointer>
+#include <QVariantMap>
+#include <QVector>
+#include <iterator>
+
+class CumulativeIntegral;
+class MinMaxPyramid;
+class MonotonicSegmentIndex;
+
+/**
+ * @brief 只读的连续列视图（类似 std::span<const T>）
+ *
+ * 不持有数据，仅在所属 ThermalDataSeries（或共享同一缓冲区的句柄）存活且未被修改期间有效。
+ * 算法和图表代码通过它直接遍历连续的 double 数组，便于编译器向量化。
+ */
+template <typename T>
+class ColumnView {
+public:
+    ColumnView() = default;
+    ColumnView(const T* data, int size) : m_data(data), m_size(size) {}
+
+    const T* data() const { return m_data; }
+    int size() const { return m_size; }
+    bool isEmpty() const { return m_size == 0; }
+
+    const T& operator[](int i) const { return m_data[i]; }
+    const T& first() const { return m_data[0]; }
+    const T& last() const { return m_data[m_size - 1]; }
+
+    const T* begin() const { return m_data; }
+    const T* end() const { return m_data + m_size; }
+
+    /**
+     * @brief 返回 [offset, offset + count) 的子视图
+     */
+    ColumnView mid(int offset, int count) const { return ColumnView(m_data + offset, count); }
+
+private:
+    const T* m_data = nullptr;
+    int m_size = 0;
+};
+
+/**
+ * @brief 外部只读列存储（例如内存映射的文件）
+ *
+ * ThermalDataSeries 可直接引用其中的三列而不复制；派生类负责在自身析构前
+ * 保证列地址有效（如保持文件映射），并通过 setColumns() 提供列地址。
+ * 列地址必须按 double 对齐。
+ */
+class ExternalColumnStorage {
+public:
+    virtual ~ExternalColumnStorage() = default;
+
+    const double* temperatures() const { return m_temperatures; }
+    const double* times() const { return m_times; }
+    const double* values() const { return m_values; }
+    int size() const { return m_size; }
+
+protected:
+    void setColumns(const double* temperatures, const double* times, const double* values, int size)
+    {
+        m_temperatures = temperatures;
+        m_times = times;
+        m_values = values;
+        m_size = size;
+    }
+
+private:
+    const double* m_temperatures = nullptr;
+    const double* m_times = nullptr;
+    const double* m_values = nullptr;
+    int m_size = 0;
+};
+
+/**
+ * @brief ThermalDataSeries 的共享采样缓冲区（内部使用）
+ *
+ * 一个缓冲区可被多个 ThermalDataSeries 句柄共享，写入前由 QSharedDataPointer 自动分离。
+ * 列数据保存在三个 QVector 中，或引用外部只读存储（external 非空时三个 QVector 为空）；
+ * 写入或分离时外部存储的列会被复制到 QVector 中。
+ */
+class ThermalDataSeriesData : public QSharedData {
+public:
+    ThermalDataSeriesData();
+    ThermalDataSeriesData(const ThermalDataSeriesData& other);
+
+    int count() const { return external ? external->size() : values.size(); }
+    const double* temperatureData() const { return external ? external->temperatures() : temperatures.constData(); }
+    const double* timeData() const { return external ? external->times() : times.constData(); }
+    const double* valueData() const { return external ? external->values() : values.constData(); }
+
+    /**
+     * @brief 将外部存储的列复制到 QVector 中并释放外部存储（写入前调用）
+     */
+    void materialize();
+
+    QVector<double> temperatures;         // 温度列
+    QVector<double> times;                // 时间列
+    QVector<double> values;               // 测量值列
+    QSharedPointer<const ExternalColumnStorage> external; // 外部只读列存储（可选）
+    QHash<int, QVariantMap> metadata;     // 稀疏逐点元数据（仅非空项）
+    quint64 revision;                     // 内容版本号（全局唯一，内容变化时更新）
+
+    // 派生索引缓存（按需构建；写入时清空，复制缓冲区时不复制）
+    mutable QMutex cacheMutex;
+    mutable QSharedPointer<const MonotonicSegmentIndex> temperatureSegments;
+    mutable QSharedPointer<const MonotonicSegmentIndex> timeSegments;
+    mutable QSharedPointer<const CumulativeIntegral> temperatureIntegral;
+    mutable QSharedPointer<const CumulativeIntegral> timeIntegral;
+    mutable QSharedPointer<const MinMaxPyramid> valuePyramid;
+};
+
+/**
+ * @brief ThermalDataSeries 以列式（Structure-of-Arrays）存储热分析曲线的采样数据。
+ *
+ * 温度、时间、测量值分别保存在三个连续的 double 数组中，
+ * 逐点元数据稀疏地存放在独立的哈希表中（绝大多数点没有元数据）。
+ *
+ * 与 QVector<ThermalDataPoint> 相比：
+ * - 每个采样点只占 24 字节，不再携带 QVariantMap 头
+ * - 逐点循环只访问需要的列，可被编译器向量化
+ *
+ * 为兼容逐点访问的旧代码，仍提供 at()/operator[] 和只读迭代器，
+ * 它们按值返回组装好的 ThermalDataPoint。
+ *
+ * 共享语义：ThermalDataSeries 是指向不可变缓冲区的轻量句柄（写时复制）。
+ * 复制句柄只增加一次引用计数，原始/处理后数据、撤销命令、算法上下文快照
+ * 因此可以共享同一份采样数据；只有写入方法会分离出私有副本。
+ */
+class ThermalDataSeries {
+public:
+    /**
+     * @brief 逐点只读迭代器（按值返回 ThermalDataPoint）
+     */
+    class const_iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = ThermalDataPoint;
+        using difference_type = int;
+        using pointer = void;
+        using reference = ThermalDataPoint;
+
+        const_iterator() = default;
+        const_iterator(const ThermalDataSeries* series, int index) : m_series(series), m_index(index) {}
+
+        ThermalDataPoint operator*() const { return m_series->at(m_index); }
+        ThermalDataPoint operator[](int n) const { return m_series->at(m_index + n); }
+
+        const_iterator& operator++() { ++m_index; return *this; }
+        const_iterator operator++(int) { const_iterator tmp = *this; ++m_index; return tmp; }
+        const_iterator& operator--() { --m_index; return *this; }
+        const_iterator operator--(int) { const_iterator tmp = *this; --m_index; return tmp; }
+        const_iterator& operator+=(int n) { m_index += n; return *this; }
+        const_iterator& operator-=(int n) { m_index -= n; return *this; }
+        const_iterator operator+(int n) const { return const_iterator(m_series, m_index + n); }
+        const_iterator operator-(int n) const { return const_iterator(m_series, m_index - n); }
+        int operator-(const const_iterator& other) const { return m_index - other.m_index; }
+
+        bool operator==(const const_iterator& other) const { return m_index == other.m_index; }
+        bool operator!=(const const_iterator& other) const { return m_index != other.m_index; }
+        bool operator<(const const_iterator& other) const { return m_index < other.m_index; }
+
+        int index() const { return m_index; }
+
+    private:
+        const ThermalDataSeries* m_series = nullptr;
+        int m_index = 0;
+    };
+
+    ThermalDataSeries();
+
+    /**
+     * @brief 从逐点数组构造（兼容旧接口，会拆分为列）
+     */
+    explicit ThermalDataSeries(const QVector<ThermalDataPoint>& points);
+
+    /**
+     * @brief 直接由三列数据构造（零拷贝移动，三列长度必须一致）
+     */
+    static ThermalDataSeries fromColumns(QVector<double> temperatures, QVector<double> times, QVector<double> values);
+
+    /**
+     * @brief 引用外部只读存储中的三列（零拷贝，如内存映射的 .tcurve 文件）
+     *
+     * 序列及其所有共享句柄持有 storage 的引用；首次写入时才把列复制到内存中。
+     */
+    static ThermalDataSeries fromExternal(QSharedPointer<const ExternalColumnStorage> storage);
+
+    // --- 容量 ---
+    int size() const { return d->count(); }
+    bool isEmpty() const { return d->count() == 0; }
+    void reserve(int size);
+    void clear();
+
+    // --- 共享状态 ---
+    /**
+     * @brief 内容版本号
+     *
+     * 每个缓冲区在创建或被写入时获得新的全局唯一版本号，
+     * 共享同一缓冲区的句柄版本号相同，可作为派生缓存的失效键。
+     */
+    quint64 revision() const { return d->revision; }
+
+    /**
+     * @brief 是否与另一句柄共享同一缓冲区
+     */
+    bool isSharedWith(const ThermalDataSeries& other) const { return d == other.d; }
+
+    /**
+     * @brief 采样数据是否直接引用外部存储（尚未复制到内存）
+     */
+    bool isExternal() const { return !d->external.isNull(); }
+
+    // --- 列视图 ---
+    ColumnView<double> temperatures() const { return ColumnView<double>(d->temperatureData(), d->count()); }
+    ColumnView<double> times() const { return ColumnView<double>(d->timeData(), d->count()); }
+    ColumnView<double> values() const { return ColumnView<double>(d->valueData(), d->count()); }
+
+    /**
+     * @brief 按横轴模式返回 X 列
+     * @param useTimeAxis true=时间列，false=温度列
+     */
+    ColumnView<double> xColumn(bool useTimeAxis) const { return useTimeAxis ? times() : temperatures(); }
+
+    /**
+     * @brief X 列的单调段索引（首次调用时构建，之后在同一版本内复用）
+     *
+     * 缓存挂在共享缓冲区上，所有共享该缓冲区的句柄（包括工作线程中的副本）共用一份，线程安全。
+     * @param useTimeAxis true=时间列，false=温度列
+     */
+    QSharedPointer<const MonotonicSegmentIndex> xSegments(bool useTimeAxis) const;
+
+    /**
+     * @brief 以 X 列为横轴的累积梯形积分（首次调用时构建，之后在同一版本内复用）
+     * @param useTimeAxis true=时间列，false=温度列
+     */
+    QSharedPointer<const CumulativeIntegral> cumulativeIntegral(bool useTimeAxis) const;
+
+    /**
+     * @brief 测量值列的最小/最大值金字塔（首次调用时构建，之后在同一版本内复用）
+     *
+     * 按采样下标分块，与横轴模式无关。已构建过时，append(const ThermalDataSeries&) 会增量更新而不是丢弃重建。
+     */
+    QSharedPointer<const MinMaxPyramid> valuePyramid() const;
+
+    /**
+     * @brief 计算 X 落在 [lo, hi] 内部分的面积 ∫ value dX（端点处线性插值）
+     *
+     * 基于缓存的前缀积分，每次查询 O(log N)，适合拖动过程中反复求面积。
+     * @param lo 区间下界
+     * @param hi 区间上界
+     * @param useTimeAxis true=时间列，false=温度列
+     */
+    double integrate(double lo, double hi, bool useTimeAxis = false) const;
+
+    /**
+     * @brief 求 X 落在 [lo, hi] 内的采样点的测量值范围
+     *
+     * 各单调段内二分定位下标区间，再由缓存的最小/最大值金字塔求极值，每次查询 O(log N)，
+     * 适合缩放、平移后反复自适应 Y 轴。
+     * @param lo 区间下界
+     * @param hi 区间上界
+     * @param useTimeAxis true=时间列，false=温度列
+     * @param minValue 输出：最小测量值
+     * @param maxValue 输出：最大测量值
+     * @return 区间内没有采样点时返回 false（输出参数不变）
+     */
+    bool valueRange(double lo, double hi, bool useTimeAxis, double& minValue, double& maxValue) const;
+
+    /**
+     * @brief X 列中最接近 x 的采样点下标（基于缓存的单调段索引二分查找，O(段数 · log N)）
+     *
+     * 用于鼠标悬停、拖动测量工具时吸附到曲线上的采样点。
+     * @param useTimeAxis true=时间列，false=温度列
+     * @return 序列为空时返回 -1
+     */
+    int nearestIndex(double x, bool useTimeAxis) const;
+
+    /**
+     * @brief 底层列容器（隐式共享，复制开销为常数；引用外部存储时返回复制的列）
+     */
+    QVector<double> temperatureColumn() const;
+    QVector<double> timeColumn() const;
+    QVector<double> valueColumn() const;
+
+    /**
+     * @brief 返回仅替换测量值列的新序列
+     *
+     * 温度列、时间列和元数据与当前序列共享，适用于只改变 Y 值的算法（积分、滤波、基线）。
+     * @param values 新的测量值列，长度必须与当前序列一致
+     */
+    ThermalDataSeries withValues(QVector<double> values) const;
+
+    // --- 逐点访问（兼容层） ---
+    double temperatureAt(int i) const { return d->temperatureData()[i]; }
+    double timeAt(int i) const { return d->timeData()[i]; }
+    double valueAt(int i) const { return d->valueData()[i]; }
+
+    ThermalDataPoint at(int i) const;
+    ThermalDataPoint operator[](int i) const { return at(i); }
+    ThermalDataPoint first() const { return at(0); }
+    ThermalDataPoint last() const { return at(size() - 1); }
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, size()); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    // --- 写入（若缓冲区被共享，先分离出私有副本） ---
+    void append(double temperature, double time, double value);
+    void append(const ThermalDataPoint& point);
+
+    /**
+     * @brief 在末尾追加另一序列的全部采样（含逐点元数据）
+     *
+     * 缓冲区未被共享时只复制追加的部分（QVector 按几何级数扩容，逐批追加的均摊开销为 O(追加点数)）。
+     */
+    void append(const ThermalDataSeries& other);
+    void setValue(int i, double value);
+
+    // --- 稀疏元数据 ---
+    bool hasMetadata() const { return !d->metadata.isEmpty(); }
+    QVariantMap metadataAt(int i) const { return d->metadata.value(i); }
+    void setMetadataAt(int i, const QVariantMap& metadata);
+
+    /**
+     * @brief 组装为逐点数组（仅用于需要 ThermalDataPoint 集合的旧接口）
+     */
+    QVector<ThermalDataPoint> toPoints() const;
+
+private:
+    /**
+     * @brief 写入后更新版本号并丢弃派生缓存（调用前 d 已由 QSharedDataPointer 分离）
+     */
+    void touch();
+
+    /**
+     * @brief 写入前分离缓冲区，并把外部存储的列复制到内存中
+     */
+    void detachColumns();
+
+    QSharedDataPointer<ThermalDataSeriesData> d; // 共享采样缓冲区
+};
+
+Q_DECLARE_METATYPE(ThermalDataSeries)
+
+#endif // THERMALDATASERIES_H
@@ -0,0 +1,95 @@
+#include "simulated_instrument.h"
+#include <QtMath>
+
+SimulatedInstrumentConfig SimulatedInstrumentConfig::defaults(InstrumentType instrument)
+{
+    SimulatedInstrumentConfig config;
+    config.instrument = instrument;
+
+    switch (instrument) {
+    case InstrumentType::TGA:
+        config.noiseLevel = 0.02;
+        config.steps = { { 110.0, 6.0, -4.0 }, { 320.0, 12.0, -38.0 }, { 560.0, 18.0, -22.0 } };
+        break;
+    case InstrumentType::DSC:
+        config.noiseLevel = 0.01;
+        config.peaks = { { 156.6, 2.5, -6.0 }, { 285.0, 9.0, 3.5 } };
+        break;
+    case InstrumentType::ARC:
+        config.heatingRate = 2.0;
+        config.noiseLevel = 0.005;
+        config.steps = { { 190.0, 8.0, 4.0 } };
+        config.peaks = { { 230.0, 3.0, 12.0 } };
+        break;
+    }
+    return config;
+}
+
+SimulatedInstrument::SimulatedInstrument(const SimulatedInstrumentConfig& config)
+    : m_config(config)
+    , m_random(config.seed)
+    , m_noise(0.0, config.noiseLevel > 0.0 ? config.noiseLevel : 1.0)
+{
+    if (m_config.sampleRateHz <= 0.0) {
+        m_config.sampleRateHz = 1.0;
+    }
+}
+
+QString SimulatedInstrument::signalName() const
+{
+    switch (m_config.instrument) {
+    case InstrumentType::TGA:
+        return QStringLiteral("质量");
+    case InstrumentType::DSC:
+        return QStringLiteral("热流");
+    case InstrumentType::ARC:
+        return QStringLiteral("压力");
+    }
+    return QString();
+}
+
+double SimulatedInstrument::baselineAt(double temperature) const
+{
+    const double delta = temperature - m_config.startTemperature;
+    switch (m_config.instrument) {
+    case InstrumentType::TGA:
+        return 100.0;
+    case InstrumentType::DSC:
+        return -0.2 + 0.0008 * delta;
+    case InstrumentType::ARC:
+        return qExp(delta / 120.0);
+    }
+    return 0.0;
+}
+
+double SimulatedInstrument::signalAt(double temperature) const
+{
+    double value = baselineAt(temperature);
+    for (const SimulatedPeak& peak : m_config.peaks) {
+        const double z = (temperature - peak.temperature) / qMax(peak.width, 1e-6);
+        value += peak.height * qExp(-0.5 * z * z);
+    }
+    for (const SimulatedStep& step : m_config.steps) {
+        const double z = (temperature - step.temperature) / qMax(step.width, 1e-6);
+        value += step.change / (1.0 + qExp(-z));
+    }
+    return value;
+}
+
+ThermalDataSeries SimulatedInstrument::generate(int count)
+{
+    QVector<double> temperatures(qMax(0, count));
+    QVector<double> times(temperatures.size());
+    QVector<double> values(temperatures.size());
+
+    const double heatingPerSecond = m_config.heatingRate / 60.0;
+    const bool noisy = m_config.noiseLevel > 0.0;
+    for (int i = 0; i < temperatures.size(); ++i, ++m_sampleIndex) {
+        const double time = double(m_sampleIndex) / m_config.sampleRateHz;
+        const double temperature = m_config.startTemperature + heatingPerSecond * time;
+        temperatures[i] = temperature;
+        times[i] = time;
+        values[i] = signalAt(temperature) + (noisy ? m_noise(m_random) : 0.0);
+    }
+    return ThermalDataSeries::fromColumns(std::move(temperatures), std::move(times), std::move(values));
+}
@@ -0,0 +1,92 @@
+#ifndef SIMULATEDINSTRUMENT_H
+#define SIMULATEDINSTRUMENT_H
+
+#include "domain/model/thermal_curve.h"
+#include <QString>
+#include <QVector>
+#include <random>
+
+/**
+ * @brief 模拟信号中的高斯峰（DSC 吸/放热峰、ARC 压力尖峰）
+ */
+struct SimulatedPeak {
+    double temperature = 0.0; // 峰温 (°C)
+    double width = 1.0;       // 标准差 (°C)
+    double height = 0.0;      // 峰高（信号单位，负值为吸热/向下）
+};
+
+/**
+ * @brief 模拟信号中的台阶（TGA 失重台阶、ARC 产气台阶）
+ */
+struct SimulatedStep {
+    double temperature = 0.0; // 台阶中点温度 (°C)
+    double width = 1.0;       // 台阶宽度（logistic 尺度, °C）
+    double change = 0.0;      // 台阶前后信号变化量（信号单位，负值为下降）
+};
+
+/**
+ * @brief 模拟仪器的信号参数
+ *
+ * 温度按恒定升温速率随时间上升；信号 = 仪器基线 + 各高斯峰 + 各台阶 + 高斯噪声：
+ * - TGA：基线 100%，台阶为失重（%）
+ * - DSC：随温度线性漂移的基线，峰为熔融/分解热流（mW）
+ * - ARC：随温度指数上升的蒸气压基线，台阶为产气、峰为失控放热时的压力尖峰（bar）
+ */
+struct SimulatedInstrumentConfig {
+    InstrumentType instrument = InstrumentType::TGA;
+    double sampleRateHz = 10.0;      // 采样率
+    double startTemperature = 30.0;  // 起始温度 (°C)
+    double heatingRate = 10.0;       // 升温速率 (K/min)
+    double noiseLevel = 0.01;        // 噪声标准差（信号单位）
+    quint32 seed = 1;                // 噪声随机种子（相同种子生成相同的数据）
+    QVector<SimulatedPeak> peaks;
+    QVector<SimulatedStep> steps;
+
+    /**
+     * @brief 各仪器类型的典型信号（TGA 三段失重、DSC 熔融吸热与分解放热、ARC 产气与失控）
+     */
+    static SimulatedInstrumentConfig defaults(InstrumentType instrument);
+};
+
+/**
+ * @brief SimulatedInstrument 按配置逐批生成模拟仪器采样，用于在没有硬件时开发与压测实时数据链路
+ *
+ * 生成的序列与文件读取器的结果格式一致（温度 °C、时间 s、信号），可直接追加到曲线。
+ * 不是线程安全的，由生成数据的线程独占使用。
+ */
+class SimulatedInstrument {
+public:
+    explicit SimulatedInstrument(const SimulatedInstrumentConfig& config);
+
+    /**
+     * @brief 生成接下来的 count 个采样
+     */
+    ThermalDataSeries generate(int count);
+
+    /**
+     * @brief 已生成的采样数
+     */
+    qint64 sampleCount() const { return m_sampleIndex; }
+
+    const SimulatedInstrumentConfig& config() const { return m_config; }
+
+    /**
+     * @brief 信号名称（用作曲线名称），如 "质量"、"热流"、"压力"
+     */
+    QString signalName() const;
+
+    /**
+     * @brief 不含噪声的信号值
+     */
+    double signalAt(double temperature) const;
+
+private:
+    double baselineAt(double temperature) const;
+
+    SimulatedInstrumentConfig m_config;
+    std::mt19937 m_random;
+    std::normal_distribution<double> m_noise;
+    qint64 m_sampleIndex = 0;
+};
+
+#endif // SIMULATEDINSTRUMENT_H
@@ -56,6 +56,11 @@ AlgorithmDescriptor BaselineCorrectionAlgorithm::descriptor() const
     return desc;
 }
 
+IThermalAlgorithm* BaselineCorrectionAlgorithm::clone() const
+{
+    return new BaselineCorrectionAlgorithm(*this);
+}
+
 // ==================== 曲线属性声明接口实现 ====================
 
 bool BaselineCorrectionAlgorithm::isAuxiliaryCurve() const
@@ -133,7 +138,7 @@ AlgorithmResult BaselineCorrectionAlgorithm::executeWithContext(AlgorithmContext
     }
 
     // 4. 获取输入数据
-    const QVector<ThermalDataPoint>& curveData = inputCurve.getProcessedData();
+    const ThermalDataSeries& curveData = inputCurve.getProcessedData();
     if (curveData.isEmpty()) {
         qWarning() << "BaselineCorrectionAlgorithm::executeWithContext - 曲线数据为空！";
         return AlgorithmResult::failure("baseline_correction", "曲线数据为空");
@@ -147,7 +152,7 @@ AlgorithmResult BaselineCorrectionAlgorithm::executeWithContext(AlgorithmContext
     qDebug() << "BaselineCorrectionAlgorithm::executeWithContext - 点1 =" << point1 << ", 点2 =" << point2;
 
     // 6. 执行核心算法逻辑（生成基线）
-    QVector<ThermalDataPoint> baseline = generateBaseline(curveData, point1, point2);
+    ThermalDataSeries baseline = generateBaseline(curveData, point1, point2);
 
     if (baseline.isEmpty()) {
         // 检查是否是用户取消导致的
@@ -196,13 +201,11 @@ AlgorithmResult BaselineCorrectionAlgorithm::executeWithContext(AlgorithmContext
     return result;
 }
 
-QVector<ThermalDataPoint> BaselineCorrectionAlgorithm::generateBaseline(
-    const QVector<ThermalDataPoint>& curveData, const QPointF& point1, const QPointF& point2) const
+ThermalDataSeries BaselineCorrectionAlgorithm::generateBaseline(
+    const ThermalDataSeries& curveData, const QPointF& point1, const QPointF& point2) const
 {
-    QVector<ThermalDataPoint> baseline;
-
     if (curveData.isEmpty()) {
-        return baseline;
+        return ThermalDataSeries();
     }
 
     // 确保 point1 的温度小于 point2
@@ -220,39 +223,36 @@ QVector<ThermalDataPoint> BaselineCorrectionAlgorithm::generateBaseline(
         slope = (value2 - value1) / (temp2 - temp1);
     }
 
-    // 为所有数据点生成基线值
-    baseline.reserve(curveData.size());
+    // 为所有数据点生成基线值（只生成数值列，温度/时间列与输入共享）
+    const ColumnView<double> temperatures = curveData.temperatures();
+    QVector<double> baselineValues(curveData.size());
 
     // 进度报告：计算总迭代次数
     const int totalPoints = curveData.size();
     int lastReportedProgress = 0;
     int processedPoints = 0;
 
-    for (const auto& point : curveData) {
+    for (int i = 0; i < totalPoints; ++i) {
         // 检查取消标志（每100次迭代）
         if (processedPoints % 100 == 0 && shouldCancel()) {
             qWarning() << "BaselineCorrectionAlgorithm: 用户取消执行";
-            return QVector<ThermalDataPoint>();  // 返回空向量
+            return ThermalDataSeries();  // 返回空序列
         }
 
-        ThermalDataPoint baselinePoint;
-        baselinePoint.temperature = point.temperature;
-        baselinePoint.time = point.time;
+        const double temperature = temperatures[i];
 
         // 线性插值计算基线值
-        if (point.temperature < temp1) {
+        if (temperature < temp1) {
             // 温度低于起点，使用起点值
-            baselinePoint.value = value1;
-        } else if (point.temperature > temp2) {
+            baselineValues[i] = value1;
+        } else if (temperature > temp2) {
             // 温度高于终点，使用终点值
-            baselinePoint.value = value2;
+            baselineValues[i] = value2;
         } else {
             // 温度在范围内，线性插值
-            baselinePoint.value = value1 + slope * (point.temperature - temp1);
+            baselineValues[i] = value1 + slope * (temperature - temp1);
         }
 
-        baseline.append(baselinePoint);
-
         // 进度报告（每10%）
         processedPoints++;
         int currentProgress = (processedPoints * 100) / totalPoints;
@@ -265,27 +265,28 @@ QVector<ThermalDataPoint> BaselineCorrectionAlgorithm::generateBaseline(
     // 最终进度报告
     reportProgress(100, "基线生成完成");
 
-    return baseline;
+    return ThermalDataSeries::fromColumns(curveData.temperatureColumn(), curveData.timeColumn(), std::move(baselineValues));
 }
 
 ThermalDataPoint
-BaselineCorrectionAlgorithm::findNearestPoint(const QVector<ThermalDataPoint>& curveData, double temperature) const
+BaselineCorrectionAlgorithm::findNearestPoint(const ThermalDataSeries& curveData, double temperature) const
 {
     if (curveData.isEmpty()) {
         return ThermalDataPoint();
     }
 
     // 找到最接近指定温度的点
+    const ColumnView<double> temperatures = curveData.temperatures();
     int nearestIdx = 0;
-    double minDist = qAbs(curveData[0].temperature - temperature);
+    double minDist = qAbs(temperatures[0] - temperature);
 
-    for (int i = 1; i < curveData.size(); ++i) {
-        double dist = qAbs(curveData[i].temperature - temperature);
+    for (int i = 1; i < temperatures.size(); ++i) {
+        double dist = qAbs(temperatures[i] - temperature);
         if (dist < minDist) {
             minDist = dist;
             nearestIdx = i;
         }
     }
 
-    return curveData[nearestIdx];
+    return curveData.at(nearestIdx);
 }
@@ -33,6 +33,7 @@ public:
     InputType inputType() const override;
     OutputType outputType() const override;
     AlgorithmDescriptor descriptor() const override;
+    IThermalAlgorithm* clone() const override;
 
     // 曲线属性声明接口
     bool isAuxiliaryCurve() const override;
@@ -51,8 +52,8 @@ private:
      * @param point2 终点（温度，值）
      * @return 基线曲线数据
      */
-    QVector<ThermalDataPoint>
-    generateBaseline(const QVector<ThermalDataPoint>& curveData, const QPointF& point1, const QPointF& point2) const;
+    ThermalDataSeries
+    generateBaseline(const ThermalDataSeries& curveData, const QPointF& point1, const QPointF& point2) const;
 
     /**
      * @brief 从曲线数据中找到最接近指定温度的点
@@ -61,7 +62,7 @@ private:
      * @param temperature 目标温度
      * @return 最接近的数据点
      */
-    ThermalDataPoint findNearestPoint(const QVector<ThermalDataPoint>& curveData, double temperature) const;
+    ThermalDataPoint findNearestPoint(const ThermalDataSeries& curveData, double temperature) const;
 };
 
 #endif // BASELINECORRECTIONALGORITHM_H
@@ -1,4 +1,5 @@
 #include "differentiation_algorithm.h"
+#include "sliding_window_difference.h"
 #include "application/algorithm/algorithm_context.h"
 #include "domain/model/thermal_curve.h"
 #include "domain/model/thermal_data_point.h"
@@ -55,9 +56,15 @@ AlgorithmDescriptor DifferentiationAlgorithm::descriptor() const
         { "dt", "时间步长", QVariant::Double, m_dt, false, {{ "min", 1e-6 }} },
         { "enableDebug", "启用调试", QVariant::Bool, m_enableDebug, false, {} },
     };
+    desc.cacheable = true;  // 输出只取决于活动曲线和参数
     return desc;
 }
 
+IThermalAlgorithm* DifferentiationAlgorithm::clone() const
+{
+    return new DifferentiationAlgorithm(*this);
+}
+
 // ==================== 曲线属性声明接口实现 ====================
 
 bool DifferentiationAlgorithm::isAuxiliaryCurve() const
@@ -126,11 +133,16 @@ AlgorithmResult DifferentiationAlgorithm::executeWithContext(AlgorithmContext* c
     double dt = context->get<double>(ContextKeys::ParamDt).value_or(m_dt);
     bool enableDebug = context->get<bool>(ContextKeys::ParamEnableDebug).value_or(m_enableDebug);
 
-    // 获取输入数据
-    const QVector<ThermalDataPoint>& inputData = inputCurve.getProcessedData();
+    // 获取输入数据（列式视图，内层循环只访问连续的 value 列）
+    const ThermalDataSeries& inputData = inputCurve.getProcessedData();
+    const ColumnView<double> values = inputData.values();
+    const ColumnView<double> temperatures = inputData.temperatures();
+    const ColumnView<double> times = inputData.times();
 
-    // 执行微分算法（核心逻辑）
-    QVector<ThermalDataPoint> outputData;
+    // 执行微分算法（核心逻辑），输出按列构建
+    QVector<double> outTemperatures;
+    QVector<double> outTimes;
+    QVector<double> outValues;
 
     const int minPoints = 2 * halfWin + 1;
     if (inputData.size() < minPoints) {
@@ -148,33 +160,39 @@ AlgorithmResult DifferentiationAlgorithm::executeWithContext(AlgorithmContext* c
     }
 
     const double windowTime = halfWin * dt;
-    outputData.reserve(inputData.size() - 2 * halfWin);
+    const int outputSize = inputData.size() - 2 * halfWin;
+    outTemperatures.reserve(outputSize);
+    outTimes.reserve(outputSize);
+    outValues.reserve(outputSize);
 
     int positiveCount = 0;
     int negativeCount = 0;
     int zeroCount = 0;
 
-    // 进度报告：计算总迭代次数
+    // 1. 滑动窗口差分（O(N)，与 halfWin 无关）；回调中检查取消标志并每 10% 报告一次进度
     const int totalIterations = inputData.size() - 2 * halfWin;
     int lastReportedProgress = 0;
-
-    for (int i = halfWin; i < inputData.size() - halfWin; ++i) {
-        // 检查取消标志（每100次迭代）
-        if ((i - halfWin) % 100 == 0 && shouldCancel()) {
-            qWarning() << "DifferentiationAlgorithm: 用户取消执行";
-            return AlgorithmResult::failure("differentiation", "用户取消执行");
+    QVector<double> differences;
+    const bool completed = SlidingWindowDifference::compute(values, halfWin, differences, [&](int processed) {
+        if (shouldCancel()) {
+            return false;
         }
-
-        double sum_before = 0.0;
-        double sum_after = 0.0;
-
-        for (int j = 1; j <= halfWin; ++j) {
-            sum_before += inputData[i - j].value;
-            sum_after += inputData[i + j].value;
+        const int currentProgress = (processed * 100) / totalIterations;
+        if (currentProgress >= lastReportedProgress + 10) {
+            lastReportedProgress = currentProgress;
+            reportProgress(currentProgress, QString("已处理 %1/%2 点").arg(processed).arg(totalIterations));
         }
+        return true;
+    });
+    if (!completed) {
+        qWarning() << "DifferentiationAlgorithm: 用户取消执行";
+        return AlgorithmResult::failure("differentiation", "用户取消执行");
+    }
 
-        const double dy = sum_after - sum_before;
-        const double derivative = dy / windowTime / halfWin;
+    // 2. 换算为导数并统计符号分布
+    for (int k = 0; k < differences.size(); ++k) {
+        const int i = k + halfWin;
+        const double derivative = differences[k] / windowTime / halfWin;
 
         if (derivative > 0.0001) {
             positiveCount++;
@@ -184,25 +202,17 @@ AlgorithmResult DifferentiationAlgorithm::executeWithContext(AlgorithmContext* c
             zeroCount++;
         }
 
-        ThermalDataPoint point;
-        point.temperature = inputData[i].temperature;
-        point.value = derivative;
-        point.time = inputData[i].time;
-
-        outputData.append(point);
-
-        // 进度报告（每10%）
-        int currentIteration = i - halfWin + 1;
-        int currentProgress = (currentIteration * 100) / totalIterations;
-        if (currentProgress >= lastReportedProgress + 10) {
-            lastReportedProgress = currentProgress;
-            reportProgress(currentProgress, QString("已处理 %1/%2 点").arg(currentIteration).arg(totalIterations));
-        }
+        outTemperatures.append(temperatures[i]);
+        outTimes.append(times[i]);
+        outValues.append(derivative);
     }
 
     // 最终进度报告
     reportProgress(100, "微分计算完成");
 
+    const ThermalDataSeries outputData = ThermalDataSeries::fromColumns(
+        std::move(outTemperatures), std::move(outTimes), std::move(outValues));
+
     if (enableDebug) {
         qDebug() << "\n========== 微分统计 ==========";
         qDebug() << "输出数据点数:" << outputData.size();
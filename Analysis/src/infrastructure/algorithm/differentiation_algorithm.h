@@ -10,6 +10,7 @@ class AlgorithmContext;
  * @brief 微分算法类 - 基于DTG大窗口平滑中心差分法
  * @details 使用前后各halfWin个点的和之差计算导数
  *          derivative[i] = (Σy[i+j] - Σy[i-j]) / (windowTime × halfWin)
+ *          窗口和通过滑动增量更新（见 SlidingWindowDifference），复杂度 O(N)，与 halfWin 无关
  */
 class DifferentiationAlgorithm : public IThermalAlgorithm {
 public:
@@ -23,6 +24,7 @@ public:
     InputType inputType() const override;
     OutputType outputType() const override;
     AlgorithmDescriptor descriptor() const override;
+    IThermalAlgorithm* clone() const override;
 
     // 曲线属性声明接口
     bool isAuxiliaryCurve() const override;
@@ -1,5 +1,6 @@
 #include "integration_algorithm.h"
 #include "application/algorithm/algorithm_context.h"
+#include "domain/model/cumulative_integral.h"
 #include "domain/model/thermal_curve.h"
 #include "domain/model/thermal_data_point.h"
 #include <QDebug>
@@ -55,9 +56,15 @@ AlgorithmDescriptor IntegrationAlgorithm::descriptor() const
     desc.name = name();
     desc.interaction = AlgorithmInteraction::None;  // 简单算法，无需交互
     // 暂无可配置参数，预留扩展（如方法/归一化等）
+    desc.cacheable = true;  // 输出只取决于活动曲线和参数
     return desc;
 }
 
+IThermalAlgorithm* IntegrationAlgorithm::clone() const
+{
+    return new IntegrationAlgorithm(*this);
+}
+
 // ==================== 曲线属性声明接口实现 ====================
 
 bool IntegrationAlgorithm::isAuxiliaryCurve() const
@@ -115,54 +122,30 @@ AlgorithmResult IntegrationAlgorithm::executeWithContext(AlgorithmContext* conte
     const ThermalCurve& inputCurve = curveOpt.value();
 
     // 3. 获取输入数据
-    const QVector<ThermalDataPoint>& inputData = inputCurve.getProcessedData();
+    const ThermalDataSeries& inputData = inputCurve.getProcessedData();
 
     // 4. 执行核心算法逻辑（梯形法则积分）
-    QVector<ThermalDataPoint> outputData;
     const int n = inputData.size();
     if (n == 0) {
         qWarning() << "IntegrationAlgorithm::executeWithContext - 输入数据为空！";
         return AlgorithmResult::failure("integration", "输入数据为空");
     }
 
-    outputData.resize(n);
-    double cum = 0.0;
-
-    // 第一个点的积分为0
-    outputData[0] = inputData[0];
-    outputData[0].value = 0.0;
-
-    // 进度报告：计算总迭代次数
-    int lastReportedProgress = 0;
-
-    for (int i = 1; i < n; ++i) {
-        // 检查取消标志（每100次迭代）
-        if (i % 100 == 0 && shouldCancel()) {
-            qWarning() << "IntegrationAlgorithm: 用户取消执行";
-            return AlgorithmResult::failure("integration", "用户取消执行");
-        }
-
-        const auto& p0 = inputData[i - 1];
-        const auto& p1 = inputData[i];
-        const double dx = (p1.temperature - p0.temperature);
-        if (!qFuzzyIsNull(dx)) {
-            const double area = 0.5 * (p0.value + p1.value) * dx; // 梯形法则
-            cum += area;
-        }
-        outputData[i] = p1;
-        outputData[i].value = cum;
-
-        // 进度报告（每10%）
-        int currentProgress = (i * 100) / n;
-        if (currentProgress >= lastReportedProgress + 10) {
-            lastReportedProgress = currentProgress;
-            reportProgress(currentProgress, QString("已处理 %1/%2 点").arg(i).arg(n));
-        }
+    // 检查取消标志
+    if (shouldCancel()) {
+        qWarning() << "IntegrationAlgorithm: 用户取消执行";
+        return AlgorithmResult::failure("integration", "用户取消执行");
     }
 
+    // 累积梯形积分由输入数据的前缀积分缓存提供（与峰面积查询共用，同一版本只计算一次）
+    // 输出只改变数值列，温度/时间列与输入共享
+    QVector<double> cumulative = inputData.cumulativeIntegral(false)->values();
+
     // 最终进度报告
     reportProgress(100, "积分计算完成");
 
+    const ThermalDataSeries outputData = inputData.withValues(std::move(cumulative));
+
     qDebug() << "IntegrationAlgorithm::executeWithContext - 完成，输出数据点数:" << outputData.size();
 
     // 5. 创建结果对象
@@ -23,6 +23,7 @@ public:
     InputType inputType() const override;
     OutputType outputType() const override;
     AlgorithmDescriptor descriptor() const override;
+    IThermalAlgorithm* clone() const override;
 
     // 曲线属性声明接口
     bool isAuxiliaryCurve() const override;
@@ -3,10 +3,107 @@
 #include "domain/model/thermal_curve.h"
 #include "domain/model/thermal_data_point.h"
 #include <QDebug>
+#include <QStringList>
 #include <QVariant>
 #include <QUuid>
 #include <QtGlobal>
 
+// ==================== SIMD 支持检测 ====================
+// AVX2 需在构建时显式启用（见 Analysis.pro 中的 analysis_avx2 选项）；SSE2 在 x86-64 上总是可用
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define MOVING_AVERAGE_HAS_SSE2 1
+#endif
+
+// ==================== 滤波内核 ====================
+
+namespace {
+
+/**
+ * @brief 由补偿前缀和求闭区间 [first, last] 的和
+ */
+inline double prefixRangeSum(const double* hi, const double* lo, int first, int last)
+{
+    return (hi[last + 1] - hi[first]) + (lo[last + 1] - lo[first]);
+}
+
+/**
+ * @brief 镜像反射索引（不重复边界点）：-1 → 1，n → n-2
+ */
+int reflectIndex(int j, int n)
+{
+    if (n == 1) {
+        return 0;
+    }
+    const int period = 2 * (n - 1);
+    j %= period;
+    if (j < 0) {
+        j += period;
+    }
+    return (j < n) ? j : period - j;
+}
+
+/**
+ * @brief 反射边界模式下窗口 [left, right] 的和
+ *
+ * 越界部分只反射一次时用前缀和 O(1) 求得；窗口远大于数据长度（多次反射）时逐点求和。
+ */
+double reflectedWindowSum(const ColumnView<double>& values, const double* hi, const double* lo, int left, int right)
+{
+    const int n = values.size();
+    if (n > 1 && left >= -(n - 1) && right <= 2 * (n - 1)) {
+        double sum = prefixRangeSum(hi, lo, qMax(0, left), qMin(n - 1, right));
+        if (left < 0) {
+            sum += prefixRangeSum(hi, lo, 1, -left);
+        }
+        if (right > n - 1) {
+            sum += prefixRangeSum(hi, lo, 2 * (n - 1) - right, n - 2);
+        }
+        return sum;
+    }
+
+    double sum = 0.0;
+    for (int j = left; j <= right; ++j) {
+        sum += values[reflectIndex(j, n)];
+    }
+    return sum;
+}
+
+/**
+ * @brief 完整窗口均值内核：out[k] = ((hiR[k] - hiL[k]) + (loR[k] - loL[k])) / span
+ *
+ * 输入是前缀和列上两个错开的只读视图，逐元素独立，可直接向量化。
+ * 使用 AVX2（构建时启用 CONFIG += analysis_avx2）或 SSE2 指令，余数部分走标量；
+ * 各路径运算顺序一致，结果逐位相同。
+ */
+void windowMeanKernel(const double* hiL, const double* hiR, const double* loL, const double* loR,
+                      double span, double* out, int count)
+{
+    int k = 0;
+#if defined(__AVX2__)
+    const __m256d vspan = _mm256_set1_pd(span);
+    for (; k + 4 <= count; k += 4) {
+        const __m256d dHi = _mm256_sub_pd(_mm256_loadu_pd(hiR + k), _mm256_loadu_pd(hiL + k));
+        const __m256d dLo = _mm256_sub_pd(_mm256_loadu_pd(loR + k), _mm256_loadu_pd(loL + k));
+        _mm256_storeu_pd(out + k, _mm256_div_pd(_mm256_add_pd(dHi, dLo), vspan));
+    }
+#elif defined(MOVING_AVERAGE_HAS_SSE2)
+    const __m128d vspan = _mm_set1_pd(span);
+    for (; k + 2 <= count; k += 2) {
+        const __m128d dHi = _mm_sub_pd(_mm_loadu_pd(hiR + k), _mm_loadu_pd(hiL + k));
+        const __m128d dLo = _mm_sub_pd(_mm_loadu_pd(loR + k), _mm_loadu_pd(loL + k));
+        _mm_storeu_pd(out + k, _mm_div_pd(_mm_add_pd(dHi, dLo), vspan));
+    }
+#endif
+    for (; k < count; ++k) {
+        out[k] = ((hiR[k] - hiL[k]) + (loR[k] - loL[k])) / span;
+    }
+}
+
+} // namespace
+
 MovingAverageFilterAlgorithm::MovingAverageFilterAlgorithm()
 {
     qDebug() << "构造: MovingAverageFilterAlgorithm";
@@ -53,10 +150,18 @@ AlgorithmDescriptor MovingAverageFilterAlgorithm::descriptor() const
     desc.interaction = AlgorithmInteraction::ParameterDialog;
     desc.parameters = {
         { QStringLiteral("window"), QStringLiteral("窗口大小"), QVariant::Int, m_window, true, { { QStringLiteral("min"), 1 } } },
+        { QStringLiteral("edgeMode"), QStringLiteral("边界处理"), QVariant::String, edgeModeName(m_edgeMode), false,
+          { { QStringLiteral("options"), QStringList{ QStringLiteral("shrink"), QStringLiteral("reflect"), QStringLiteral("valid") } } } },
     };
+    desc.cacheable = true;  // 输出只取决于活动曲线和参数
     return desc;
 }
 
+IThermalAlgorithm* MovingAverageFilterAlgorithm::clone() const
+{
+    return new MovingAverageFilterAlgorithm(*this);
+}
+
 // ==================== 曲线属性声明接口实现 ====================
 
 bool MovingAverageFilterAlgorithm::isAuxiliaryCurve() const
@@ -93,6 +198,9 @@ bool MovingAverageFilterAlgorithm::prepareContext(AlgorithmContext* context)
     if (!context->contains(ContextKeys::ParamWindow)) {
         context->setValue(ContextKeys::ParamWindow, m_window, "MovingAverageFilterAlgorithm::prepareContext");
     }
+    if (!context->contains(ContextKeys::ParamEdgeMode)) {
+        context->setValue(ContextKeys::ParamEdgeMode, edgeModeName(m_edgeMode), "MovingAverageFilterAlgorithm::prepareContext");
+    }
 
     qDebug() << "MovingAverageFilterAlgorithm::prepareContext - 数据就绪";
     return true;
@@ -118,11 +226,14 @@ AlgorithmResult MovingAverageFilterAlgorithm::executeWithContext(AlgorithmContex
     // 3. 拉取参数（使用 value_or() 提供默认值）
     int window = context->get<int>(ContextKeys::ParamWindow).value_or(m_window);
 
-    // 4. 获取输入数据
-    const QVector<ThermalDataPoint>& inputData = inputCurve.getProcessedData();
+    const EdgeMode edgeMode = parseEdgeMode(
+        context->get<QString>(ContextKeys::ParamEdgeMode).value_or(edgeModeName(m_edgeMode)));
+
+    // 4. 获取输入数据（列式视图）
+    const ThermalDataSeries& inputData = inputCurve.getProcessedData();
+    const ColumnView<double> values = inputData.values();
 
     // 5. 执行核心算法逻辑（移动平均滤波）
-    QVector<ThermalDataPoint> outputData;
     const int n = inputData.size();
     if (n == 0) {
         qWarning() << "MovingAverageFilterAlgorithm::executeWithContext - 输入数据为空！";
@@ -131,11 +242,23 @@ AlgorithmResult MovingAverageFilterAlgorithm::executeWithContext(AlgorithmContex
 
     // 安全窗口（最少为1）
     const int w = qMax(1, window);
-    const int half = w / 2; // 对称窗口
+    const int half = w / 2; // 对称窗口：实际覆盖 [i - half, i + half]，共 2*half+1 个点
 
-    outputData.resize(n);
+    if (edgeMode == EdgeMode::Valid && n < 2 * half + 1) {
+        QString error = QString("数据点不足! 仅保留完整窗口时需要至少 %1 个点，实际只有 %2 个点")
+                            .arg(2 * half + 1).arg(n);
+        qWarning() << "MovingAverageFilterAlgorithm::executeWithContext -" << error;
+        return AlgorithmResult::failure("moving_average", error);
+    }
+
+    // 5.1 前缀和：prefixHi[k] + prefixLo[k] = Σ y[0..k-1]（Neumaier 补偿，避免长序列累计误差）
+    QVector<double> prefixHi(n + 1);
+    QVector<double> prefixLo(n + 1);
+    prefixHi[0] = 0.0;
+    prefixLo[0] = 0.0;
+    double sum = 0.0;
+    double compensation = 0.0;
 
-    // 进度报告：计算总迭代次数
     int lastReportedProgress = 0;
 
     for (int i = 0; i < n; ++i) {
@@ -145,34 +268,95 @@ AlgorithmResult MovingAverageFilterAlgorithm::executeWithContext(AlgorithmContex
             return AlgorithmResult::failure("moving_average", "用户取消执行");
         }
 
-        int left = qMax(0, i - half);
-        int right = qMin(n - 1, i + half);
-        // 当窗口为偶数时，右侧自然比左侧多1个元素，这里不强行平衡
+        const double v = values[i];
+        const double t = sum + v;
+        if (qAbs(sum) >= qAbs(v)) {
+            compensation += (sum - t) + v;
+        } else {
+            compensation += (v - t) + sum;
+        }
+        sum = t;
+        prefixHi[i + 1] = sum;
+        prefixLo[i + 1] = compensation;
+
+        // 进度报告（每10%，前缀和阶段占 0-50%）
+        int currentProgress = (i * 50) / n;
+        if (currentProgress >= lastReportedProgress + 10) {
+            lastReportedProgress = currentProgress;
+            reportProgress(currentProgress, QString("已处理 %1/%2 点").arg(i + 1).arg(n));
+        }
+    }
 
-        double sum = 0.0;
-        int count = 0;
-        for (int j = left; j <= right; ++j) {
-            sum += inputData[j].value;
-            ++count;
+    // 5.2 由前缀和求各窗口均值（每点 O(1)，与窗口大小无关）
+    const double* hi = prefixHi.constData();
+    const double* lo = prefixLo.constData();
+
+    // 完整窗口覆盖的区间 [interiorBegin, interiorEnd)
+    const int interiorBegin = qMin(half, n);
+    const int interiorEnd = qMax(interiorBegin, n - half);
+
+    QVector<double> filtered(n);
+    double* out = filtered.data();
+
+    // 边界点：窗口越界部分按边界模式处理（Valid 模式下不需要边界点）
+    auto computeEdge = [&](int i) {
+        const int left = i - half;
+        const int right = i + half;
+        if (edgeMode == EdgeMode::Reflect) {
+            out[i] = reflectedWindowSum(values, hi, lo, left, right) / (2 * half + 1);
+        } else {
+            const int l = qMax(0, left);
+            const int r = qMin(n - 1, right);
+            out[i] = prefixRangeSum(hi, lo, l, r) / (r - l + 1);
+        }
+    };
+    if (edgeMode != EdgeMode::Valid) {
+        for (int i = 0; i < interiorBegin; ++i) {
+            computeEdge(i);
+        }
+        for (int i = interiorEnd; i < n; ++i) {
+            computeEdge(i);
         }
+    }
 
-        ThermalDataPoint p;
-        p.temperature = inputData[i].temperature;
-        p.time = inputData[i].time;
-        p.value = (count > 0) ? (sum / count) : inputData[i].value;
-        outputData[i] = p;
+    // 内部点：分块向量化计算，每块检查一次取消标志
+    const int blockSize = 4096;
+    const double span = 2 * half + 1;
+    for (int blockBegin = interiorBegin; blockBegin < interiorEnd; blockBegin += blockSize) {
+        if (shouldCancel()) {
+            qWarning() << "MovingAverageFilterAlgorithm: 用户取消执行";
+            return AlgorithmResult::failure("moving_average", "用户取消执行");
+        }
 
-        // 进度报告（每10%）
-        int currentProgress = (i * 100) / n;
+        const int blockEnd = qMin(interiorEnd, blockBegin + blockSize);
+        windowMeanKernel(hi + blockBegin - half, hi + blockBegin + half + 1,
+                         lo + blockBegin - half, lo + blockBegin + half + 1,
+                         span, out + blockBegin, blockEnd - blockBegin);
+
+        // 进度报告（每10%，求均值阶段占 50-100%）
+        int currentProgress = 50 + ((blockEnd - interiorBegin) * 50) / qMax(1, interiorEnd - interiorBegin);
         if (currentProgress >= lastReportedProgress + 10) {
             lastReportedProgress = currentProgress;
-            reportProgress(currentProgress, QString("已处理 %1/%2 点").arg(i + 1).arg(n));
+            reportProgress(currentProgress, QString("已处理 %1/%2 点").arg(blockEnd).arg(n));
         }
     }
 
     // 最终进度报告
     reportProgress(100, "滤波完成");
 
+    ThermalDataSeries outputData;
+    if (edgeMode == EdgeMode::Valid) {
+        // 仅保留完整窗口的点，温度/时间列同步裁剪
+        const int validCount = interiorEnd - interiorBegin;
+        outputData = ThermalDataSeries::fromColumns(
+            inputData.temperatureColumn().mid(interiorBegin, validCount),
+            inputData.timeColumn().mid(interiorBegin, validCount),
+            filtered.mid(interiorBegin, validCount));
+    } else {
+        // 温度/时间列与输入共享
+        outputData = inputData.withValues(std::move(filtered));
+    }
+
     qDebug() << "MovingAverageFilterAlgorithm::executeWithContext - 完成，窗口大小:" << w << "，输出数据点数:" << outputData.size();
 
     // 6. 创建结果对象
@@ -197,7 +381,39 @@ AlgorithmResult MovingAverageFilterAlgorithm::executeWithContext(AlgorithmContex
     result.setCurve(outputCurve);
     result.setMeta("method", "Moving Average");
     result.setMeta("windowSize", w);
+    result.setMeta("edgeMode", edgeModeName(edgeMode));
     result.setMeta("label", "滤波曲线");
 
     return result;
 }
+
+// ==================== 边界模式 ====================
+
+MovingAverageFilterAlgorithm::EdgeMode MovingAverageFilterAlgorithm::parseEdgeMode(const QString& name)
+{
+    const QString key = name.trimmed().toLower();
+    if (key == QLatin1String("shrink")) {
+        return EdgeMode::Shrink;
+    }
+    if (key == QLatin1String("reflect")) {
+        return EdgeMode::Reflect;
+    }
+    if (key == QLatin1String("valid")) {
+        return EdgeMode::Valid;
+    }
+    qWarning() << "MovingAverageFilterAlgorithm - 未知的边界模式:" << name << "，使用 shrink";
+    return EdgeMode::Shrink;
+}
+
+QString MovingAverageFilterAlgorithm::edgeModeName(EdgeMode mode)
+{
+    switch (mode) {
+    case EdgeMode::Reflect:
+        return QStringLiteral("reflect");
+    case EdgeMode::Valid:
+        return QStringLiteral("valid");
+    case EdgeMode::Shrink:
+    default:
+        return QStringLiteral("shrink");
+    }
+}
@@ -2,18 +2,30 @@
 #define MOVINGAVERAGEFILTERALGORITHM_H
 
 #include "domain/algorithm/i_thermal_algorithm.h"
+#include <QString>
 
 // 前置声明
 class AlgorithmContext;
 
 /**
  * @brief 移动平均滤波算法 - 简单平滑
- * @details 对每个点，取其两侧窗口范围内的值做平均，
- *          起始与末尾处自动缩小窗口以避免越界。
- *          参数：window（窗口大小，奇数更佳），默认 5。
+ * @details 对每个点，取其两侧窗口范围内的值做平均。
+ *          基于补偿前缀和实现，每点 O(1)，总耗时与窗口大小无关；
+ *          完整窗口部分由 SIMD 内核批量计算。
+ *          参数：window（窗口大小，奇数更佳），默认 5；
+ *                edgeMode（边界模式），默认 shrink。
  */
 class MovingAverageFilterAlgorithm : public IThermalAlgorithm {
 public:
+    /**
+     * @brief 边界处理模式（窗口越过数据首尾时）
+     */
+    enum class EdgeMode {
+        Shrink,  // 缩小窗口，只对有效点求平均（默认，与旧行为一致）
+        Reflect, // 以首尾点为轴镜像延拓，窗口大小保持不变
+        Valid    // 只输出完整窗口的点，输出曲线比输入少 2*(window/2) 个点
+    };
+
     MovingAverageFilterAlgorithm();
 
     // 核心接口方法
@@ -24,6 +36,7 @@ public:
     InputType inputType() const override;
     OutputType outputType() const override;
     AlgorithmDescriptor descriptor() const override;
+    IThermalAlgorithm* clone() const override;
 
     // 曲线属性声明接口
     bool isAuxiliaryCurve() const override;
@@ -34,7 +47,14 @@ public:
     AlgorithmResult executeWithContext(AlgorithmContext* context) override;
 
 private:
-    int m_window = 5; // 滤波窗口大小（点数）
+    /**
+     * @brief 解析边界模式名称（未知名称回退为 Shrink 并给出警告）
+     */
+    static EdgeMode parseEdgeMode(const QString& name);
+    static QString edgeModeName(EdgeMode mode);
+
+    int m_window = 5;                       // 滤波窗口大小（点数）
+    EdgeMode m_edgeMode = EdgeMode::Shrink; // 边界处理模式
 };
 
 #endif // MOVINGAVERAGEFILTERALGORITHM_H
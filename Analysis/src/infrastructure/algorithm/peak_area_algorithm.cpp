@@ -62,6 +62,11 @@ AlgorithmDescriptor PeakAreaAlgorithm::descriptor() const
     return desc;
 }
 
+IThermalAlgorithm* PeakAreaAlgorithm::clone() const
+{
+    return new PeakAreaAlgorithm(*this);
+}
+
 // ==================== 曲线属性声明接口实现 ====================
 
 bool PeakAreaAlgorithm::isAuxiliaryCurve() const
@@ -139,7 +144,7 @@ AlgorithmResult PeakAreaAlgorithm::executeWithContext(AlgorithmContext* context)
     }
 
     // 4. 获取输入数据
-    const QVector<ThermalDataPoint>& curveData = inputCurve.getProcessedData();
+    const ThermalDataSeries& curveData = inputCurve.getProcessedData();
     if (curveData.isEmpty()) {
         qWarning() << "PeakAreaAlgorithm::executeWithContext - 曲线数据为空！";
         return AlgorithmResult::failure("peak_area", "曲线数据为空");
@@ -222,71 +227,20 @@ AlgorithmResult PeakAreaAlgorithm::executeWithContext(AlgorithmContext* context)
     return result;
 }
 
-double PeakAreaAlgorithm::calculateArea(const QVector<ThermalDataPoint>& curveData,
+double PeakAreaAlgorithm::calculateArea(const ThermalDataSeries& curveData,
                                         double temp1, double temp2) const
 {
-    if (curveData.isEmpty()) {
+    if (curveData.size() < 2) {
         return 0.0;
     }
 
     // 使用梯形积分法计算面积
     // A = Σ [(y[i] + y[i+1]) / 2] * (x[i+1] - x[i])
-
-    double area = 0.0;
-
-    // 进度报告：计算总迭代次数
-    const int totalIterations = curveData.size() - 1;
-    int lastReportedProgress = 0;
-
-    for (int i = 0; i < curveData.size() - 1; ++i) {
-        // 检查取消标志（每100次迭代）
-        if (i % 100 == 0 && shouldCancel()) {
-            qWarning() << "PeakAreaAlgorithm: 用户取消执行";
-            return 0.0;  // 返回0表示取消
-        }
-
-        double x1 = curveData[i].temperature;
-        double x2 = curveData[i + 1].temperature;
-        double y1 = curveData[i].value;
-        double y2 = curveData[i + 1].value;
-
-        // 检查数据点是否在积分范围内
-        if (x2 < temp1 || x1 > temp2) {
-            continue;  // 完全在范围外
-        }
-
-        // 裁剪到积分范围
-        double effectiveX1 = qMax(x1, temp1);
-        double effectiveX2 = qMin(x2, temp2);
-
-        // 如果需要插值
-        double effectiveY1 = y1;
-        double effectiveY2 = y2;
-
-        if (x1 < temp1 && x2 > temp1) {
-            // 左边界需要插值
-            double ratio = (temp1 - x1) / (x2 - x1);
-            effectiveY1 = y1 + ratio * (y2 - y1);
-        }
-
-        if (x1 < temp2 && x2 > temp2) {
-            // 右边界需要插值
-            double ratio = (temp2 - x1) / (x2 - x1);
-            effectiveY2 = y1 + ratio * (y2 - y1);
-        }
-
-        // 计算梯形面积
-        double dx = effectiveX2 - effectiveX1;
-        double avgY = (effectiveY1 + effectiveY2) / 2.0;
-        area += avgY * dx;
-
-        // 进度报告（每10%）
-        int currentProgress = (i * 100) / totalIterations;
-        if (currentProgress >= lastReportedProgress + 10) {
-            lastReportedProgress = currentProgress;
-            reportProgress(currentProgress, QString("计算峰面积 %1/%2").arg(i + 1).arg(totalIterations));
-        }
-    }
+    //
+    // 由曲线的前缀积分缓存求得：A = F(temp2) - F(temp1)，端点处线性插值。
+    // 前缀积分和单调段索引按数据版本构建一次，之后每次查询 O(log N)；
+    // 非单调曲线（回温等）逐段求和，降温段按 dx < 0 计入。
+    const double area = curveData.integrate(temp1, temp2, false);
 
     // 最终进度报告
     reportProgress(100, "峰面积计算完成");
@@ -37,6 +37,7 @@ public:
     InputType inputType() const override;
     OutputType outputType() const override;
     AlgorithmDescriptor descriptor() const override;
+    IThermalAlgorithm* clone() const override;
 
     // 曲线属性声明接口
     bool isAuxiliaryCurve() const override;
@@ -48,14 +49,14 @@ public:
 
 private:
     /**
-     * @brief 使用梯形积分法计算峰面积
+     * @brief 使用梯形积分法计算峰面积（基于曲线的前缀积分缓存，O(log N)）
      *
      * @param curveData 曲线数据
      * @param temp1 起始温度
      * @param temp2 终止温度
      * @return 峰面积值
      */
-    double calculateArea(const QVector<ThermalDataPoint>& curveData, double temp1, double temp2) const;
+    double calculateArea(const ThermalDataSeries& curveData, double temp1, double temp2) const;
 
     /**
      * @brief 格式化峰面积输出文本
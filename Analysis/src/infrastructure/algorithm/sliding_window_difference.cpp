@@ -0,0 +1,53 @@
+#include "sliding_window_difference.h"
+#include <QtGlobal>
+
+double SlidingWindowDifference::direct(const ColumnView<double>& values, int i, int halfWin)
+{
+    double sum_before = 0.0;
+    double sum_after = 0.0;
+
+    for (int j = 1; j <= halfWin; ++j) {
+        sum_before += values[i - j];
+        sum_after += values[i + j];
+    }
+
+    return sum_after - sum_before;
+}
+
+bool SlidingWindowDifference::compute(const ColumnView<double>& values, int halfWin, QVector<double>& out,
+                                      const std::function<bool(int)>& shouldContinue)
+{
+    out.clear();
+    if (halfWin < 1 || values.size() < 2 * halfWin + 1) {
+        return false;
+    }
+
+    const int outputSize = values.size() - 2 * halfWin;
+    out.resize(outputSize);
+
+    double dy = 0.0;
+    double compensation = 0.0;
+    for (int k = 0; k < outputSize; ++k) {
+        if (k % CheckInterval == 0 && shouldContinue && !shouldContinue(k)) {
+            out.clear();
+            return false;
+        }
+
+        const int i = k + halfWin;
+        if (k % ResyncInterval == 0) {
+            dy = direct(values, i, halfWin);
+            compensation = 0.0;
+        } else {
+            const double delta = (values[i + halfWin] - values[i]) - (values[i - 1] - values[i - 1 - halfWin]);
+            const double sum = dy + delta;
+            if (qAbs(dy) >= qAbs(delta)) {
+                compensation += (dy - sum) + delta;
+            } else {
+                compensation += (delta - sum) + dy;
+            }
+            dy = sum;
+        }
+        out[k] = dy + compensation;
+    }
+    return true;
+}
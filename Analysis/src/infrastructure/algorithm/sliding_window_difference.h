@@ -0,0 +1,40 @@
+#ifndef SLIDINGWINDOWDIFFERENCE_H
+#define SLIDINGWINDOWDIFFERENCE_H
+
+#include "domain/model/thermal_data_series.h"
+#include <QVector>
+#include <functional>
+
+/**
+ * @brief DTG 微分的滑动窗口差分核
+ *
+ * 对 i ∈ [h, N-h) 计算 dy(i) = Σy[i+1..i+h] - Σy[i-h..i-1]。
+ * 相邻两点的差为 dy(i) - dy(i-1) = (y[i+h] - y[i]) - (y[i-1] - y[i-1-h])，每点只需 O(1) 更新；
+ * 增量使用 Neumaier 补偿求和，并每隔 ResyncInterval 点用直接求和重新同步，
+ * 因此结果与逐窗口直接求和只在舍入误差级别上不同，而总复杂度为 O(N)，与 h 无关。
+ *
+ * 不依赖算法上下文，便于单独测试（见 tests/sliding_window_difference）。
+ */
+class SlidingWindowDifference {
+public:
+    static constexpr int ResyncInterval = 4096; ///< 重新同步的间隔（点数）
+    static constexpr int CheckInterval = 100;   ///< 调用 shouldContinue 的间隔（点数）
+
+    /**
+     * @brief 直接求和计算单个窗口差（O(halfWin)），作为同步点和数值参考
+     */
+    static double direct(const ColumnView<double>& values, int i, int halfWin);
+
+    /**
+     * @brief 计算全部窗口差
+     * @param values 输入列（至少 2 × halfWin + 1 个点）
+     * @param halfWin 半窗口大小（>= 1）
+     * @param out 输出：N - 2 × halfWin 个窗口差，out[k] 对应 i = k + halfWin
+     * @param shouldContinue 每 CheckInterval 点调用一次（参数为已处理点数），返回 false 时中止；可为空
+     * @return 被中止或参数无效时返回 false
+     */
+    static bool compute(const ColumnView<double>& values, int halfWin, QVector<double>& out,
+                        const std::function<bool(int)>& shouldContinue = nullptr);
+};
+
+#endif // SLIDINGWINDOWDIFFERENCE_H
@@ -8,6 +8,8 @@
 #include <QPointF>
 #include <QVariant>
 #include <QtMath>
+#include <algorithm>
+#include <limits>
 
 // ==================== 调试开关 ====================
 // 设置为 1 启用调试日志，设置为 0 禁用（生产环境）
@@ -63,6 +65,11 @@ AlgorithmDescriptor TemperatureExtrapolationAlgorithm::descriptor() const
     return desc;
 }
 
+IThermalAlgorithm* TemperatureExtrapolationAlgorithm::clone() const
+{
+    return new TemperatureExtrapolationAlgorithm(*this);
+}
+
 // ==================== 曲线属性声明接口实现 ====================
 
 bool TemperatureExtrapolationAlgorithm::isAuxiliaryCurve() const
@@ -141,7 +148,7 @@ AlgorithmResult TemperatureExtrapolationAlgorithm::executeWithContext(AlgorithmC
         return AlgorithmResult::failure("temperature_extrapolation", error);
     }
 
-    const QVector<ThermalDataPoint>& baselineData = baselineCurve.getProcessedData();
+    const ThermalDataSeries& baselineData = baselineCurve.getProcessedData();
     if (baselineData.isEmpty()) {
         QString error = "基线曲线数据为空";
         qWarning() << "TemperatureExtrapolationAlgorithm::executeWithContext -" << error;
@@ -163,7 +170,7 @@ AlgorithmResult TemperatureExtrapolationAlgorithm::executeWithContext(AlgorithmC
     }
 
     // 5. 获取输入数据
-    const QVector<ThermalDataPoint>& curveData = inputCurve.getProcessedData();
+    const ThermalDataSeries& curveData = inputCurve.getProcessedData();
     if (curveData.isEmpty()) {
         qWarning() << "TemperatureExtrapolationAlgorithm::executeWithContext - 曲线数据为空！";
         return AlgorithmResult::failure("temperature_extrapolation", "曲线数据为空");
@@ -190,7 +197,7 @@ AlgorithmResult TemperatureExtrapolationAlgorithm::executeWithContext(AlgorithmC
     }
 
     // 8. 提取拟合区域的数据点
-    QVector<ThermalDataPoint> fittingRegion = extractFittingRegion(
+    ThermalDataSeries fittingRegion = extractFittingRegion(
         curveData, tangentPoint1, tangentPoint2
     );
 
@@ -335,7 +342,7 @@ bool TemperatureExtrapolationAlgorithm::findBaselineCurve(AlgorithmContext* cont
 }
 
 double TemperatureExtrapolationAlgorithm::getBaselineYAtTemperature(
-    const QVector<ThermalDataPoint>& baselineData,
+    const ThermalDataSeries& baselineData,
     double temperature) const
 {
     if (baselineData.isEmpty()) {
@@ -350,26 +357,30 @@ double TemperatureExtrapolationAlgorithm::getBaselineYAtTemperature(
         return baselineData.last().value;
     }
 
-    // 线性插值
-    for (int i = 0; i < baselineData.size() - 1; ++i) {
-        double t1 = baselineData[i].temperature;
-        double t2 = baselineData[i + 1].temperature;
-
-        if (temperature >= t1 && temperature <= t2) {
-            double y1 = baselineData[i].value;
-            double y2 = baselineData[i + 1].value;
+    // 二分查找温度所在的区间 [i, i+1]（基线按温度升序），再线性插值
+    const ColumnView<double> temperatures = baselineData.temperatures();
+    const ColumnView<double> values = baselineData.values();
+    const int i = static_cast<int>(std::upper_bound(temperatures.begin(), temperatures.end(), temperature)
+                                   - temperatures.begin()) - 1;
+    if (i < 0 || i + 1 >= temperatures.size()) {
+        return 0.0;
+    }
 
-            // 线性插值公式
-            double ratio = (temperature - t1) / (t2 - t1);
-            return y1 + ratio * (y2 - y1);
-        }
+    double t1 = temperatures[i];
+    double t2 = temperatures[i + 1];
+    double y1 = values[i];
+    double y2 = values[i + 1];
+    if (t2 <= t1) {
+        return y1;  // 避免除零
     }
 
-    return 0.0;
+    // 线性插值公式
+    double ratio = (temperature - t1) / (t2 - t1);
+    return y1 + ratio * (y2 - y1);
 }
 
 bool TemperatureExtrapolationAlgorithm::validatePeakRange(
-    const QVector<ThermalDataPoint>& baselineData,
+    const ThermalDataSeries& baselineData,
     double peakTemp1,
     double peakTemp2) const
 {
@@ -397,7 +408,7 @@ bool TemperatureExtrapolationAlgorithm::validatePeakRange(
 bool TemperatureExtrapolationAlgorithm::calculateIntersectionWithBaseline(
     double slope,
     double intercept,
-    const QVector<ThermalDataPoint>& baselineData,
+    const ThermalDataSeries& baselineData,
     double searchRangeMin,
     double searchRangeMax,
     double& intersectionTemp) const
@@ -406,37 +417,71 @@ bool TemperatureExtrapolationAlgorithm::calculateIntersectionWithBaseline(
         return false;
     }
 
-    // 使用迭代法查找交点
-    // 切线方程: y_tangent = slope * x + intercept
-    // 基线方程: y_baseline = getBaselineYAtTemperature(x)
-    // 交点条件: |y_tangent - y_baseline| < epsilon
+    // 切线与基线（分段线性）之差 d(x) = slope * x + intercept - y_baseline(x) 在每个基线段上也是线性的，
+    // 因此逐段检查端点符号即可，变号的段内直接解出交点：x = t1 + d1 / (d1 - d2) * (t2 - t1)。
+    // 一次遍历 O(N)，结果精确到浮点精度；有多个交点时取温度最低者（外推起始点）。
+
+    const ColumnView<double> temperatures = baselineData.temperatures();
+    const ColumnView<double> values = baselineData.values();
+    const int n = temperatures.size();
 
-    const double epsilon = 0.001;  // 精度阈值
-    const double step = 0.1;       // 搜索步长（°C）
+    auto difference = [&](int i) {
+        return slope * temperatures[i] + intercept - values[i];
+    };
+    auto inSearchRange = [&](double temp) {
+        return temp >= searchRangeMin && temp <= searchRangeMax;
+    };
 
+    bool found = false;
+    double bestRoot = 0.0;
+
+    // 未变号时的回退：|d| 在顶点处取最小值（切线与基线相切或近似相切）
     double minDistance = std::numeric_limits<double>::max();
     double bestTemp = searchRangeMin;
 
-    for (double temp = searchRangeMin; temp <= searchRangeMax; temp += step) {
-        double yTangent = slope * temp + intercept;
-        double yBaseline = getBaselineYAtTemperature(baselineData, temp);
+    double d1 = difference(0);
+    for (int i = 0; i < n; ++i) {
+        // 检查取消标志（每100次迭代）
+        if (i % 100 == 0 && shouldCancel()) {
+            qWarning() << "TemperatureExtrapolationAlgorithm: 用户取消执行";
+            return false;
+        }
+
+        const double t1 = temperatures[i];
+        if (inSearchRange(t1)) {
+            if (d1 == 0.0 && (!found || t1 < bestRoot)) {
+                found = true;
+                bestRoot = t1;
+            }
+            if (qAbs(d1) < minDistance) {
+                minDistance = qAbs(d1);
+                bestTemp = t1;
+            }
+        }
 
-        double distance = qAbs(yTangent - yBaseline);
+        if (i + 1 >= n) {
+            break;
+        }
 
-        if (distance < minDistance) {
-            minDistance = distance;
-            bestTemp = temp;
+        const double t2 = temperatures[i + 1];
+        const double d2 = difference(i + 1);
+        if ((d1 < 0.0 && d2 > 0.0) || (d1 > 0.0 && d2 < 0.0)) {
+            const double root = t1 + d1 / (d1 - d2) * (t2 - t1);
+            if (inSearchRange(root) && (!found || root < bestRoot)) {
+                found = true;
+                bestRoot = root;
+            }
         }
+        d1 = d2;
+    }
 
-        if (distance < epsilon) {
-            // 找到交点
-            intersectionTemp = temp;
+    if (found) {
+        intersectionTemp = bestRoot;
 #if DEBUG_TEMPERATURE_EXTRAPOLATION
-            qDebug() << "TemperatureExtrapolationAlgorithm::calculateIntersectionWithBaseline - 找到交点:"
-                     << intersectionTemp << ", 误差:" << distance;
+        qDebug() << "TemperatureExtrapolationAlgorithm::calculateIntersectionWithBaseline - 找到交点:"
+                 << intersectionTemp;
 #endif
-            return true;
-        }
+        return true;
     }
 
     // 如果没有找到精确交点，返回最接近的点
@@ -453,7 +498,7 @@ bool TemperatureExtrapolationAlgorithm::calculateIntersectionWithBaseline(
 }
 
 bool TemperatureExtrapolationAlgorithm::fitTangentLine(
-    const QVector<ThermalDataPoint>& points,
+    const ThermalDataSeries& points,
     double& slope,
     double& intercept) const
 {
@@ -463,6 +508,8 @@ bool TemperatureExtrapolationAlgorithm::fitTangentLine(
     }
 
     // 最小二乘法拟合直线 y = k*x + b
+    const ColumnView<double> xs = points.temperatures();
+    const ColumnView<double> ys = points.values();
     double sumX = 0.0;
     double sumY = 0.0;
     double sumXY = 0.0;
@@ -477,8 +524,8 @@ bool TemperatureExtrapolationAlgorithm::fitTangentLine(
             return false;
         }
 
-        double x = points[i].temperature;
-        double y = points[i].value;
+        double x = xs[i];
+        double y = ys[i];
 
         sumX += x;
         sumY += y;
@@ -505,19 +552,22 @@ bool TemperatureExtrapolationAlgorithm::fitTangentLine(
     return true;
 }
 
-QVector<ThermalDataPoint> TemperatureExtrapolationAlgorithm::extractFittingRegion(
-    const QVector<ThermalDataPoint>& curveData,
+ThermalDataSeries TemperatureExtrapolationAlgorithm::extractFittingRegion(
+    const ThermalDataSeries& curveData,
     const ThermalDataPoint& point1,
     const ThermalDataPoint& point2) const
 {
-    QVector<ThermalDataPoint> region;
+    ThermalDataSeries region;
 
     double temp1 = qMin(point1.temperature, point2.temperature);
     double temp2 = qMax(point1.temperature, point2.temperature);
 
-    for (const ThermalDataPoint& point : curveData) {
-        if (point.temperature >= temp1 && point.temperature <= temp2) {
-            region.append(point);
+    const ColumnView<double> temperatures = curveData.temperatures();
+    const ColumnView<double> times = curveData.times();
+    const ColumnView<double> values = curveData.values();
+    for (int i = 0; i < temperatures.size(); ++i) {
+        if (temperatures[i] >= temp1 && temperatures[i] <= temp2) {
+            region.append(temperatures[i], times[i], values[i]);
         }
     }
 
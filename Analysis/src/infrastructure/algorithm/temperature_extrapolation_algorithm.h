@@ -50,6 +50,7 @@ public:
     InputType inputType() const override;
     OutputType outputType() const override;
     AlgorithmDescriptor descriptor() const override;
+    IThermalAlgorithm* clone() const override;
 
     // 曲线属性声明接口
     bool isAuxiliaryCurve() const override;
@@ -72,13 +73,13 @@ private:
     bool findBaselineCurve(AlgorithmContext* context, ThermalCurve& baselineCurve) const;
 
     /**
-     * @brief 获取基线曲线在指定温度的 Y 值（插值）
+     * @brief 获取基线曲线在指定温度的 Y 值（二分查找 + 线性插值）
      *
      * @param baselineData 基线曲线数据
      * @param temperature 目标温度
      * @return 基线在该温度的 Y 值
      */
-    double getBaselineYAtTemperature(const QVector<ThermalDataPoint>& baselineData,
+    double getBaselineYAtTemperature(const ThermalDataSeries& baselineData,
                                       double temperature) const;
 
     /**
@@ -89,7 +90,7 @@ private:
      * @param peakTemp2 峰范围终点温度
      * @return true - 峰范围在基线范围内，false - 超出范围
      */
-    bool validatePeakRange(const QVector<ThermalDataPoint>& baselineData,
+    bool validatePeakRange(const ThermalDataSeries& baselineData,
                            double peakTemp1,
                            double peakTemp2) const;
 
@@ -103,14 +104,16 @@ private:
      * @param intercept 输出：截距 b
      * @return true - 拟合成功，false - 拟合失败（点数不足或数据异常）
      */
-    bool fitTangentLine(const QVector<ThermalDataPoint>& points,
+    bool fitTangentLine(const ThermalDataSeries& points,
                         double& slope,
                         double& intercept) const;
 
     /**
      * @brief 计算切线与基线曲线的交点
      *
-     * 通过迭代查找切线与基线曲线的最近交点
+     * 基线为分段线性，切线与基线之差在每段上也是线性的：逐段检查端点符号，
+     * 在变号段内解析求解交点。一次遍历 O(N)，精确到浮点精度；
+     * 多个交点时取温度最低者，无交点时回退到距离最近（< 0.1）的基线点。
      *
      * @param slope 切线斜率
      * @param intercept 切线截距
@@ -122,7 +125,7 @@ private:
      */
     bool calculateIntersectionWithBaseline(double slope,
                                             double intercept,
-                                            const QVector<ThermalDataPoint>& baselineData,
+                                            const ThermalDataSeries& baselineData,
                                             double searchRangeMin,
                                             double searchRangeMax,
                                             double& intersectionTemp) const;
@@ -137,8 +140,8 @@ private:
      * @param point2 切线区域终点
      * @return 拟合区域的数据点
      */
-    QVector<ThermalDataPoint> extractFittingRegion(
-        const QVector<ThermalDataPoint>& curveData,
+    ThermalDataSeries extractFittingRegion(
+        const ThermalDataSeries& curveData,
         const ThermalDataPoint& point1,
         const ThermalDataPoint& point2) const;
 
@@ -0,0 +1,428 @@
+#include "autosave_journal.h"
+#include "domain/model/project_document.h"
+#include "infrastructure/io/column_block_io.h"
+#include "infrastructure/io/curve_record_io.h"
+#include <QDataStream>
+#include <QDebug>
+#include <QMap>
+#include <QSaveFile>
+#include <QtEndian>
+#include <cstring>
+#include <limits>
+
+namespace {
+
+const char JournalMagic[8] = { 'T', 'J', 'R', 'N', 'L', '\r', '\n', '\x1a' };
+const quint32 JournalVersion = 2; // 版本 2 增加追加记录；版本 1 的日志仍可恢复
+const qint64 JournalHeaderSize = 16;
+const qint64 RecordHeaderSize = 16;
+
+enum RecordType : quint32 {
+    BatchRecord = 1,
+    CurveRecord = 2,
+    AppendRecord = 3
+};
+
+QByteArray journalHeader()
+{
+    QByteArray header(int(JournalHeaderSize), '\0');
+    uchar* h = reinterpret_cast<uchar*>(header.data());
+    std::memcpy(h, JournalMagic, sizeof(JournalMagic));
+    qToLittleEndian<quint32>(JournalVersion, h + 8);
+    return header;
+}
+
+void prepareStream(QDataStream& stream)
+{
+    stream.setVersion(QDataStream::Qt_5_12);
+    stream.setByteOrder(QDataStream::LittleEndian);
+}
+
+QByteArray encodeBatch(const AutosaveBatch& batch)
+{
+    QByteArray payload;
+    QDataStream out(&payload, QIODevice::WriteOnly);
+    prepareStream(out);
+    out << batch.commandDescriptions << batch.cleared << batch.removedCurveIds << batch.activeCurveId
+        << quint32(batch.curves.size()) << quint32(batch.appends.size());
+    return payload;
+}
+
+/**
+ * @brief 写入一段采样：点数、逐点元数据与三列采样
+ */
+void writeSeries(QDataStream& out, const ThermalDataSeries& series)
+{
+    // 列数据直接写入流的设备（QDataStream 不缓冲写入，二者顺序一致）
+    out << quint64(series.size()) << ColumnBlockIO::collectPointMetadata(series);
+    ColumnBlockIO::writeColumn(*out.device(), series.temperatures());
+    ColumnBlockIO::writeColumn(*out.device(), series.times());
+    ColumnBlockIO::writeColumn(*out.device(), series.values());
+}
+
+/**
+ * @brief 曲线记录：属性，然后是原始数据（及与之不共享的处理后数据）的点数、逐点元数据与三列采样
+ */
+QByteArray encodeCurve(const ThermalCurve& curve)
+{
+    const ThermalDataSeries& raw = curve.getRawData();
+    const ThermalDataSeries& processed = curve.getProcessedData();
+    const bool writeProcessed = !processed.isEmpty() && !processed.isSharedWith(raw);
+
+    QByteArray payload;
+    QDataStream out(&payload, QIODevice::WriteOnly);
+    prepareStream(out);
+    CurveRecordIO::writeProperties(out, curve);
+    out << quint32(writeProcessed ? 2 : 1);
+    writeSeries(out, raw);
+    if (writeProcessed) {
+        writeSeries(out, processed);
+    }
+    return payload;
+}
+
+/**
+ * @brief 追加记录：曲线ID、起始下标与追加的采样
+ */
+QByteArray encodeAppend(const AutosaveAppend& append)
+{
+    QByteArray payload;
+    QDataStream out(&payload, QIODevice::WriteOnly);
+    prepareStream(out);
+    out << append.curveId << quint32(append.firstIndex);
+    writeSeries(out, append.samples);
+    return payload;
+}
+
+bool readColumn(QDataStream& in, int count, QVector<double>* column)
+{
+    column->resize(count);
+    const int bytes = count * int(sizeof(double));
+    if (in.readRawData(reinterpret_cast<char*>(column->data()), bytes) != bytes) {
+        return false;
+    }
+#if Q_BYTE_ORDER == Q_BIG_ENDIAN
+    qFromLittleEndian<double>(column->constData(), count, column->data());
+#endif
+    return true;
+}
+
+/**
+ * @brief 读取 writeSeries() 写入的一段采样
+ */
+bool readSeries(QDataStream& in, ThermalDataSeries* series)
+{
+    quint64 pointCount = 0;
+    QHash<int, QVariantMap> pointMetadata;
+    in >> pointCount >> pointMetadata;
+    // 负载已通过校验和，点数仍需与剩余长度核对，避免按损坏的点数分配内存
+    const qint64 remaining = in.device()->bytesAvailable();
+    if (in.status() != QDataStream::Ok || pointCount > quint64(remaining) / (3 * sizeof(double))) {
+        return false;
+    }
+    QVector<double> temperatures;
+    QVector<double> times;
+    QVector<double> values;
+    const int count = int(pointCount);
+    if (!readColumn(in, count, &temperatures) || !readColumn(in, count, &times) || !readColumn(in, count, &values)) {
+        return false;
+    }
+    *series = ThermalDataSeries::fromColumns(std::move(temperatures), std::move(times), std::move(values));
+    ColumnBlockIO::applyPointMetadata(*series, pointMetadata);
+    return true;
+}
+
+bool decodeCurve(const QByteArray& payload, ThermalCurve* curve)
+{
+    QDataStream in(payload);
+    prepareStream(in);
+    quint32 seriesCount = 0;
+    if (!CurveRecordIO::readProperties(in, curve)) {
+        return false;
+    }
+    in >> seriesCount;
+    if (in.status() != QDataStream::Ok || seriesCount < 1 || seriesCount > 2) {
+        return false;
+    }
+
+    for (quint32 k = 0; k < seriesCount; ++k) {
+        ThermalDataSeries series;
+        if (!readSeries(in, &series)) {
+            return false;
+        }
+        // setRawData 会把处理后数据重置为原始数据
+        if (k == 0) {
+            curve->setRawData(series);
+        } else {
+            curve->setProcessedData(series);
+        }
+    }
+    return true;
+}
+
+bool decodeAppend(const QByteArray& payload, AutosaveAppend* append)
+{
+    QDataStream in(payload);
+    prepareStream(in);
+    quint32 firstIndex = 0;
+    in >> append->curveId >> firstIndex;
+    if (in.status() != QDataStream::Ok || firstIndex > quint32(std::numeric_limits<int>::max())) {
+        return false;
+    }
+    append->firstIndex = int(firstIndex);
+    return readSeries(in, &append->samples);
+}
+
+bool writeRecord(QIODevice& device, RecordType type, const QByteArray& payload)
+{
+    uchar header[RecordHeaderSize];
+    qToLittleEndian<quint32>(type, header);
+    qToLittleEndian<quint32>(qChecksum(payload.constData(), uint(payload.size())), header + 4);
+    qToLittleEndian<quint64>(quint64(payload.size()), header + 8);
+    return device.write(reinterpret_cast<const char*>(header), RecordHeaderSize) == RecordHeaderSize
+        && device.write(payload) == payload.size();
+}
+
+/**
+ * @brief 读取一条记录；文件结束、记录不完整或校验失败时返回 false
+ */
+bool readRecord(QIODevice& device, quint32* type, QByteArray* payload)
+{
+    uchar header[RecordHeaderSize];
+    if (device.read(reinterpret_cast<char*>(header), RecordHeaderSize) != RecordHeaderSize) {
+        return false;
+    }
+    *type = qFromLittleEndian<quint32>(header);
+    const quint32 checksum = qFromLittleEndian<quint32>(header + 4);
+    const quint64 payloadSize = qFromLittleEndian<quint64>(header + 8);
+    if (payloadSize > quint64(device.bytesAvailable()) || payloadSize > quint64(std::numeric_limits<int>::max())) {
+        return false;
+    }
+    *payload = device.read(qint64(payloadSize));
+    return payload->size() == int(payloadSize) && qChecksum(payload->constData(), uint(payload->size())) == checksum;
+}
+
+bool writeBatch(QIODevice& device, const AutosaveBatch& batch)
+{
+    if (!writeRecord(device, BatchRecord, encodeBatch(batch))) {
+        return false;
+    }
+    for (const ThermalCurve& curve : batch.curves) {
+        if (!writeRecord(device, CurveRecord, encodeCurve(curve))) {
+            return false;
+        }
+    }
+    for (const AutosaveAppend& append : batch.appends) {
+        if (!writeRecord(device, AppendRecord, encodeAppend(append))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+bool AutosaveJournal::fail(const QString& message)
+{
+    m_errorString = message;
+    qWarning() << "AutosaveJournal:" << message << m_file.fileName();
+    return false;
+}
+
+bool AutosaveJournal::create(const QString& filePath)
+{
+    close();
+    m_errorString.clear();
+    m_file.setFileName(filePath);
+    if (!m_file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        return fail(m_file.errorString());
+    }
+    const QByteArray header = journalHeader();
+    if (m_file.write(header) != header.size() || !m_file.flush()) {
+        const QString message = m_file.errorString();
+        close();
+        return fail(message);
+    }
+    return true;
+}
+
+bool AutosaveJournal::openForAppend(const QString& filePath)
+{
+    m_file.setFileName(filePath);
+    if (!m_file.open(QIODevice::WriteOnly | QIODevice::Append)) {
+        return fail(m_file.errorString());
+    }
+    return true;
+}
+
+bool AutosaveJournal::appendBatch(const AutosaveBatch& batch)
+{
+    if (!m_file.isOpen()) {
+        return fail(QStringLiteral("日志未打开"));
+    }
+    // 写入失败时截断到批次开始前，保持日志由完整批次组成
+    const qint64 batchStart = m_file.size();
+    if (!writeBatch(m_file, batch) || !m_file.flush()) {
+        const QString message = m_file.errorString();
+        m_file.resize(batchStart);
+        return fail(message);
+    }
+    return true;
+}
+
+bool AutosaveJournal::compact(const QVector<ThermalCurve>& curves, const QString& activeCurveId)
+{
+    const QString filePath = m_file.fileName();
+    if (filePath.isEmpty()) {
+        return fail(QStringLiteral("日志未打开"));
+    }
+
+    AutosaveBatch snapshot;
+    snapshot.cleared = true;
+    snapshot.curves = curves;
+    snapshot.activeCurveId = activeCurveId;
+
+    // Windows 上打开中的文件无法被替换，先关闭追加句柄
+    m_file.close();
+    QSaveFile file(filePath);
+    bool ok = file.open(QIODevice::WriteOnly);
+    if (ok) {
+        const QByteArray header = journalHeader();
+        ok = file.write(header) == header.size() && writeBatch(file, snapshot);
+        if (!ok) {
+            file.cancelWriting();
+        } else {
+            ok = file.commit();
+        }
+    }
+    const QString message = file.errorString();
+
+    // 无论压缩是否成功都继续追加（失败时原日志保持不变）
+    if (!openForAppend(filePath)) {
+        return false;
+    }
+    if (!ok) {
+        return fail(QStringLiteral("压缩日志失败: %1").arg(message));
+    }
+    qDebug() << "AutosaveJournal: 已压缩日志" << filePath << "曲线数:" << curves.size() << "大小:" << m_file.size();
+    return true;
+}
+
+void AutosaveJournal::close()
+{
+    if (m_file.isOpen()) {
+        m_file.close();
+    }
+}
+
+bool AutosaveJournal::remove()
+{
+    close();
+    return m_file.fileName().isEmpty() || !m_file.exists() || m_file.remove();
+}
+
+bool AutosaveJournal::recover(const QString& filePath, ProjectDocument* document, int* batchCount, QString* errorMessage)
+{
+    auto failRecover = [&](const QString& message) {
+        qWarning() << "AutosaveJournal::recover:" << message << filePath;
+        if (errorMessage) {
+            *errorMessage = message;
+        }
+        return false;
+    };
+
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return failRecover(file.errorString());
+    }
+    const QByteArray header = file.read(JournalHeaderSize);
+    if (header.size() != JournalHeaderSize || std::memcmp(header.constData(), JournalMagic, sizeof(JournalMagic)) != 0) {
+        return failRecover(QStringLiteral("不是有效的自动保存日志"));
+    }
+    const quint32 version = qFromLittleEndian<quint32>(header.constData() + 8);
+    if (version < 1 || version > JournalVersion) {
+        return failRecover(QStringLiteral("不支持的自动保存日志版本: %1").arg(version));
+    }
+
+    QMap<QString, ThermalCurve> curves;
+    QString activeCurveId;
+    int appliedBatches = 0;
+
+    // 逐批次重放：批次记录及其全部曲线记录完整时才应用
+    quint32 type = 0;
+    QByteArray payload;
+    while (readRecord(file, &type, &payload)) {
+        if (type != BatchRecord) {
+            break;
+        }
+        AutosaveBatch batch;
+        quint32 curveCount = 0;
+        quint32 appendCount = 0;
+        {
+            QDataStream in(payload);
+            prepareStream(in);
+            in >> batch.commandDescriptions >> batch.cleared >> batch.removedCurveIds >> batch.activeCurveId >> curveCount;
+            if (version >= 2) {
+                in >> appendCount;
+            }
+            if (in.status() != QDataStream::Ok) {
+                break;
+            }
+        }
+
+        bool complete = true;
+        for (quint32 i = 0; i < curveCount && complete; ++i) {
+            ThermalCurve curve;
+            complete = readRecord(file, &type, &payload) && type == CurveRecord && decodeCurve(payload, &curve);
+            if (complete) {
+                batch.curves.append(curve);
+            }
+        }
+        for (quint32 i = 0; i < appendCount && complete; ++i) {
+            AutosaveAppend append;
+            complete = readRecord(file, &type, &payload) && type == AppendRecord && decodeAppend(payload, &append);
+            if (complete) {
+                batch.appends.append(append);
+            }
+        }
+        if (!complete) {
+            qWarning() << "AutosaveJournal::recover: 丢弃不完整的批次" << batch.commandDescriptions;
+            break;
+        }
+
+        if (batch.cleared) {
+            curves.clear();
+        }
+        for (const QString& curveId : qAsConst(batch.removedCurveIds)) {
+            curves.remove(curveId);
+        }
+        for (const ThermalCurve& curve : qAsConst(batch.curves)) {
+            curves.insert(curve.id(), curve);
+        }
+        for (const AutosaveAppend& append : qAsConst(batch.appends)) {
+            // 起始下标与日志中已有的点数不符说明前面的记录缺失，不能接续
+            auto it = curves.find(append.curveId);
+            if (it == curves.end() || it->getRawData().size() != append.firstIndex) {
+                qWarning() << "AutosaveJournal::recover: 忽略无法接续的追加记录" << append.curveId << append.firstIndex;
+                continue;
+            }
+            it->appendRawData(append.samples);
+        }
+        activeCurveId = batch.activeCurveId;
+        ++appliedBatches;
+    }
+
+    if (appliedBatches == 0) {
+        return failRecover(QStringLiteral("自动保存日志中没有完整的记录"));
+    }
+
+    ProjectDocument result;
+    result.curves = orderParentFirst(curves);
+    result.activeCurveId = curves.contains(activeCurveId) ? activeCurveId : QString();
+    *document = result;
+    if (batchCount) {
+        *batchCount = appliedBatches;
+    }
+    qDebug() << "AutosaveJournal: 已从日志恢复" << filePath << "批次数:" << appliedBatches << "曲线数:" << result.curves.size();
+    return true;
+}
@@ -0,0 +1,113 @@
+#ifndef AUTOSAVEJOURNAL_H
+#define AUTOSAVEJOURNAL_H
+
+#include "domain/model/thermal_curve.h"
+#include <QFile>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+struct ProjectDocument;
+
+/**
+ * @brief 追加到已写入日志的曲线末尾的采样（跟随文件、实时采集）
+ */
+struct AutosaveAppend {
+    QString curveId;
+    int firstIndex = 0;        // 第一个追加采样在原始数据中的下标（即日志中该曲线已有的点数）
+    ThermalDataSeries samples; // 追加的采样（从曲线尾部复制，不引用曲线的缓冲区）
+};
+
+/**
+ * @brief 一次自动保存提交的增量：自上次提交以来变化的曲线与执行过的命令
+ *
+ * 恢复时按 cleared → removedCurveIds → curves → appends → activeCurveId 的顺序应用到上一状态。
+ */
+struct AutosaveBatch {
+    QStringList commandDescriptions; // 期间执行/撤销/重做的命令（仅用于诊断与恢复提示）
+    bool cleared = false;            // 先清空全部曲线
+    QStringList removedCurveIds;     // 被删除的曲线
+    QVector<ThermalCurve> curves;    // 新增的曲线（按ID覆盖已有曲线）
+    QVector<AutosaveAppend> appends; // 只在末尾追加了采样的曲线
+    QString activeCurveId;
+};
+
+/**
+ * @brief AutosaveJournal 只追加写入的自动保存日志（.tjournal）
+ *
+ * 文件格式（小端序）：
+ * - 文件头 16 字节：魔数 "TJRNL\r\n\x1a"、quint32 版本号、quint32 保留
+ * - 之后为记录序列，每条记录为 quint32 类型、quint32 校验和（qChecksum）、quint64 负载长度、负载
+ * - 一个批次由一条批次记录（命令描述、清空标志、删除的曲线、活动曲线、曲线数、追加数）、
+ *   紧随其后的各曲线记录（属性、原始/处理后数据的三列 double 与逐点元数据）
+ *   和各追加记录（曲线ID、起始下标、追加采样的三列 double 与逐点元数据）组成；
+ *   追加记录在恢复时接到已有曲线的原始数据末尾，持续增长的曲线因此不必每个批次整条重写
+ *
+ * 每个批次写完即刷新到磁盘，崩溃时最多丢失最后一个未写完的批次：恢复时读到
+ * 不完整或校验失败的记录即停止，并丢弃该记录所在的批次。
+ * compact() 把当前全部曲线写成一个清空批次并替换整个日志，使日志大小与项目大小相当。
+ *
+ * 不是线程安全的，由自动保存线程独占使用。
+ */
+class AutosaveJournal {
+public:
+    ~AutosaveJournal() { close(); }
+
+    /**
+     * @brief 创建新日志（覆盖已有文件）并保持打开以追加
+     */
+    bool create(const QString& filePath);
+
+    /**
+     * @brief 追加一个批次并刷新到磁盘
+     */
+    bool appendBatch(const AutosaveBatch& batch);
+
+    /**
+     * @brief 压缩日志：以当前全部曲线的快照替换整个日志
+     * @param curves 当前全部曲线（父曲线在前）
+     * @param activeCurveId 活动曲线
+     *
+     * 快照先写入临时文件再替换日志，替换前崩溃时原日志保持完整。
+     */
+    bool compact(const QVector<ThermalCurve>& curves, const QString& activeCurveId);
+
+    /**
+     * @brief 日志当前大小（字节）
+     */
+    qint64 size() const { return m_file.isOpen() ? m_file.size() : 0; }
+
+    void close();
+
+    /**
+     * @brief 关闭并删除日志文件
+     */
+    bool remove();
+
+    QString filePath() const { return m_file.fileName(); }
+
+    /**
+     * @brief 最近一次失败的原因
+     */
+    QString errorString() const { return m_errorString; }
+
+    /**
+     * @brief 重放日志，得到最后一个完整批次之后的曲线状态
+     * @param filePath 日志文件路径
+     * @param document 输出：曲线（父曲线在前）与活动曲线，视图状态为空
+     * @param batchCount 输出：成功重放的批次数（可选）
+     * @param errorMessage 失败原因（可选）
+     * @return 日志可读且至少包含一个完整批次时返回 true
+     */
+    static bool recover(const QString& filePath, ProjectDocument* document, int* batchCount = nullptr,
+                        QString* errorMessage = nullptr);
+
+private:
+    bool fail(const QString& message);
+    bool openForAppend(const QString& filePath);
+
+    QFile m_file;
+    QString m_errorString;
+};
+
+#endif // AUTOSAVEJOURNAL_H
@@ -0,0 +1,219 @@
+#include "column_block_io.h"
+#include <QFileInfo>
+#include <QIODevice>
+#include <QMutex>
+#include <QSet>
+#include <QVector>
+#include <QtEndian>
+#include <limits>
+
+namespace {
+
+/**
+ * @brief 引用映射区域中一组列的外部存储
+ *
+ * 所有实例登记在 mappedStorages() 中，覆盖写入被映射的文件前可改为持有副本（见 releaseMappings()）。
+ */
+class MappedColumnStorage : public ExternalColumnStorage {
+public:
+    MappedColumnStorage(QSharedPointer<ColumnBlockIO::MappedFile> mapping, const double* temperatures, const double* times,
+                        const double* values, int size);
+    ~MappedColumnStorage() override;
+
+    QString fileName() const { return m_fileName; }
+
+    /**
+     * @brief 复制列数据并释放对映射的引用
+     */
+    void copyAndRelease();
+
+private:
+    QSharedPointer<ColumnBlockIO::MappedFile> m_mapping;
+    QString m_fileName;
+    QVector<double> m_temperatures;
+    QVector<double> m_times;
+    QVector<double> m_values;
+};
+
+QMutex& mappedStoragesMutex()
+{
+    static QMutex mutex;
+    return mutex;
+}
+
+QSet<MappedColumnStorage*>& mappedStorages()
+{
+    static QSet<MappedColumnStorage*> storages;
+    return storages;
+}
+
+MappedColumnStorage::MappedColumnStorage(QSharedPointer<ColumnBlockIO::MappedFile> mapping, const double* temperatures,
+                                         const double* times, const double* values, int size)
+    : m_mapping(std::move(mapping))
+    , m_fileName(QFileInfo(m_mapping->file.fileName()).absoluteFilePath())
+{
+    setColumns(temperatures, times, values, size);
+    QMutexLocker locker(&mappedStoragesMutex());
+    mappedStorages().insert(this);
+}
+
+MappedColumnStorage::~MappedColumnStorage()
+{
+    QMutexLocker locker(&mappedStoragesMutex());
+    mappedStorages().remove(this);
+}
+
+void MappedColumnStorage::copyAndRelease()
+{
+    if (!m_mapping) {
+        return;
+    }
+    m_temperatures = QVector<double>(temperatures(), temperatures() + size());
+    m_times = QVector<double>(times(), times() + size());
+    m_values = QVector<double>(values(), values() + size());
+    setColumns(m_temperatures.constData(), m_times.constData(), m_values.constData(), size());
+    m_mapping.reset();
+}
+
+/**
+ * @brief 复制一列小端序 double
+ */
+QVector<double> copyColumn(const uchar* data, qint64 offset, int count)
+{
+    QVector<double> column(count);
+    qFromLittleEndian<double>(data + offset, count, column.data());
+    return column;
+}
+
+} // namespace
+
+namespace ColumnBlockIO {
+
+MappedFile::~MappedFile()
+{
+    if (data) {
+        file.unmap(data);
+    }
+}
+
+bool MappedFile::open(qint64 minimumSize)
+{
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    const qint64 fileSize = file.size();
+    if (fileSize >= minimumSize && fileSize > 0) {
+        data = file.map(0, fileSize);
+    }
+    return true;
+}
+
+bool isValidBlock(quint64 pointCount, const quint64 columnOffsets[3], qint64 fileSize)
+{
+    if (pointCount > quint64(std::numeric_limits<int>::max())) {
+        return false;
+    }
+    const quint64 columnBytes = pointCount * sizeof(double);
+    for (int column = 0; column < 3; ++column) {
+        const quint64 offset = columnOffsets[column];
+        if (offset % sizeof(double) != 0 || offset > quint64(fileSize) || columnBytes > quint64(fileSize) - offset) {
+            return false;
+        }
+    }
+    return true;
+}
+
+ThermalDataSeries seriesFromBlock(const QSharedPointer<MappedFile>& mapping, const uchar* data, const SeriesBlock& block)
+{
+#if Q_BYTE_ORDER == Q_LITTLE_ENDIAN
+    if (mapping && mapping->data) {
+        return ThermalDataSeries::fromExternal(QSharedPointer<const ExternalColumnStorage>(new MappedColumnStorage(
+            mapping, reinterpret_cast<const double*>(data + block.columnOffsets[0]),
+            reinterpret_cast<const double*>(data + block.columnOffsets[1]),
+            reinterpret_cast<const double*>(data + block.columnOffsets[2]), block.pointCount)));
+    }
+#else
+    Q_UNUSED(mapping);
+#endif
+    return ThermalDataSeries::fromColumns(copyColumn(data, block.columnOffsets[0], block.pointCount),
+                                          copyColumn(data, block.columnOffsets[1], block.pointCount),
+                                          copyColumn(data, block.columnOffsets[2], block.pointCount));
+}
+
+int releaseMappings(const QString& filePath)
+{
+#ifdef Q_OS_WIN
+    const QString absolutePath = QFileInfo(filePath).absoluteFilePath();
+    int released = 0;
+    QMutexLocker locker(&mappedStoragesMutex());
+    for (MappedColumnStorage* storage : qAsConst(mappedStorages())) {
+        if (storage->fileName().compare(absolutePath, Qt::CaseInsensitive) == 0) {
+            storage->copyAndRelease();
+            ++released;
+        }
+    }
+    return released;
+#else
+    Q_UNUSED(filePath);
+    return 0;
+#endif
+}
+
+QHash<int, QVariantMap> collectPointMetadata(const ThermalDataSeries& series)
+{
+    QHash<int, QVariantMap> metadata;
+    if (!series.hasMetadata()) {
+        return metadata;
+    }
+    for (int i = 0; i < series.size(); ++i) {
+        const QVariantMap pointMetadata = series.metadataAt(i);
+        if (!pointMetadata.isEmpty()) {
+            metadata.insert(i, pointMetadata);
+        }
+    }
+    return metadata;
+}
+
+void applyPointMetadata(ThermalDataSeries& series, const QHash<int, QVariantMap>& metadata)
+{
+    for (auto it = metadata.constBegin(); it != metadata.constEnd(); ++it) {
+        if (it.key() >= 0 && it.key() < series.size()) {
+            series.setMetadataAt(it.key(), it.value());
+        }
+    }
+}
+
+bool writePadding(QIODevice& device, qint64 offset)
+{
+    const qint64 padding = offset - device.pos();
+    if (padding <= 0) {
+        return padding == 0;
+    }
+    const QByteArray zeros(int(padding), '\0');
+    return device.write(zeros) == padding;
+}
+
+bool writeColumn(QIODevice& device, ColumnView<double> column)
+{
+    const qint64 bytes = qint64(column.size()) * qint64(sizeof(double));
+#if Q_BYTE_ORDER == Q_LITTLE_ENDIAN
+    return device.write(reinterpret_cast<const char*>(column.data()), bytes) == bytes;
+#else
+    QByteArray buffer(int(bytes), Qt::Uninitialized);
+    qToLittleEndian<double>(column.data(), column.size(), buffer.data());
+    return device.write(buffer) == bytes;
+#endif
+}
+
+bool writeSeries(QIODevice& device, const ThermalDataSeries& series, const qint64 columnOffsets[3])
+{
+    const ColumnView<double> columns[3] = { series.temperatures(), series.times(), series.values() };
+    for (int column = 0; column < 3; ++column) {
+        if (!writePadding(device, columnOffsets[column]) || !writeColumn(device, columns[column])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace ColumnBlockIO
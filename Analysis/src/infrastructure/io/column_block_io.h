@@ -0,0 +1,103 @@
+#ifndef COLUMNBLOCKIO_H
+#define COLUMNBLOCKIO_H
+
+#include "domain/model/thermal_data_series.h"
+#include <QFile>
+#include <QHash>
+#include <QSharedPointer>
+#include <QVariantMap>
+
+class QIODevice;
+
+/**
+ * @brief 二进制曲线文件（.tcurve、.tproj）共用的列数据块读写工具
+ *
+ * 列数据块为小端序 double 数组，起始偏移按 8 字节的整数倍对齐，
+ * 映射到内存后可直接作为 ThermalDataSeries 的外部列存储使用（零拷贝）。
+ */
+namespace ColumnBlockIO {
+
+/**
+ * @brief 保持打开并映射到内存的文件（关闭文件会解除映射，因此与映射同生命周期）
+ *
+ * 引用映射区域的序列持有它的共享指针，最后一个序列释放时解除映射并关闭文件。
+ */
+class MappedFile {
+public:
+    explicit MappedFile(const QString& filePath) : file(filePath) {}
+    ~MappedFile();
+
+    /**
+     * @brief 以只读方式打开并映射整个文件
+     * @param minimumSize 小于该大小的文件不映射
+     * @return 文件已打开返回 true（映射失败时 data 为空，由调用方退回为读取）
+     */
+    bool open(qint64 minimumSize);
+
+    QFile file;
+    uchar* data = nullptr;
+};
+
+/**
+ * @brief 文件中一个序列的列位置
+ */
+struct SeriesBlock {
+    int pointCount = 0;
+    qint64 columnOffsets[3] = { 0, 0, 0 }; // 温度、时间、测量值
+};
+
+/**
+ * @brief 校验序列的点数与各列偏移是否落在文件范围内
+ */
+bool isValidBlock(quint64 pointCount, const quint64 columnOffsets[3], qint64 fileSize);
+
+/**
+ * @brief 由文件中的列数据块构造序列
+ * @param mapping 已映射的文件（data 非空且为小端序平台时直接引用映射区域）
+ * @param data 文件内容起始地址（映射区域或读入内存的副本）
+ * @param block 列位置
+ *
+ * 无法引用映射区域时复制列数据；引用映射区域时不会读取任何采样，
+ * 对应的页面在首次访问列数据时才由系统从文件读入。
+ */
+ThermalDataSeries seriesFromBlock(const QSharedPointer<MappedFile>& mapping, const uchar* data, const SeriesBlock& block);
+
+/**
+ * @brief 让引用指定文件映射的所有序列改为持有列数据的副本，并解除该文件的映射
+ * @param filePath 即将被覆盖写入的文件
+ * @return 改为持有副本的列存储数
+ *
+ * Windows 上仍被映射的文件无法被替换，覆盖保存已打开的 .tcurve/.tproj 前由写入器调用；
+ * 其他平台替换文件不影响已有映射，不做任何操作。
+ * 须在主线程且没有后台任务读取这些序列时调用。
+ */
+int releaseMappings(const QString& filePath);
+
+/**
+ * @brief 收集序列的稀疏逐点元数据
+ */
+QHash<int, QVariantMap> collectPointMetadata(const ThermalDataSeries& series);
+
+/**
+ * @brief 恢复稀疏逐点元数据（忽略越界的索引）
+ */
+void applyPointMetadata(ThermalDataSeries& series, const QHash<int, QVariantMap>& metadata);
+
+/**
+ * @brief 写入零字节直到文件位置到达 offset
+ */
+bool writePadding(QIODevice& device, qint64 offset);
+
+/**
+ * @brief 以小端序写入一列 double
+ */
+bool writeColumn(QIODevice& device, ColumnView<double> column);
+
+/**
+ * @brief 依次写入序列的温度、时间、测量值三列（每列前补齐到给定偏移）
+ */
+bool writeSeries(QIODevice& device, const ThermalDataSeries& series, const qint64 columnOffsets[3]);
+
+} // namespace ColumnBlockIO
+
+#endif // COLUMNBLOCKIO_H
@@ -0,0 +1,49 @@
+#include "curve_record_io.h"
+#include "domain/model/thermal_curve.h"
+#include <QDataStream>
+
+namespace CurveRecordIO {
+
+void writeProperties(QDataStream& out, const ThermalCurve& curve)
+{
+    const CurveMetadata& metadata = curve.getMetadata();
+    out << curve.id() << curve.parentId() << curve.name() << curve.projectName();
+    out << qint32(curve.instrumentType()) << qint32(curve.signalType()) << qint32(curve.plotStyle());
+    out << curve.isMainCurve() << curve.isAuxiliaryCurve() << curve.isStronglyBound();
+    out << metadata.device << metadata.sampleName << metadata.sampleMass << metadata.additional;
+}
+
+bool readProperties(QDataStream& in, ThermalCurve* curve)
+{
+    QString id;
+    QString parentId;
+    QString name;
+    QString projectName;
+    qint32 instrumentType = 0;
+    qint32 signalType = 0;
+    qint32 plotStyle = 0;
+    bool isMainCurve = false;
+    bool isAuxiliaryCurve = false;
+    bool isStronglyBound = false;
+    CurveMetadata metadata;
+    in >> id >> parentId >> name >> projectName >> instrumentType >> signalType >> plotStyle;
+    in >> isMainCurve >> isAuxiliaryCurve >> isStronglyBound;
+    in >> metadata.device >> metadata.sampleName >> metadata.sampleMass >> metadata.additional;
+    if (in.status() != QDataStream::Ok || id.isEmpty()) {
+        return false;
+    }
+
+    *curve = ThermalCurve(id, name);
+    curve->setParentId(parentId);
+    curve->setProjectName(projectName);
+    curve->setInstrumentType(static_cast<InstrumentType>(instrumentType));
+    curve->setSignalType(static_cast<SignalType>(signalType));
+    curve->setPlotStyle(static_cast<PlotStyle>(plotStyle));
+    curve->setIsMainCurve(isMainCurve);
+    curve->setIsAuxiliaryCurve(isAuxiliaryCurve);
+    curve->setIsStronglyBound(isStronglyBound);
+    curve->setMetadata(metadata);
+    return true;
+}
+
+} // namespace CurveRecordIO
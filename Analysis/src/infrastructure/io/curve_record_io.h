@@ -0,0 +1,29 @@
+#ifndef CURVERECORDIO_H
+#define CURVERECORDIO_H
+
+class QDataStream;
+class ThermalCurve;
+
+/**
+ * @brief 曲线属性记录的 QDataStream 读写（.tproj 索引块与自动保存日志共用）
+ *
+ * 记录内容：ID、父曲线ID、名称、项目名称、仪器/信号/绘制类型、主曲线/辅助/强绑定标志、
+ * CurveMetadata。不含采样数据，采样数据由调用方按各自的文件格式读写。
+ */
+namespace CurveRecordIO {
+
+/**
+ * @brief 写入曲线属性
+ */
+void writeProperties(QDataStream& out, const ThermalCurve& curve);
+
+/**
+ * @brief 读取曲线属性
+ * @param curve 输出：设置了全部属性、不含采样数据的曲线
+ * @return 流状态正常且 ID 非空时返回 true
+ */
+bool readProperties(QDataStream& in, ThermalCurve* curve);
+
+} // namespace CurveRecordIO
+
+#endif // CURVERECORDIO_H
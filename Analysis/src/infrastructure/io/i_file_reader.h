@@ -2,9 +2,58 @@
 #define IFILEREADER_H
 
 #include "domain/model/thermal_curve.h"
+#include "domain/algorithm/i_progress_reporter.h"
 #include <QString>
 #include <QStringList>
 #include <QVariantMap>
+#include <memory>
+
+/**
+ * @brief 读取器通用的导入选项键（与列映射等导入配置一起放在 config 中）
+ *
+ * 不支持某项选项的读取器直接忽略该键。
+ */
+namespace FileReaderOptions {
+    /** 并行解析 (bool) - 允许将大文件映射到内存、按行切块后在线程池中并行解析；默认 false */
+    inline constexpr const char* ParallelParse = "parallelParse";
+
+    /** 解析线程数 (int) - 并行解析使用的最大线程数；缺省或 <=0 时使用 QThread::idealThreadCount() */
+    inline constexpr const char* ParseThreads = "parseThreads";
+
+    /** 跟随模式 (bool) - 文件仍在被追加写入：只解析到最后一个完整行，
+     *  并把已解析的字节数写入曲线元数据 additional[ParsedBytes]，供 createFollower() 从此处继续读取；默认 false */
+    inline constexpr const char* FollowFile = "followFile";
+
+    /** 跟随模式下由读取器写入曲线元数据的键 (qint64) - 已解析的文件字节数 */
+    inline constexpr const char* ParsedBytes = "parsedBytes";
+}
+
+/**
+ * @brief IFileFollower 增量读取仍在被追加写入的数据文件（跟随模式）
+ *
+ * 由 IFileReader::createFollower() 创建，每次 poll() 只读取上次之后新追加的字节，
+ * 解析出的完整数据行作为增量返回；不完整的末行保留到下一次。
+ * 不是线程安全的，由创建后调用 poll() 的线程独占使用。
+ */
+class IFileFollower {
+public:
+    enum class PollResult {
+        Unchanged, ///< 没有新的完整数据行
+        Appended,  ///< 有新的数据行
+        Truncated, ///< 文件变短（被截断或重写），无法继续跟随
+        Failed     ///< 读取失败，见 errorString()
+    };
+
+    virtual ~IFileFollower() = default;
+
+    /**
+     * @brief 读取新追加的数据
+     * @param appended 输出：新的数据行（与初次读取的曲线采用相同的列映射与单位换算）
+     */
+    virtual PollResult poll(ThermalDataSeries* appended) = 0;
+
+    virtual QString errorString() const = 0;
+};
 
 /**
  * @brief IFileReader 类为所有文件读取器实现定义了接口。
@@ -25,16 +74,33 @@ public:
     /**
      * @brief 读取一个文件并返回一个 ThermalCurve 对象。
      * @param filePath 文件的路径。
-     * @param config 包含用户导入配置的映射。
+     * @param config 包含用户导入配置的映射（可附带 FileReaderOptions 中的读取选项）。
+     * @param progress 进度报告器（可选）。读取器应定期报告进度并检查 shouldCancel()，
+     *                 被取消时尽快返回不含数据的曲线。可能在工作线程中调用。
      * @return 一个包含文件数据的 ThermalCurve 对象。
      */
-    virtual ThermalCurve read(const QString& filePath, const QVariantMap& config) const = 0;
+    virtual ThermalCurve read(const QString& filePath, const QVariantMap& config, IProgressReporter* progress = nullptr) const = 0;
 
     /**
      * @brief 获取支持的文件格式描述列表（例如，“Text Files (*.txt)”）。
      * @return 支持的格式字符串列表。
      */
     virtual QStringList supportedFormats() const = 0;
+
+    /**
+     * @brief 创建跟随读取器，从 offset 处继续读取文件中新追加的数据（可选能力）
+     * @param filePath 文件的路径。
+     * @param config 与初次读取相同的导入配置。
+     * @param offset 初次读取时已解析的字节数（见 FileReaderOptions::ParsedBytes）。
+     * @return 不支持跟随模式的读取器返回空指针。
+     */
+    virtual std::unique_ptr<IFileFollower> createFollower(const QString& filePath, const QVariantMap& config, qint64 offset) const
+    {
+        Q_UNUSED(filePath);
+        Q_UNUSED(config);
+        Q_UNUSED(offset);
+        return nullptr;
+    }
 };
 
 #endif // IFILEREADER_H
@@ -0,0 +1,53 @@
+#ifndef PROJECTFILEFORMAT_H
+#define PROJECTFILEFORMAT_H
+
+#include <QtGlobal>
+
+/**
+ * @brief .tproj 项目文件格式（所有整数与浮点数均为小端序）
+ *
+ * 布局：
+ * @code
+ * 偏移  大小  内容
+ * 0     8     魔数 "TPROJ\r\n\x1a"
+ * 8     4     格式版本（quint32）
+ * 12    4     曲线数（quint32）
+ * 16    8     索引块偏移（quint64）
+ * 24    8     索引块大小（quint64）
+ * 32    8     数据区偏移（quint64，按 64 字节对齐）
+ * 40    8     保留
+ * 48    ...   索引块（QDataStream，Qt 5.12 格式，小端序）
+ *       ...   数据区：各曲线各序列的列数据（double 数组，起始偏移按 64 字节对齐）
+ * @endcode
+ *
+ * 索引块依次包含活动曲线ID、每条曲线的属性与父曲线ID（父曲线在前）、
+ * 每个序列的点数与列偏移（相对数据区起点）、逐点元数据，以及视图状态
+ * （未勾选的曲线、标注点、浮动标签）。
+ *
+ * 打开项目只需解析索引块即可重建曲线树；列数据单独寻址，
+ * 映射到内存后在首次绘制或分析时才被读入。
+ */
+namespace ProjectFileFormat {
+    inline constexpr char Magic[8] = { 'T', 'P', 'R', 'O', 'J', '\r', '\n', '\x1a' };
+    inline constexpr quint32 Version = 1;
+    inline constexpr int MaxSeriesPerCurve = 2;
+    inline constexpr qint64 HeaderSize = 48;
+    inline constexpr qint64 ColumnAlignment = 64;
+
+    // 文件头字段偏移
+    inline constexpr qint64 VersionOffset = 8;
+    inline constexpr qint64 CurveCountOffset = 12;
+    inline constexpr qint64 IndexOffsetOffset = 16;
+    inline constexpr qint64 IndexSizeOffset = 24;
+    inline constexpr qint64 DataOffsetOffset = 32;
+
+    /**
+     * @brief 向上对齐到列对齐边界
+     */
+    inline qint64 alignColumn(qint64 offset)
+    {
+        return (offset + ColumnAlignment - 1) / ColumnAlignment * ColumnAlignment;
+    }
+}
+
+#endif // PROJECTFILEFORMAT_H
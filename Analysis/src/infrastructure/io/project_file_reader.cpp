@@ -0,0 +1,134 @@
+#include "project_file_reader.h"
+#include "domain/model/project_document.h"
+#include "infrastructure/io/column_block_io.h"
+#include "infrastructure/io/curve_record_io.h"
+#include "infrastructure/io/project_file_format.h"
+#include <QDataStream>
+#include <QDebug>
+#include <QtEndian>
+#include <cstring>
+
+bool ProjectFileReader::fail(const QString& message, const QString& filePath)
+{
+    m_errorString = message;
+    qWarning() << "ProjectFileReader:" << message << filePath;
+    return false;
+}
+
+bool ProjectFileReader::read(const QString& filePath, ProjectDocument* document)
+{
+    m_errorString.clear();
+    if (!document) {
+        return fail(QStringLiteral("输出项目为空"), filePath);
+    }
+
+    QSharedPointer<ColumnBlockIO::MappedFile> mapping(new ColumnBlockIO::MappedFile(filePath));
+    if (!mapping->open(ProjectFileFormat::HeaderSize)) {
+        return fail(mapping->file.errorString(), filePath);
+    }
+
+    // 1. 映射整个文件（只建立映射，不读取列数据）；无法映射时读入内存
+    const qint64 fileSize = mapping->file.size();
+    QByteArray contents;
+    const uchar* data = mapping->data;
+    if (!data) {
+        contents = mapping->file.readAll();
+        data = reinterpret_cast<const uchar*>(contents.constData());
+    }
+
+    // 2. 校验文件头
+    if (fileSize < ProjectFileFormat::HeaderSize
+        || std::memcmp(data, ProjectFileFormat::Magic, sizeof(ProjectFileFormat::Magic)) != 0) {
+        return fail(QStringLiteral("不是有效的项目文件"), filePath);
+    }
+
+    const quint32 version = qFromLittleEndian<quint32>(data + ProjectFileFormat::VersionOffset);
+    const quint32 curveCount = qFromLittleEndian<quint32>(data + ProjectFileFormat::CurveCountOffset);
+    const quint64 indexOffset = qFromLittleEndian<quint64>(data + ProjectFileFormat::IndexOffsetOffset);
+    const quint64 indexSize = qFromLittleEndian<quint64>(data + ProjectFileFormat::IndexSizeOffset);
+    const quint64 dataOffset = qFromLittleEndian<quint64>(data + ProjectFileFormat::DataOffsetOffset);
+
+    if (version != ProjectFileFormat::Version) {
+        return fail(QStringLiteral("不支持的项目文件版本: %1").arg(version), filePath);
+    }
+    if (indexOffset > quint64(fileSize) || indexSize > quint64(fileSize) - indexOffset || dataOffset > quint64(fileSize)
+        || dataOffset % sizeof(double) != 0) {
+        return fail(QStringLiteral("项目文件头损坏"), filePath);
+    }
+
+    // 3. 索引块：曲线属性与列位置
+    const QByteArray indexBlock = QByteArray::fromRawData(reinterpret_cast<const char*>(data + indexOffset), int(indexSize));
+    QDataStream in(indexBlock);
+    in.setVersion(QDataStream::Qt_5_12);
+    in.setByteOrder(QDataStream::LittleEndian);
+
+    ProjectDocument result;
+    in >> result.activeCurveId;
+
+    result.curves.reserve(int(qMin<quint32>(curveCount, 100000)));
+    for (quint32 i = 0; i < curveCount; ++i) {
+        ThermalCurve curve;
+        quint32 seriesCount = 0;
+        const bool propertiesOk = CurveRecordIO::readProperties(in, &curve);
+        in >> seriesCount;
+        if (!propertiesOk || in.status() != QDataStream::Ok || seriesCount < 1
+            || seriesCount > quint32(ProjectFileFormat::MaxSeriesPerCurve)) {
+            return fail(QStringLiteral("项目文件索引损坏"), filePath);
+        }
+
+        // 4. 列数据：映射成功且为小端序平台时直接引用映射区域（此时不读取采样），否则复制
+        ThermalDataSeries series[ProjectFileFormat::MaxSeriesPerCurve];
+        for (quint32 k = 0; k < seriesCount; ++k) {
+            quint64 pointCount = 0;
+            quint64 offsets[3] = { 0, 0, 0 };
+            QHash<int, QVariantMap> pointMetadata;
+            in >> pointCount >> offsets[0] >> offsets[1] >> offsets[2] >> pointMetadata;
+            for (quint64& offset : offsets) {
+                offset += dataOffset;
+            }
+            if (in.status() != QDataStream::Ok || !ColumnBlockIO::isValidBlock(pointCount, offsets, fileSize)) {
+                return fail(QStringLiteral("项目文件列数据越界"), filePath);
+            }
+
+            ColumnBlockIO::SeriesBlock block;
+            block.pointCount = int(pointCount);
+            for (int column = 0; column < 3; ++column) {
+                block.columnOffsets[column] = qint64(offsets[column]);
+            }
+            series[k] = ColumnBlockIO::seriesFromBlock(mapping, data, block);
+            ColumnBlockIO::applyPointMetadata(series[k], pointMetadata);
+        }
+
+        // setRawData 会把处理后数据重置为原始数据
+        curve.setRawData(series[0]);
+        if (seriesCount > 1) {
+            curve.setProcessedData(series[1]);
+        }
+        result.curves.append(curve);
+    }
+
+    // 5. 视图状态
+    ProjectViewState& viewState = result.viewState;
+    quint32 markerCount = 0;
+    in >> viewState.hiddenCurveIds >> markerCount;
+    for (quint32 i = 0; i < markerCount && in.status() == QDataStream::Ok; ++i) {
+        CurveMarkerSet markers;
+        in >> markers.curveId >> markers.points >> markers.color >> markers.size;
+        viewState.markers.append(markers);
+    }
+    quint32 labelCount = 0;
+    in >> labelCount;
+    for (quint32 i = 0; i < labelCount && in.status() == QDataStream::Ok; ++i) {
+        CurveLabelAnnotation label;
+        in >> label.curveId >> label.text >> label.anchor;
+        viewState.labels.append(label);
+    }
+    if (in.status() != QDataStream::Ok) {
+        return fail(QStringLiteral("项目文件视图状态损坏"), filePath);
+    }
+
+    *document = result;
+    qDebug() << "ProjectFileReader: 已打开项目" << filePath << "曲线数:" << result.curves.size()
+             << (mapping->data ? "（内存映射，按需读取）" : "");
+    return true;
+}
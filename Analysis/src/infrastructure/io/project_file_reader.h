@@ -0,0 +1,37 @@
+#ifndef PROJECTFILEREADER_H
+#define PROJECTFILEREADER_H
+
+#include <QString>
+
+struct ProjectDocument;
+
+/**
+ * @brief ProjectFileReader 读取 .tproj 项目文件（格式见 project_file_format.h）
+ *
+ * 只解析文件开头的索引块即可得到完整的曲线树；文件被映射到内存，
+ * 各曲线的列数据直接引用映射区域，在首次绘制或分析时才由系统从文件读入。
+ * 映射在所有曲线（及其共享副本）释放前保持有效，期间文件保持打开。
+ * 无法映射或在大端序平台上时退回为读取并复制全部列数据。
+ */
+class ProjectFileReader {
+public:
+    /**
+     * @brief 读取项目
+     * @param filePath 项目文件路径
+     * @param document 输出：曲线（父曲线在前）、活动曲线与视图状态
+     * @return 成功返回 true，失败时可通过 errorString() 获取原因
+     */
+    bool read(const QString& filePath, ProjectDocument* document);
+
+    /**
+     * @brief 最近一次读取失败的原因
+     */
+    QString errorString() const { return m_errorString; }
+
+private:
+    bool fail(const QString& message, const QString& filePath);
+
+    QString m_errorString;
+};
+
+#endif // PROJECTFILEREADER_H
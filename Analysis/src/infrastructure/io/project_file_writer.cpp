@@ -0,0 +1,118 @@
+#include "project_file_writer.h"
+#include "domain/model/project_document.h"
+#include "infrastructure/io/column_block_io.h"
+#include "infrastructure/io/curve_record_io.h"
+#include "infrastructure/io/project_file_format.h"
+#include <QDataStream>
+#include <QDebug>
+#include <QSaveFile>
+#include <QtEndian>
+#include <cstring>
+
+bool ProjectFileWriter::write(const ProjectDocument& document, const QString& filePath)
+{
+    m_errorString.clear();
+
+    // 1. 各曲线要写入的序列（处理后数据与原始数据共享缓冲区时只写一份）及其在数据区内的列偏移
+    QVector<const ThermalDataSeries*> series;
+    QVector<qint64> relativeOffsets;
+    QVector<int> seriesCounts;
+    qint64 dataSize = 0;
+    for (const ThermalCurve& curve : document.curves) {
+        const ThermalDataSeries& raw = curve.getRawData();
+        const ThermalDataSeries& processed = curve.getProcessedData();
+        series.append(&raw);
+        seriesCounts.append(1);
+        if (!processed.isEmpty() && !processed.isSharedWith(raw)) {
+            series.append(&processed);
+            seriesCounts.last() = 2;
+        }
+    }
+    for (const ThermalDataSeries* s : qAsConst(series)) {
+        const qint64 columnBytes = qint64(s->size()) * qint64(sizeof(double));
+        for (int column = 0; column < 3; ++column) {
+            dataSize = ProjectFileFormat::alignColumn(dataSize);
+            relativeOffsets.append(dataSize);
+            dataSize += columnBytes;
+        }
+    }
+
+    // 2. 索引块
+    QByteArray indexBlock;
+    {
+        QDataStream out(&indexBlock, QIODevice::WriteOnly);
+        out.setVersion(QDataStream::Qt_5_12);
+        out.setByteOrder(QDataStream::LittleEndian);
+
+        out << document.activeCurveId;
+
+        int seriesIndex = 0;
+        for (int i = 0; i < document.curves.size(); ++i) {
+            CurveRecordIO::writeProperties(out, document.curves[i]);
+
+            out << quint32(seriesCounts[i]);
+            for (int k = 0; k < seriesCounts[i]; ++k, ++seriesIndex) {
+                out << quint64(series[seriesIndex]->size());
+                for (int column = 0; column < 3; ++column) {
+                    out << quint64(relativeOffsets[3 * seriesIndex + column]);
+                }
+                out << ColumnBlockIO::collectPointMetadata(*series[seriesIndex]);
+            }
+        }
+
+        const ProjectViewState& viewState = document.viewState;
+        out << viewState.hiddenCurveIds;
+        out << quint32(viewState.markers.size());
+        for (const CurveMarkerSet& markers : viewState.markers) {
+            out << markers.curveId << markers.points << markers.color << markers.size;
+        }
+        out << quint32(viewState.labels.size());
+        for (const CurveLabelAnnotation& label : viewState.labels) {
+            out << label.curveId << label.text << label.anchor;
+        }
+    }
+
+    // 3. 文件头
+    const qint64 dataOffset = ProjectFileFormat::alignColumn(ProjectFileFormat::HeaderSize + indexBlock.size());
+
+    QByteArray header(int(ProjectFileFormat::HeaderSize), '\0');
+    uchar* h = reinterpret_cast<uchar*>(header.data());
+    std::memcpy(h, ProjectFileFormat::Magic, sizeof(ProjectFileFormat::Magic));
+    qToLittleEndian<quint32>(ProjectFileFormat::Version, h + ProjectFileFormat::VersionOffset);
+    qToLittleEndian<quint32>(quint32(document.curves.size()), h + ProjectFileFormat::CurveCountOffset);
+    qToLittleEndian<quint64>(quint64(ProjectFileFormat::HeaderSize), h + ProjectFileFormat::IndexOffsetOffset);
+    qToLittleEndian<quint64>(quint64(indexBlock.size()), h + ProjectFileFormat::IndexSizeOffset);
+    qToLittleEndian<quint64>(quint64(dataOffset), h + ProjectFileFormat::DataOffsetOffset);
+
+    // 4. 写入文件（先写临时文件，成功后替换目标文件；目标文件正被映射时先改为持有副本）
+    ColumnBlockIO::releaseMappings(filePath);
+    QSaveFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        m_errorString = file.errorString();
+        qWarning() << "ProjectFileWriter: 无法创建文件:" << filePath << m_errorString;
+        return false;
+    }
+
+    bool ok = file.write(header) == header.size() && file.write(indexBlock) == indexBlock.size();
+    for (int i = 0; ok && i < series.size(); ++i) {
+        const qint64 columnOffsets[3] = { dataOffset + relativeOffsets[3 * i], dataOffset + relativeOffsets[3 * i + 1],
+                                          dataOffset + relativeOffsets[3 * i + 2] };
+        ok = ColumnBlockIO::writeSeries(file, *series[i], columnOffsets);
+    }
+
+    if (!ok) {
+        m_errorString = file.errorString();
+        file.cancelWriting();
+        qWarning() << "ProjectFileWriter: 写入失败:" << filePath << m_errorString;
+        return false;
+    }
+    if (!file.commit()) {
+        m_errorString = file.errorString();
+        qWarning() << "ProjectFileWriter: 保存失败:" << filePath << m_errorString;
+        return false;
+    }
+
+    qDebug() << "ProjectFileWriter: 已保存项目到" << filePath << "曲线数:" << document.curves.size()
+             << "数据区大小:" << dataSize;
+    return true;
+}
@@ -0,0 +1,33 @@
+#ifndef PROJECTFILEWRITER_H
+#define PROJECTFILEWRITER_H
+
+#include <QString>
+
+struct ProjectDocument;
+
+/**
+ * @brief ProjectFileWriter 将整个项目写为 .tproj 文件（格式见 project_file_format.h）
+ *
+ * 索引块（曲线树与视图状态）写在文件开头，各曲线的列数据依次写在其后。
+ * 通过 QSaveFile 先写临时文件再替换，写入失败不会破坏已有文件。
+ */
+class ProjectFileWriter {
+public:
+    /**
+     * @brief 写入项目
+     * @param document 要保存的项目（curves 须按父曲线在前的顺序排列）
+     * @param filePath 目标文件路径
+     * @return 成功返回 true，失败时可通过 errorString() 获取原因
+     */
+    bool write(const ProjectDocument& document, const QString& filePath);
+
+    /**
+     * @brief 最近一次写入失败的原因
+     */
+    QString errorString() const { return m_errorString; }
+
+private:
+    QString m_errorString;
+};
+
+#endif // PROJECTFILEWRITER_H
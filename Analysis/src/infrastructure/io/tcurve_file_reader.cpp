@@ -0,0 +1,137 @@
+#include "tcurve_file_reader.h"
+#include "domain/model/thermal_curve.h"
+#include "infrastructure/io/column_block_io.h"
+#include "infrastructure/io/tcurve_format.h"
+#include <QDataStream>
+#include <QDebug>
+#include <QFileInfo>
+#include <QUuid>
+#include <QtEndian>
+#include <cstring>
+
+bool TCurveFileReader::canRead(const QString& filePath) const
+{
+    return filePath.endsWith(".tcurve", Qt::CaseInsensitive);
+}
+
+QStringList TCurveFileReader::supportedFormats() const
+{
+    return { "Thermal Curve Files (*.tcurve)" };
+}
+
+ThermalCurve TCurveFileReader::read(const QString& filePath, const QVariantMap& config, IProgressReporter* progress) const
+{
+    Q_UNUSED(config);
+    Q_UNUSED(progress);
+
+    ThermalCurve curve(QUuid::createUuid().toString(), "[源]");
+    curve.setProjectName(QFileInfo(filePath).fileName());
+
+    QSharedPointer<ColumnBlockIO::MappedFile> mapping(new ColumnBlockIO::MappedFile(filePath));
+    if (!mapping->open(TCurveFormat::HeaderSize)) {
+        qWarning() << "无法打开文件:" << filePath << mapping->file.errorString();
+        return curve;
+    }
+
+    // 1. 映射整个文件；无法映射时读入内存
+    const qint64 fileSize = mapping->file.size();
+    QByteArray contents;
+    const uchar* data = mapping->data;
+    if (!data) {
+        contents = mapping->file.readAll();
+        data = reinterpret_cast<const uchar*>(contents.constData());
+    }
+
+    // 2. 校验文件头
+    if (fileSize < TCurveFormat::HeaderSize
+        || std::memcmp(data, TCurveFormat::Magic, sizeof(TCurveFormat::Magic)) != 0) {
+        qWarning() << "不是有效的 .tcurve 文件:" << filePath;
+        return curve;
+    }
+
+    const quint32 version = qFromLittleEndian<quint32>(data + TCurveFormat::VersionOffset);
+    const quint32 seriesCount = qFromLittleEndian<quint32>(data + TCurveFormat::SeriesCountOffset);
+    const quint64 metadataOffset = qFromLittleEndian<quint64>(data + TCurveFormat::MetadataOffsetOffset);
+    const quint64 metadataSize = qFromLittleEndian<quint64>(data + TCurveFormat::MetadataSizeOffset);
+
+    if (version != TCurveFormat::Version) {
+        qWarning() << "不支持的 .tcurve 版本:" << version << filePath;
+        return curve;
+    }
+    if (seriesCount < 1 || seriesCount > quint32(TCurveFormat::MaxSeries) || metadataOffset > quint64(fileSize)
+        || metadataSize > quint64(fileSize) - metadataOffset) {
+        qWarning() << ".tcurve 文件头损坏:" << filePath;
+        return curve;
+    }
+
+    ColumnBlockIO::SeriesBlock blocks[TCurveFormat::MaxSeries];
+    for (quint32 i = 0; i < seriesCount; ++i) {
+        const uchar* entry = data + TCurveFormat::SeriesTableOffset + i * TCurveFormat::SeriesEntrySize;
+        const quint64 pointCount = qFromLittleEndian<quint64>(entry);
+        quint64 offsets[3];
+        for (int column = 0; column < 3; ++column) {
+            offsets[column] = qFromLittleEndian<quint64>(entry + 8 * (column + 1));
+        }
+        if (!ColumnBlockIO::isValidBlock(pointCount, offsets, fileSize)) {
+            qWarning() << ".tcurve 文件列数据越界:" << filePath;
+            return curve;
+        }
+        blocks[i].pointCount = int(pointCount);
+        for (int column = 0; column < 3; ++column) {
+            blocks[i].columnOffsets[column] = qint64(offsets[column]);
+        }
+    }
+
+    // 3. 元数据
+    const QByteArray metadataBlock = QByteArray::fromRawData(reinterpret_cast<const char*>(data + metadataOffset), int(metadataSize));
+    QDataStream in(metadataBlock);
+    in.setVersion(QDataStream::Qt_5_12);
+    in.setByteOrder(QDataStream::LittleEndian);
+
+    QString name;
+    QString projectName;
+    qint32 instrumentType = 0;
+    qint32 signalType = 0;
+    qint32 plotStyle = 0;
+    bool isMainCurve = false;
+    bool isAuxiliaryCurve = false;
+    bool isStronglyBound = false;
+    CurveMetadata metadata;
+    in >> name >> projectName >> instrumentType >> signalType >> plotStyle;
+    in >> isMainCurve >> isAuxiliaryCurve >> isStronglyBound;
+    in >> metadata.device >> metadata.sampleName >> metadata.sampleMass >> metadata.additional;
+
+    QHash<int, QVariantMap> pointMetadata[TCurveFormat::MaxSeries];
+    for (quint32 i = 0; i < seriesCount; ++i) {
+        in >> pointMetadata[i];
+    }
+    if (in.status() != QDataStream::Ok) {
+        qWarning() << ".tcurve 文件元数据损坏:" << filePath;
+        return curve;
+    }
+
+    // 4. 列数据：映射成功且为小端序平台时直接引用映射区域，否则复制
+    ThermalDataSeries series[TCurveFormat::MaxSeries];
+    for (quint32 i = 0; i < seriesCount; ++i) {
+        series[i] = ColumnBlockIO::seriesFromBlock(mapping, data, blocks[i]);
+        ColumnBlockIO::applyPointMetadata(series[i], pointMetadata[i]);
+    }
+
+    // 5. 组装曲线（setRawData 会把处理后数据重置为原始数据）
+    curve.setName(name);
+    curve.setProjectName(projectName.isEmpty() ? QFileInfo(filePath).fileName() : projectName);
+    curve.setInstrumentType(static_cast<InstrumentType>(instrumentType));
+    curve.setSignalType(static_cast<SignalType>(signalType));
+    curve.setPlotStyle(static_cast<PlotStyle>(plotStyle));
+    curve.setIsMainCurve(isMainCurve);
+    curve.setIsAuxiliaryCurve(isAuxiliaryCurve);
+    curve.setIsStronglyBound(isStronglyBound);
+    curve.setRawData(series[0]);
+    if (seriesCount > 1) {
+        curve.setProcessedData(series[1]);
+    }
+    curve.setMetadata(metadata);
+
+    qDebug() << "文件" << filePath << "已读取，点数:" << series[0].size() << (mapping->data ? "（内存映射）" : "");
+    return curve;
+}
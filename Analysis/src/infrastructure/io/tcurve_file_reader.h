@@ -0,0 +1,36 @@
+#ifndef TCURVEFILEREADER_H
+#define TCURVEFILEREADER_H
+
+#include "infrastructure/io/i_file_reader.h"
+
+/**
+ * @brief TCurveFileReader 读取二进制 .tcurve 曲线文件（格式见 tcurve_format.h）
+ *
+ * 文件被映射到内存，曲线的列数据直接引用映射区域（零拷贝），
+ * 因此重新打开大曲线只需校验文件头和解析元数据。
+ * 映射在曲线（及其所有共享副本）释放前保持有效，期间文件保持打开。
+ * 无法映射或在大端序平台上时退回为读取并复制列数据。
+ *
+ * .tcurve 文件自带列布局与单位，导入配置中的列映射等选项被忽略。
+ */
+class TCurveFileReader : public IFileReader {
+public:
+    /**
+     * @brief 检查是否可以读取指定文件
+     * @return 如果文件扩展名为 .tcurve 返回 true
+     */
+    bool canRead(const QString& filePath) const override;
+
+    /**
+     * @brief 读取 .tcurve 文件
+     * @param filePath 文件路径
+     * @param config 导入配置（忽略）
+     * @param progress 进度报告器（映射读取瞬间完成，不报告进度）
+     * @return 曲线对象；文件无效时返回不含数据的曲线
+     */
+    ThermalCurve read(const QString& filePath, const QVariantMap& config, IProgressReporter* progress = nullptr) const override;
+
+    QStringList supportedFormats() const override;
+};
+
+#endif // TCURVEFILEREADER_H
@@ -0,0 +1,91 @@
+#include "tcurve_file_writer.h"
+#include "domain/model/thermal_curve.h"
+#include "infrastructure/io/column_block_io.h"
+#include "infrastructure/io/tcurve_format.h"
+#include <QDataStream>
+#include <QDebug>
+#include <QSaveFile>
+#include <QtEndian>
+#include <cstring>
+
+bool TCurveFileWriter::write(const ThermalCurve& curve, const QString& filePath)
+{
+    m_errorString.clear();
+
+    // 1. 要写入的序列（处理后数据与原始数据共享缓冲区时只写一份）
+    const ThermalDataSeries& raw = curve.getRawData();
+    const ThermalDataSeries& processed = curve.getProcessedData();
+    QVector<const ThermalDataSeries*> series{ &raw };
+    if (!processed.isEmpty() && !processed.isSharedWith(raw)) {
+        series.append(&processed);
+    }
+
+    // 2. 元数据块
+    QByteArray metadataBlock;
+    {
+        QDataStream out(&metadataBlock, QIODevice::WriteOnly);
+        out.setVersion(QDataStream::Qt_5_12);
+        out.setByteOrder(QDataStream::LittleEndian);
+
+        const CurveMetadata& metadata = curve.getMetadata();
+        out << curve.name() << curve.projectName();
+        out << qint32(curve.instrumentType()) << qint32(curve.signalType()) << qint32(curve.plotStyle());
+        out << curve.isMainCurve() << curve.isAuxiliaryCurve() << curve.isStronglyBound();
+        out << metadata.device << metadata.sampleName << metadata.sampleMass << metadata.additional;
+        for (const ThermalDataSeries* s : series) {
+            out << ColumnBlockIO::collectPointMetadata(*s);
+        }
+    }
+
+    // 3. 文件头与列偏移
+    QByteArray header(int(TCurveFormat::HeaderSize), '\0');
+    uchar* h = reinterpret_cast<uchar*>(header.data());
+    std::memcpy(h, TCurveFormat::Magic, sizeof(TCurveFormat::Magic));
+    qToLittleEndian<quint32>(TCurveFormat::Version, h + TCurveFormat::VersionOffset);
+    qToLittleEndian<quint32>(quint32(series.size()), h + TCurveFormat::SeriesCountOffset);
+    qToLittleEndian<quint64>(quint64(TCurveFormat::HeaderSize), h + TCurveFormat::MetadataOffsetOffset);
+    qToLittleEndian<quint64>(quint64(metadataBlock.size()), h + TCurveFormat::MetadataSizeOffset);
+
+    QVector<qint64> columnOffsets;
+    qint64 offset = TCurveFormat::HeaderSize + metadataBlock.size();
+    for (int i = 0; i < series.size(); ++i) {
+        const qint64 columnBytes = qint64(series[i]->size()) * qint64(sizeof(double));
+        uchar* entry = h + TCurveFormat::SeriesTableOffset + i * TCurveFormat::SeriesEntrySize;
+        qToLittleEndian<quint64>(quint64(series[i]->size()), entry);
+        for (int column = 0; column < 3; ++column) {
+            offset = TCurveFormat::alignColumn(offset);
+            qToLittleEndian<quint64>(quint64(offset), entry + 8 * (column + 1));
+            columnOffsets.append(offset);
+            offset += columnBytes;
+        }
+    }
+
+    // 4. 写入文件（先写临时文件，成功后替换目标文件；目标文件正被映射时先改为持有副本）
+    ColumnBlockIO::releaseMappings(filePath);
+    QSaveFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        m_errorString = file.errorString();
+        qWarning() << "TCurveFileWriter: 无法创建文件:" << filePath << m_errorString;
+        return false;
+    }
+
+    bool ok = file.write(header) == header.size() && file.write(metadataBlock) == metadataBlock.size();
+    for (int i = 0; i < series.size(); ++i) {
+        ok = ok && ColumnBlockIO::writeSeries(file, *series[i], columnOffsets.constData() + 3 * i);
+    }
+
+    if (!ok) {
+        m_errorString = file.errorString();
+        file.cancelWriting();
+        qWarning() << "TCurveFileWriter: 写入失败:" << filePath << m_errorString;
+        return false;
+    }
+    if (!file.commit()) {
+        m_errorString = file.errorString();
+        qWarning() << "TCurveFileWriter: 保存失败:" << filePath << m_errorString;
+        return false;
+    }
+
+    qDebug() << "TCurveFileWriter: 已保存曲线" << curve.name() << "到" << filePath << "点数:" << raw.size();
+    return true;
+}
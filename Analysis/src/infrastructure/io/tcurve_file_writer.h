@@ -0,0 +1,33 @@
+#ifndef TCURVEFILEWRITER_H
+#define TCURVEFILEWRITER_H
+
+#include <QString>
+
+class ThermalCurve;
+
+/**
+ * @brief TCurveFileWriter 将曲线写为二进制 .tcurve 文件（格式见 tcurve_format.h）
+ *
+ * 写入原始数据；处理后数据与原始数据不共享时一并写入。
+ * 通过 QSaveFile 先写临时文件再替换，写入失败不会破坏已有文件。
+ */
+class TCurveFileWriter {
+public:
+    /**
+     * @brief 写入曲线
+     * @param curve 要保存的曲线
+     * @param filePath 目标文件路径
+     * @return 成功返回 true，失败时可通过 errorString() 获取原因
+     */
+    bool write(const ThermalCurve& curve, const QString& filePath);
+
+    /**
+     * @brief 最近一次写入失败的原因
+     */
+    QString errorString() const { return m_errorString; }
+
+private:
+    QString m_errorString;
+};
+
+#endif // TCURVEFILEWRITER_H
@@ -0,0 +1,48 @@
+#ifndef TCURVEFORMAT_H
+#define TCURVEFORMAT_H
+
+#include <QtGlobal>
+
+/**
+ * @brief .tcurve 二进制曲线文件格式（所有整数与浮点数均为小端序）
+ *
+ * 布局：
+ * @code
+ * 偏移  大小  内容
+ * 0     8     魔数 "TCURVE\r\n"
+ * 8     4     格式版本（quint32）
+ * 12    4     序列数 seriesCount（1=仅原始数据，2=原始数据 + 处理后数据）
+ * 16    8     元数据块偏移（quint64）
+ * 24    8     元数据块大小（quint64）
+ * 32    32×2  序列表：每项为 点数、温度列偏移、时间列偏移、测量值列偏移（均为 quint64）
+ * 96    ...   元数据块（QDataStream，Qt 5.12 格式，小端序）
+ *       ...   各列数据（double 数组，起始偏移按 64 字节对齐）
+ * @endcode
+ *
+ * 列按 64 字节对齐，映射到内存后可直接作为 double 数组使用（零拷贝）。
+ */
+namespace TCurveFormat {
+    inline constexpr char Magic[8] = { 'T', 'C', 'U', 'R', 'V', 'E', '\r', '\n' };
+    inline constexpr quint32 Version = 1;
+    inline constexpr int MaxSeries = 2;
+    inline constexpr qint64 HeaderSize = 96;
+    inline constexpr qint64 ColumnAlignment = 64;
+
+    // 文件头字段偏移
+    inline constexpr qint64 VersionOffset = 8;
+    inline constexpr qint64 SeriesCountOffset = 12;
+    inline constexpr qint64 MetadataOffsetOffset = 16;
+    inline constexpr qint64 MetadataSizeOffset = 24;
+    inline constexpr qint64 SeriesTableOffset = 32;
+    inline constexpr qint64 SeriesEntrySize = 32;
+
+    /**
+     * @brief 向上对齐到列对齐边界
+     */
+    inline qint64 alignColumn(qint64 offset)
+    {
+        return (offset + ColumnAlignment - 1) / ColumnAlignment * ColumnAlignment;
+    }
+}
+
+#endif // TCURVEFORMAT_H
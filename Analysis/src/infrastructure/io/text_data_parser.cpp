@@ -0,0 +1,336 @@
+#include "text_data_parser.h"
+#include <QChar>
+#include <QString>
+#include <QTextCodec>
+#include <QtGlobal>
+#include <cstring>
+#include <utility>
+
+// 浮点 std::from_chars 需要较新的标准库（libstdc++ 11+、MSVC 2019+）；
+// 旧工具链（如 MinGW 7.3）退回到下面的手写快速路径
+#if defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+#endif
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#define TEXT_DATA_PARSER_HAS_FROM_CHARS 1
+#else
+#define TEXT_DATA_PARSER_HAS_FROM_CHARS 0
+#endif
+
+namespace {
+
+// 与 QString::trimmed() 对 ASCII 空白的定义一致
+inline bool isSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+}
+
+inline bool isAsciiLetter(unsigned char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+#if !TEXT_DATA_PARSER_HAS_FROM_CHARS
+// 10^0 .. 10^22 均可用 double 精确表示
+const double kExactPowersOf10[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+/**
+ * @brief 十进制快速路径（Clinger）：尾数不超过 2^53 且指数在 ±22 以内时，
+ *        一次乘/除即得到正确舍入的结果
+ * @return 格式不符合或超出快速路径范围时返回 false（由调用方回退）
+ */
+bool parseDecimalFast(const char* p, const char* last, double& value)
+{
+    bool negative = false;
+    if (p < last && (*p == '+' || *p == '-')) {
+        negative = (*p == '-');
+        ++p;
+    }
+
+    quint64 mantissa = 0;
+    int significantDigits = 0;
+    int exponent = 0;
+    bool anyDigit = false;
+
+    for (; p < last && *p >= '0' && *p <= '9'; ++p) {
+        anyDigit = true;
+        if (mantissa == 0 && *p == '0') {
+            continue; // 前导零
+        }
+        if (significantDigits >= 19) {
+            return false;
+        }
+        mantissa = mantissa * 10 + quint64(*p - '0');
+        ++significantDigits;
+    }
+
+    if (p < last && *p == '.') {
+        for (++p; p < last && *p >= '0' && *p <= '9'; ++p) {
+            anyDigit = true;
+            if (mantissa == 0 && *p == '0') {
+                --exponent; // 小数点后的前导零
+                continue;
+            }
+            if (significantDigits >= 19) {
+                return false;
+            }
+            mantissa = mantissa * 10 + quint64(*p - '0');
+            ++significantDigits;
+            --exponent;
+        }
+    }
+
+    if (!anyDigit) {
+        return false;
+    }
+
+    if (p < last && (*p == 'e' || *p == 'E')) {
+        ++p;
+        bool negativeExponent = false;
+        if (p < last && (*p == '+' || *p == '-')) {
+            negativeExponent = (*p == '-');
+            ++p;
+        }
+        if (p == last || *p < '0' || *p > '9') {
+            return false;
+        }
+        int e = 0;
+        for (; p < last && *p >= '0' && *p <= '9'; ++p) {
+            if (e < 10000) {
+                e = e * 10 + (*p - '0');
+            }
+        }
+        exponent += negativeExponent ? -e : e;
+    }
+
+    if (p != last) {
+        return false;
+    }
+
+    if (mantissa == 0) {
+        value = negative ? -0.0 : 0.0;
+        return true;
+    }
+    if (mantissa > (quint64(1) << 53) || exponent < -22 || exponent > 22) {
+        return false;
+    }
+
+    double result = double(mantissa);
+    result = exponent < 0 ? result / kExactPowersOf10[-exponent] : result * kExactPowersOf10[exponent];
+    value = negative ? -result : result;
+    return true;
+}
+#endif
+
+} // namespace
+
+TextDataParser::TextDataParser(const TextColumnLayout& layout)
+    : m_layout(layout)
+    , m_headerCodec(QTextCodec::codecForName(layout.utf8Text ? "UTF-8" : "GBK"))
+{
+    m_columns[0] = layout.timeColumn;
+    m_columns[1] = layout.tempIsFixed ? -1 : layout.tempColumn;
+    m_columns[2] = layout.signalColumn;
+    m_lastColumn = qMax(m_columns[0], qMax(m_columns[1], m_columns[2]));
+}
+
+void TextDataParser::reserve(int lineCount)
+{
+    m_temperatures.reserve(lineCount);
+    m_times.reserve(lineCount);
+    m_values.reserve(lineCount);
+}
+
+void TextDataParser::startMidStream(bool utf8Bom)
+{
+    m_atStart = false;
+    if (utf8Bom) {
+        m_headerCodec = QTextCodec::codecForName("UTF-8");
+    }
+}
+
+void TextDataParser::feed(const char* data, qint64 size)
+{
+    const char* cursor = data;
+    const char* const end = data + size;
+
+    // 跳过 UTF-8 BOM（与 QTextStream 的自动识别一致），中文表头随之按 UTF-8 判断。
+    // BOM 可能被切在前几块之间：与 BOM 相符的前缀先存入 m_carry，凑够 3 个字节或出现不符的字节后再判断；
+    // 不是 BOM 时这些字节就是第一行的开头，留在 m_carry 中照常拼接
+    if (m_atStart) {
+        static const char kUtf8Bom[] = "\xEF\xBB\xBF";
+        while (cursor < end && m_carry.size() < 3 && *cursor == kUtf8Bom[m_carry.size()]) {
+            m_carry.append(*cursor++);
+        }
+        if (m_carry.size() == 3) {
+            m_carry.clear();
+            m_atStart = false;
+            m_headerCodec = QTextCodec::codecForName("UTF-8");
+        } else if (cursor < end) {
+            m_atStart = false;
+        } else {
+            return; // 还不能确定是否为 BOM
+        }
+    }
+
+    // 先补全上一块遗留的不完整行
+    if (!m_carry.isEmpty()) {
+        const char* newline = static_cast<const char*>(std::memchr(cursor, '\n', size_t(end - cursor)));
+        if (!newline) {
+            m_carry.append(cursor, int(end - cursor));
+            return;
+        }
+        m_carry.append(cursor, int(newline - cursor));
+        parseLine(m_carry.constData(), m_carry.constData() + m_carry.size());
+        m_carry.clear();
+        cursor = newline + 1;
+    }
+
+    while (cursor < end) {
+        const char* newline = static_cast<const char*>(std::memchr(cursor, '\n', size_t(end - cursor)));
+        if (!newline) {
+            m_carry.append(cursor, int(end - cursor));
+            return;
+        }
+        parseLine(cursor, newline);
+        cursor = newline + 1;
+    }
+}
+
+void TextDataParser::finish()
+{
+    if (!m_carry.isEmpty()) {
+        parseLine(m_carry.constData(), m_carry.constData() + m_carry.size());
+        m_carry.clear();
+    }
+}
+
+ThermalDataSeries TextDataParser::takeSeries()
+{
+    return ThermalDataSeries::fromColumns(std::move(m_temperatures), std::move(m_times), std::move(m_values));
+}
+
+bool TextDataParser::parseDouble(const char* first, const char* last, double& value)
+{
+    if (first == last) {
+        return false;
+    }
+
+#if TEXT_DATA_PARSER_HAS_FROM_CHARS
+    // from_chars 不接受前导 '+'
+    const char* p = first;
+    if (*p == '+') {
+        ++p;
+        if (p == last || *p == '-') {
+            return false;
+        }
+    }
+    const auto result = std::from_chars(p, last, value);
+    if (result.ec == std::errc() && result.ptr == last) {
+        return true;
+    }
+#else
+    if (parseDecimalFast(first, last, value)) {
+        return true;
+    }
+#endif
+
+    // 超长尾数、极端指数、inf/nan 等少见格式：交给 Qt（C 区域，结果与 QString::toDouble 一致）
+    bool ok = false;
+    const double parsed = QByteArray::fromRawData(first, int(last - first)).toDouble(&ok);
+    if (ok) {
+        value = parsed;
+    }
+    return ok;
+}
+
+bool TextDataParser::isDataLine(const char* begin, const char* end, QTextCodec* headerCodec)
+{
+    const unsigned char first = static_cast<unsigned char>(*begin);
+    if (first < 0x80) {
+        // ASCII：字母开头为表头，其余（数字、符号）为数据行
+        return !isAsciiLetter(first) && first != 0;
+    }
+
+    // 非 ASCII 开头（通常是中文表头）：只解码开头几个字节判断首字符
+    if (!headerCodec) {
+        return false;
+    }
+    const QString head = headerCodec->toUnicode(begin, int(qMin<qptrdiff>(end - begin, 4)));
+    return !head.isEmpty() && !head.at(0).isLetter();
+}
+
+const char* TextDataParser::splitField(const char* field, const char* end, char separator, const char** fieldEnd)
+{
+    if (separator != 0) {
+        const char* found = static_cast<const char*>(std::memchr(field, separator, size_t(end - field)));
+        *fieldEnd = found ? found : end;
+        return found ? found + 1 : nullptr; // 末尾分隔符之后是一个空字段
+    }
+
+    const char* cursor = field;
+    while (cursor < end && !isSpace(*cursor)) {
+        ++cursor;
+    }
+    *fieldEnd = cursor;
+    if (cursor == end) {
+        return nullptr;
+    }
+    while (isSpace(*cursor)) {
+        ++cursor;
+    }
+    return cursor;
+}
+
+void TextDataParser::parseLine(const char* begin, const char* end)
+{
+    while (begin < end && isSpace(*begin)) {
+        ++begin;
+    }
+    while (end > begin && isSpace(end[-1])) {
+        --end;
+    }
+    if (begin == end || !isDataLine(begin, end, m_headerCodec)) {
+        return;
+    }
+
+    double parsed[3] = { 0.0, 0.0, 0.0 };
+    bool ok[3] = { false, false, false };
+
+    // 逐字段扫描到需要的最大列为止；GBK 多字节字符的尾字节不会是空白、逗号或分号，按字节切分是安全的
+    const char* field = begin;
+    for (int column = 0; column <= m_lastColumn; ++column) {
+        const char* fieldEnd = field;
+        const char* next = splitField(field, end, m_layout.separator, &fieldEnd);
+
+        for (int k = 0; k < 3; ++k) {
+            if (m_columns[k] != column) {
+                continue;
+            }
+            // CSV 字段可能带空白（QString::toDouble 同样忽略首尾空白）
+            const char* first = field;
+            const char* last = fieldEnd;
+            while (first < last && isSpace(*first)) {
+                ++first;
+            }
+            while (last > first && isSpace(last[-1])) {
+                --last;
+            }
+            ok[k] = parseDouble(first, last, parsed[k]);
+        }
+
+        if (!next) {
+            break;
+        }
+        field = next;
+    }
+
+    m_times.append(ok[0] ? parsed[0] * m_layout.timeFactor : 0.0);
+    m_temperatures.append(ok[1] ? parsed[1] + m_layout.tempOffset : m_layout.tempFixedValue);
+    m_values.append(ok[2] ? parsed[2] : 0.0);
+}
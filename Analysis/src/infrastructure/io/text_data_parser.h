@@ -0,0 +1,120 @@
+#ifndef TEXTDATAPARSER_H
+#define TEXTDATAPARSER_H
+
+#include "domain/model/thermal_data_series.h"
+#include <QByteArray>
+#include <QVector>
+
+class QTextCodec;
+
+/**
+ * @brief 文本数据文件的列布局与单位换算（由导入配置解析得到）
+ */
+struct TextColumnLayout {
+    int timeColumn = -1;          //!< 时间列索引（<0 表示无）
+    int tempColumn = -1;          //!< 温度列索引（<0 表示无）
+    int signalColumn = -1;        //!< 信号列索引（<0 表示无）
+    bool tempIsFixed = false;     //!< 温度是否使用固定值
+    double tempFixedValue = 0.0;  //!< 固定温度（温度列缺失或无法解析时也使用此值）
+    double timeFactor = 1.0;      //!< 时间换算为秒的系数
+    double tempOffset = 0.0;      //!< 温度换算为 °C 的偏移
+    char separator = 0;           //!< 字段分隔符（',' 或 ';'），0 表示空白分隔
+    bool utf8Text = false;        //!< 无 BOM 的文件按 UTF-8 判断中文表头（否则按 GBK）
+};
+
+/**
+ * @brief 字节级文本数据解析器
+ *
+ * 直接在原始字节上逐行扫描，不做 UTF-16 转换、不使用正则表达式：
+ * - 以 ASCII 字母开头的行视为表头并跳过；
+ * - 以非 ASCII 字节开头的行才按文件编码（GBK 或 UTF-8，见 TextColumnLayout::utf8Text）解码首字符
+ *   判断是否为表头（中文表头）；文件以 UTF-8 BOM 开头时跳过 BOM，并改按 UTF-8 解码；
+ * - 其余行为数据行，只对布局中用到的列做数值解析，结果直接写入列缓冲区。
+ *
+ * 输入可以分块提供（feed() 可多次调用，跨块的行会自动拼接），
+ * 也可以由多个解析器分别解析同一文件中按行切开的各段（见 startMidStream()）；
+ * 行的判定、缺失列与解析失败时的取值规则与 QString 逐行解析的旧实现一致。
+ */
+class TextDataParser {
+public:
+    explicit TextDataParser(const TextColumnLayout& layout);
+
+    /**
+     * @brief 预分配列缓冲区
+     * @param lineCount 预计的数据行数
+     */
+    void reserve(int lineCount);
+
+    /**
+     * @brief 声明输入从文件中间的某个行首开始（并行分段解析时用于第一段之外的各段）
+     *
+     * 之后的输入不再检查 UTF-8 BOM，中文表头按文件开头确定的编码判断。
+     * 必须在第一次 feed() 之前调用。
+     *
+     * @param utf8Bom 文件是否以 UTF-8 BOM 开头
+     */
+    void startMidStream(bool utf8Bom);
+
+    /**
+     * @brief 输入一块字节数据（可多次调用）
+     */
+    void feed(const char* data, qint64 size);
+
+    /**
+     * @brief 结束输入，解析最后一行（文件末尾没有换行时）
+     */
+    void finish();
+
+    /**
+     * @brief 已解析的数据行数
+     */
+    int rowCount() const { return m_values.size(); }
+
+    /**
+     * @brief 取出解析结果（零拷贝移动列缓冲区，之后解析器为空）
+     *
+     * 之后仍可继续 feed()：尚未结束的不完整行保留在解析器中，新解析的行从空缓冲区开始，
+     * 跟随读取追加内容时据此每次只取出增量。
+     */
+    ThermalDataSeries takeSeries();
+
+    /**
+     * @brief 将完整的数值字段解析为 double（C 语言区域格式，与 QString::toDouble 接受的格式一致）
+     *
+     * 工具链支持浮点 std::from_chars 时直接使用；否则先走精确的快速路径
+     * （有效数字不超过 19 位且十进制指数在 ±22 以内），其余情况交给 QByteArray::toDouble。
+     *
+     * @return 字段为空或不是完整的数值时返回 false
+     */
+    static bool parseDouble(const char* first, const char* last, double& value);
+
+    /**
+     * @brief 判断已去除首尾空白的非空行是否为数据行（非字母开头）
+     * @param headerCodec 非 ASCII 开头时用于解码首字符的编码（为空时视为表头）
+     */
+    static bool isDataLine(const char* begin, const char* end, QTextCodec* headerCodec);
+
+    /**
+     * @brief 切出从 field 开始的一个字段（所在行已去除首尾空白）
+     * @param separator 字段分隔符，0 表示空白分隔（连续空白视为一个分隔）
+     * @param fieldEnd 输出字段结尾（不含分隔符）
+     * @return 下一个字段的开头；已是最后一个字段时返回 nullptr
+     */
+    static const char* splitField(const char* field, const char* end, char separator, const char** fieldEnd);
+
+private:
+    void parseLine(const char* begin, const char* end);
+
+    TextColumnLayout m_layout;
+    int m_columns[3];      // 时间/温度/信号需要读取的列（温度固定时为 -1）
+    int m_lastColumn = -1; // 需要读取的最大列索引，之后的字段不再扫描
+    QTextCodec* m_headerCodec = nullptr;
+    QByteArray m_carry;    // 跨块的不完整行
+    bool m_atStart = true; // 尚未处理任何输入（用于识别 UTF-8 BOM）
+
+    QVector<double> m_temperatures;
+    QVector<double> m_times;
+    QVector<double> m_values;
+};
+
+#endif // TEXTDATAPARSER_H
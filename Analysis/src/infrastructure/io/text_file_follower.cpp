@@ -0,0 +1,71 @@
+#include "text_file_follower.h"
+#include "infrastructure/io/text_file_reader.h"
+#include <QDebug>
+#include <cstring>
+
+namespace {
+
+// 单次 poll() 最多读取的字节数，追加很快时分多次读完，避免一次占用过多内存
+const qint64 kMaxPollBytes = 16 * 1024 * 1024;
+
+} // namespace
+
+TextFileFollower::TextFileFollower(const QString& filePath, const QVariantMap& config, qint64 offset)
+    : m_file(filePath)
+    , m_parser(TextFileReader::columnLayout(filePath, config))
+    , m_massPercentBase(TextFileReader::massPercentBase(config))
+    , m_offset(qMax<qint64>(0, offset))
+{
+}
+
+IFileFollower::PollResult TextFileFollower::poll(ThermalDataSeries* appended)
+{
+    if (!m_file.isOpen() && !m_file.open(QIODevice::ReadOnly | QIODevice::Unbuffered)) {
+        m_errorString = m_file.errorString();
+        return PollResult::Failed;
+    }
+
+    // 从文件中间开始时，中文表头按文件开头的编码判断
+    if (!m_started && m_offset > 0) {
+        const QByteArray bom = m_file.read(3);
+        m_parser.startMidStream(bom.size() == 3 && std::memcmp(bom.constData(), "\xEF\xBB\xBF", 3) == 0);
+    }
+    m_started = true;
+
+    const qint64 fileSize = m_file.size();
+    if (fileSize < m_offset) {
+        m_errorString = QStringLiteral("文件被截断或重写");
+        return PollResult::Truncated;
+    }
+    if (fileSize == m_offset) {
+        return PollResult::Unchanged;
+    }
+
+    if (!m_file.seek(m_offset)) {
+        m_errorString = m_file.errorString();
+        return PollResult::Failed;
+    }
+    const QByteArray block = m_file.read(qMin(fileSize - m_offset, kMaxPollBytes));
+    if (block.isEmpty()) {
+        return PollResult::Unchanged;
+    }
+    m_parser.feed(block.constData(), block.size());
+    m_offset += block.size();
+
+    // 取出已完整解析的行，末尾不完整的行留在解析器中等待后续字节
+    ThermalDataSeries rows = m_parser.takeSeries();
+    if (rows.isEmpty()) {
+        return PollResult::Unchanged;
+    }
+    if (m_massPercentBase > 0.0) {
+        QVector<double> values = rows.valueColumn();
+        for (double& value : values) {
+            // 质量损失百分比 = (当前质量 / 初始质量) * 100
+            value = (value / m_massPercentBase) * 100.0;
+        }
+        rows = rows.withValues(std::move(values));
+    }
+
+    *appended = rows;
+    return PollResult::Appended;
+}
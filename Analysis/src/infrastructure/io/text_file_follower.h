@@ -0,0 +1,40 @@
+#ifndef TEXTFILEFOLLOWER_H
+#define TEXTFILEFOLLOWER_H
+
+#include "infrastructure/io/i_file_reader.h"
+#include "infrastructure/io/text_data_parser.h"
+#include <QFile>
+
+/**
+ * @brief TextFileFollower 跟随读取仍在被仪器追加写入的文本数据文件
+ *
+ * 从初次导入已解析到的位置开始，每次 poll() 只读取新追加的字节并交给同一个
+ * TextDataParser 继续解析（跨次读取的不完整行由解析器保留），不重新读取已解析的部分。
+ * 列映射、单位换算与质量百分比换算与 TextFileReader::read() 一致。
+ *
+ * 文件以无缓冲方式保持打开（读写共享），每次按当前文件大小读取，
+ * 不依赖文件系统通知（Windows 上被其他进程持续写入的文件往往不会触发通知）。
+ */
+class TextFileFollower : public IFileFollower {
+public:
+    /**
+     * @param filePath 文件路径
+     * @param config 与初次导入相同的导入配置
+     * @param offset 初次导入已解析的字节数（位于行首）
+     */
+    TextFileFollower(const QString& filePath, const QVariantMap& config, qint64 offset);
+
+    PollResult poll(ThermalDataSeries* appended) override;
+
+    QString errorString() const override { return m_errorString; }
+
+private:
+    QFile m_file;
+    TextDataParser m_parser;
+    double m_massPercentBase = 0.0; // 质量百分比换算的初始质量（0 表示不换算）
+    qint64 m_offset = 0;            // 已读取的字节数
+    bool m_started = false;         // 是否已确定文件编码并开始解析
+    QString m_errorString;
+};
+
+#endif // TEXTFILEFOLLOWER_H
@@ -1,92 +1,315 @@
 #include "text_file_reader.h"
+#include "domain/algorithm/i_progress_reporter.h"
 #include "domain/model/thermal_curve.h"
+#include "infrastructure/io/text_data_parser.h"
+#include "infrastructure/io/text_file_follower.h"
+#include "infrastructure/io/text_format_sniffer.h"
 #include <QDebug>
-#include <QRegularExpression>
 #include <QFile>
 #include <QFileInfo>
-#include <QTextStream>
+#include <QThread>
+#include <QThreadPool>
+#include <QRunnable>
 #include <QUuid>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <limits>
+#include <vector>
 
-TextFileReader::TextFileReader() { qDebug() << "构造:  TextFileReader"; }
+namespace {
 
-QStringList TextFileReader::supportedFormats() const
+// 顺序读取的块大小
+const qint64 kReadBlockBytes = 4 * 1024 * 1024;
+
+// QVector 分配中数据之前的头部预留（Qt 5 的 QArrayData 头部不超过此值）
+const qint64 kColumnHeaderBytes = 64;
+
+// 并行解析时每段的最小字节数，文件更小时分段与拼接的开销超过并行收益
+const qint64 kMinParallelChunkBytes = 16 * 1024 * 1024;
+
+/**
+ * @brief 用开头一段数据的平均行长估算总行数，避免列缓冲区反复扩容
+ * @return 样本中没有换行时返回 0（不预分配）
+ */
+int estimateLineCount(const char* sample, qint64 sampleSize, qint64 totalSize)
 {
-    return { "Text Files (*.txt)", "Comma-Separated Values (*.csv)", "All Files (*)" };
+    const qint64 lines = std::count(sample, sample + sampleSize, '\n');
+    if (lines == 0) {
+        return 0;
+    }
+    const qint64 estimate = totalSize / qMax<qint64>(1, sampleSize / lines) + 1;
+    return int(qMin<qint64>(estimate, std::numeric_limits<int>::max() / 2));
 }
 
-bool TextFileReader::canRead(const QString& filePath) const
+/**
+ * @brief 按字节数报告解析进度（百分比变化时才报告）
+ * @return 调用方请求取消时返回 false
+ */
+bool reportBytesParsed(IProgressReporter* progress, qint64 parsedBytes, qint64 totalBytes, int& lastPercentage)
 {
-    return filePath.endsWith(".txt", Qt::CaseInsensitive) || filePath.endsWith(".csv", Qt::CaseInsensitive);
+    if (!progress) {
+        return true;
+    }
+    if (progress->shouldCancel()) {
+        return false;
+    }
+    const int percentage = totalBytes > 0 ? int(parsedBytes * 100 / totalBytes) : 100;
+    if (percentage != lastPercentage) {
+        lastPercentage = percentage;
+        progress->reportProgress(percentage, QStringLiteral("正在解析数据..."));
+    }
+    return true;
 }
 
-FilePreviewData TextFileReader::readPreview(const QString& filePath) const
+/**
+ * @brief 文件开头只包含完整行的部分的长度（最后一个换行符之后的不完整行仍在写入中）
+ */
+qint64 completeLinesSize(QFile& file, qint64 fileSize)
 {
-    FilePreviewData previewData;
-    QFile file(filePath);
-    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
-        qWarning() << "无法打开文件进行预览:" << filePath << file.errorString();
-        return previewData;
+    QByteArray block;
+    qint64 end = fileSize;
+    while (end > 0) {
+        const qint64 begin = qMax<qint64>(0, end - 64 * 1024);
+        if (!file.seek(begin)) {
+            break;
+        }
+        block = file.read(end - begin);
+        const int newline = block.lastIndexOf('\n');
+        if (newline >= 0) {
+            end = begin + newline + 1;
+            break;
+        }
+        end = begin;
     }
+    file.seek(0);
+    return end;
+}
 
-    QTextStream in(&file);
-    // 强制按 GBK 解码文本，避免受系统本地编码影响
-    in.setCodec("GBK");
+/**
+ * @brief 按块顺序读取并解析文件开头的 fileSize 字节
+ * @param dataOffset 首个数据行的偏移（之前的表头区不再读取）
+ * @return 解析结果；被取消时返回空序列
+ */
+ThermalDataSeries readSequential(QFile& file, qint64 dataOffset, qint64 fileSize, bool utf8Bom, const TextColumnLayout& layout,
+                                 IProgressReporter* progress)
+{
+    TextDataParser parser(layout);
+    if (dataOffset > 0) {
+        parser.startMidStream(utf8Bom);
+        file.seek(dataOffset);
+    }
+    QByteArray block(int(qMin(kReadBlockBytes, qMax<qint64>(fileSize, 1))), Qt::Uninitialized);
+
+    bool reserved = false;
+    qint64 bytesRead = 0;
+    qint64 totalRead = dataOffset;
+    int lastPercentage = -1;
+    while (totalRead < fileSize && (bytesRead = file.read(block.data(), qMin<qint64>(block.size(), fileSize - totalRead))) > 0) {
+        if (!reserved) {
+            reserved = true;
+            if (bytesRead < fileSize - dataOffset) {
+                parser.reserve(estimateLineCount(block.constData(), bytesRead, fileSize - dataOffset));
+            }
+        }
+        parser.feed(block.constData(), bytesRead);
 
-    QStringList headerLines;
-    QStringList dataLines;
-    int lineCount = 0;
+        totalRead += bytesRead;
+        if (!reportBytesParsed(progress, totalRead, fileSize, lastPercentage)) {
+            return ThermalDataSeries();
+        }
+    }
+    parser.finish();
 
-    // 读取最多30行作为预览
-    while (!in.atEnd() && lineCount < 30) {
-        const QString line = in.readLine();
-        previewData.previewContent.append(line + "\n");
+    if (bytesRead < 0) {
+        qWarning() << "读取文件失败:" << file.fileName() << file.errorString();
+    }
+    return parser.takeSeries();
+}
 
-        const QString t = line.trimmed();
-        if (t.isEmpty())
-            continue;
+/**
+ * @brief 并行解析各段共享的进度与取消标志
+ */
+struct ParseProgress {
+    std::atomic<qint64> parsedBytes{ 0 };
+    std::atomic<bool> aborted{ false };
+};
+
+/**
+ * @brief 并行解析的一段输入及其结果
+ */
+struct ParseChunk {
+    const char* begin = nullptr;
+    const char* end = nullptr;
+    bool isFirst = false;
+    ThermalDataSeries series;
+};
+
+/**
+ * @brief 在线程池中解析一段输入（每段使用独立的解析器，只共享进度计数）
+ */
+class ParseChunkTask : public QRunnable {
+public:
+    ParseChunkTask(const TextColumnLayout& layout, bool utf8Bom, ParseChunk* chunk, ParseProgress* progress)
+        : m_layout(layout)
+        , m_utf8Bom(utf8Bom)
+        , m_chunk(chunk)
+        , m_progress(progress)
+    {
+    }
 
-        QChar c = t.at(0);
-        if (c.isLetter() || (c.unicode() >= 0x4e00 && c.unicode() <= 0x9fff)) {
-            headerLines.append(t);
-        } else {
-            dataLines.append(t);
+    void run() override
+    {
+        const qint64 size = m_chunk->end - m_chunk->begin;
+        TextDataParser parser(m_layout);
+        if (!m_chunk->isFirst) {
+            parser.startMidStream(m_utf8Bom);
+        }
+        parser.reserve(estimateLineCount(m_chunk->begin, qMin(size, kReadBlockBytes), size));
+
+        // 按读取块大小分批输入，以便汇报进度并及时响应取消（按偏移量循环，指针不会越过段尾）
+        for (qint64 offset = 0; offset < size; offset += kReadBlockBytes) {
+            if (m_progress->aborted.load(std::memory_order_relaxed)) {
+                return;
+            }
+            const qint64 length = qMin(kReadBlockBytes, size - offset);
+            parser.feed(m_chunk->begin + offset, length);
+            m_progress->parsedBytes.fetch_add(length, std::memory_order_relaxed);
         }
-        lineCount++;
-    }
-
-    previewData.header = headerLines.join("\n");
-
-    // 从最后一行表头中提取列名
-    if (!headerLines.isEmpty()) {
-        const bool isCsv = filePath.endsWith(".csv", Qt::CaseInsensitive);
-        const QStringList headerCols
-            = isCsv ? headerLines.last().split(',') : headerLines.last().split(QRegularExpression("\\s+"), Qt::SkipEmptyParts);
-        previewData.columns.reserve(headerCols.size());
-        for (int i = 0; i < headerCols.size(); ++i) {
-            FilePreviewColumn column;
-            column.index = i;
-            column.label = headerCols.at(i).trimmed();
-            previewData.columns.append(column);
+        parser.finish();
+        m_chunk->series = parser.takeSeries();
+    }
+
+private:
+    TextColumnLayout m_layout;
+    bool m_utf8Bom;
+    ParseChunk* m_chunk;
+    ParseProgress* m_progress;
+};
+
+/**
+ * @brief 将内存中的文件按行边界切成 chunkCount 段并行解析，再按原顺序拼接列数据
+ *
+ * 从 dataOffset（首个数据行）开始切分，表头区不参与解析。
+ * 进度由调用线程在等待期间统一汇报，工作线程不直接访问 progress。
+ *
+ * @return 解析结果；被取消时返回空序列
+ */
+ThermalDataSeries parseMappedParallel(const char* data, qint64 dataOffset, qint64 size, const TextColumnLayout& layout,
+                                      int chunkCount, IProgressReporter* progress)
+{
+    const char* const end = data + size;
+    const bool utf8Bom = size >= 3 && std::memcmp(data, "\xEF\xBB\xBF", 3) == 0;
+    const char* const dataBegin = data + dataOffset;
+    const qint64 dataSize = size - dataOffset;
+
+    // 每个切分点向后移到下一行的行首，保证没有行被切开
+    std::vector<ParseChunk> chunks;
+    chunks.reserve(size_t(chunkCount));
+    const char* chunkBegin = dataBegin;
+    for (int i = 1; i <= chunkCount && chunkBegin < end; ++i) {
+        const char* chunkEnd = end;
+        if (i < chunkCount) {
+            const char* target = qMax(chunkBegin, dataBegin + dataSize / chunkCount * i);
+            const char* newline = static_cast<const char*>(std::memchr(target, '\n', size_t(end - target)));
+            chunkEnd = newline ? newline + 1 : end;
         }
-    } else if (!dataLines.isEmpty()) {
-        // 如果没有表头，则根据第一行数据列数生成默认列名
-        const bool isCsv = filePath.endsWith(".csv", Qt::CaseInsensitive);
-        const int colCount
-            = isCsv ? dataLines.first().count(',') + 1 : dataLines.first().split(QRegularExpression("\\s+"), Qt::SkipEmptyParts).size();
-        previewData.columns.reserve(colCount);
-        for (int i = 0; i < colCount; ++i) {
-            FilePreviewColumn column;
-            column.index = i;
-            column.label = QStringLiteral("列 %1").arg(i + 1);
-            previewData.columns.append(column);
+        ParseChunk chunk;
+        chunk.begin = chunkBegin;
+        chunk.end = chunkEnd;
+        chunk.isFirst = (i == 1 && dataOffset == 0);
+        chunks.push_back(chunk);
+        chunkBegin = chunkEnd;
+    }
+
+    ParseProgress shared;
+    QThreadPool pool;
+    pool.setMaxThreadCount(int(chunks.size()));
+    for (ParseChunk& chunk : chunks) {
+        pool.start(new ParseChunkTask(layout, utf8Bom, &chunk, &shared));
+    }
+
+    int lastPercentage = -1;
+    while (!pool.waitForDone(100)) {
+        if (!shared.aborted.load() && !reportBytesParsed(progress, shared.parsedBytes.load(), dataSize, lastPercentage)) {
+            shared.aborted.store(true);
         }
     }
+    if (shared.aborted.load()) {
+        return ThermalDataSeries();
+    }
 
-    file.close();
+    if (chunks.size() == 1) {
+        return chunks.front().series;
+    }
+
+    // 按段顺序拼接列缓冲区，每段拷贝完立即释放。
+    // 各段行数之和可能超出 int；QVector 单次分配又限制在 INT_MAX 字节以内，超出时放弃而不是溢出
+    qint64 rowCount = 0;
+    for (const ParseChunk& chunk : chunks) {
+        rowCount += chunk.series.size();
+    }
+    const qint64 maxRows = (qint64(std::numeric_limits<int>::max()) - kColumnHeaderBytes) / qint64(sizeof(double));
+    if (rowCount > maxRows) {
+        qWarning() << "TextFileReader: 数据行数" << rowCount << "超出单列容量上限" << maxRows << "，无法导入";
+        return ThermalDataSeries();
+    }
+    const int total = int(rowCount);
+    QVector<double> temperatures(total);
+    QVector<double> times(total);
+    QVector<double> values(total);
+    int offset = 0;
+    for (ParseChunk& chunk : chunks) {
+        const int count = chunk.series.size();
+        if (count > 0) {
+            std::memcpy(temperatures.data() + offset, chunk.series.temperatureColumn().constData(), size_t(count) * sizeof(double));
+            std::memcpy(times.data() + offset, chunk.series.timeColumn().constData(), size_t(count) * sizeof(double));
+            std::memcpy(values.data() + offset, chunk.series.valueColumn().constData(), size_t(count) * sizeof(double));
+            offset += count;
+        }
+        chunk.series = ThermalDataSeries();
+    }
+
+    qDebug() << "TextFileReader: 并行解析" << chunks.size() << "段，共" << total << "行";
+    return ThermalDataSeries::fromColumns(std::move(temperatures), std::move(times), std::move(values));
+}
+
+} // namespace
+
+TextFileReader::TextFileReader() { qDebug() << "构造:  TextFileReader"; }
+
+QStringList TextFileReader::supportedFormats() const
+{
+    return { "Text Files (*.txt)", "Comma-Separated Values (*.csv)", "All Files (*)" };
+}
+
+bool TextFileReader::canRead(const QString& filePath) const
+{
+    return filePath.endsWith(".txt", Qt::CaseInsensitive) || filePath.endsWith(".csv", Qt::CaseInsensitive);
+}
+
+FilePreviewData TextFileReader::readPreview(const QString& filePath) const
+{
+    FilePreviewData previewData;
+    const TextParsePlan plan = TextFormatSniffer::plan(filePath);
+    if (!plan.valid) {
+        return previewData;
+    }
+
+    previewData.header = plan.headerLines.join("\n");
+    previewData.previewContent = plan.previewText;
+    previewData.columns.reserve(plan.columnLabels.size());
+    for (int i = 0; i < plan.columnLabels.size(); ++i) {
+        FilePreviewColumn column;
+        column.index = i;
+        column.label = plan.columnLabels.at(i);
+        column.numeric = plan.numericColumns.value(i);
+        previewData.columns.append(column);
+    }
     return previewData;
 }
 
-ThermalCurve TextFileReader::read(const QString& filePath, const QVariantMap& config) const
+ThermalCurve TextFileReader::read(const QString& filePath, const QVariantMap& config, IProgressReporter* progress) const
 {
     QString id = QUuid::createUuid().toString();
     // 曲线名称设置为"[源]"，项目名称使用文件名
@@ -96,96 +319,57 @@ ThermalCurve TextFileReader::read(const QString& filePath, const QVariantMap& co
     curve.setProjectName(projectName);
 
     QFile file(filePath);
-    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+    if (!file.open(QIODevice::ReadOnly)) {
         qWarning() << "无法打开文件:" << filePath << file.errorString();
         return curve;
     }
 
-    // 1. 分离表头和数据行
-    QTextStream in(&file);
-    // 强制按 GBK 解码文本，避免受系统本地编码影响
-    in.setCodec("GBK");
-
-    QStringList dataLines;
-    while (!in.atEnd()) {
-        const QString line = in.readLine().trimmed();
-        if (line.isEmpty())
-            continue;
-        QChar c = line.at(0);
-        if (!c.isLetter() && c != '\0') { // 简单的判断，非字母开头的为数据行
-            dataLines.append(line);
+    // 1. 列布局与单位换算（分隔符、编码与表头区取自预览时缓存的解析计划）
+    const TextParsePlan plan = TextFormatSniffer::plan(filePath);
+    const TextColumnLayout layout = columnLayout(plan, filePath, config);
+
+    // 2. 解析原始字节（表头行跳过，数据行直接写入列缓冲区）
+    //    大文件且允许并行时映射到内存、按行切块并行解析，否则按块顺序读取；
+    //    跟随模式下只解析到最后一个完整行，其后的内容由 TextFileFollower 继续读取
+    const bool follow = config.value(FileReaderOptions::FollowFile).toBool();
+    const qint64 fileSize = follow ? completeLinesSize(file, file.size()) : file.size();
+    int threadCount = config.value(FileReaderOptions::ParseThreads).toInt();
+    if (threadCount <= 0) {
+        threadCount = QThread::idealThreadCount();
+    }
+    threadCount = int(qMin<qint64>(threadCount, fileSize / kMinParallelChunkBytes));
+    const qint64 dataOffset = plan.dataOffset < fileSize ? plan.dataOffset : 0;
+
+    ThermalDataSeries points;
+    bool parsed = false;
+    if (config.value(FileReaderOptions::ParallelParse).toBool() && threadCount > 1) {
+        if (uchar* mapped = fileSize > 0 ? file.map(0, fileSize) : nullptr) {
+            points = parseMappedParallel(reinterpret_cast<const char*>(mapped), dataOffset, fileSize, layout, threadCount,
+                                         progress);
+            file.unmap(mapped);
+            parsed = true;
+        } else {
+            qWarning() << "无法映射文件，改为顺序读取:" << filePath << file.errorString();
         }
     }
+    if (!parsed) {
+        points = readSequential(file, dataOffset, fileSize, plan.utf8Bom, layout, progress);
+    }
     file.close();
 
-    if (dataLines.isEmpty())
+    if (points.isEmpty() || (progress && progress->shouldCancel()))
         return curve;
 
-    // 2. 获取配置
-    const int timeCol = config.value("timeColumn").toInt();
-    const int tempCol = config.value("tempColumn").toInt();
-    const int signalCol = config.value("signalColumn").toInt();
-    const bool tempIsFixed = config.value("tempIsFixed").toBool();
-    const double tempFixedValue = config.value("tempFixedValue").toDouble();
-
-    // 3. 单位转换因子
-    double timeFactor = 1.0;
-    if (config.value("timeUnit").toString() == "min")
-        timeFactor = 60.0;
-    else if (config.value("timeUnit").toString() == "h")
-        timeFactor = 3600.0;
-    else if (config.value("timeUnit").toString() == "ms")
-        timeFactor = 0.001;
-
-    double tempOffset = 0.0;
-    if (config.value("tempUnit").toString() == "K")
-        tempOffset = -273.15;
-
-    // 4. 解析数据
-    const bool isCsv = filePath.endsWith(".csv", Qt::CaseInsensitive);
-    auto splitLine
-        = [&](const QString& s) -> QStringList { return isCsv ? s.split(',') : s.split(QRegularExpression("\\s+"), Qt::SkipEmptyParts); };
-
-    QVector<ThermalDataPoint> points;
-    points.reserve(dataLines.size());
-
-    for (const QString& line : dataLines) {
-        const QStringList cols = splitLine(line);
-        ThermalDataPoint point;
-
-        bool ok = false;
-        double time = 0.0;
-        if (timeCol >= 0 && timeCol < cols.size()) {
-            time = cols.at(timeCol).toDouble(&ok) * timeFactor;
-        }
-        point.time = ok ? time : 0.0;
-
-        bool tempOk = false;
-        double temp = tempFixedValue;
-        if (!tempIsFixed && tempCol >= 0 && tempCol < cols.size()) {
-            temp = cols.at(tempCol).toDouble(&tempOk) + tempOffset;
-        } else {
-            tempOk = true;
-        }
-        point.temperature = tempOk ? temp : tempFixedValue;
-
-        ok = false;
-        double value = 0.0;
-        if (signalCol >= 0 && signalCol < cols.size()) {
-            value = cols.at(signalCol).toDouble(&ok);
-        }
-        point.value = ok ? value : 0.0;
-
-        points.append(point);
-    }
-
-    // 5. 设置元数据
+    // 3. 设置元数据
     CurveMetadata metadata;
     metadata.sampleName = config.value("signalName").toString();
     metadata.sampleMass = config.value("initialMass").toDouble();
     metadata.additional.insert("source_file", filePath);
+    if (follow) {
+        metadata.additional.insert(FileReaderOptions::ParsedBytes, fileSize);
+    }
 
-    // 6. 设置曲线类型（仪器类型 + 信号类型）并进行质量百分比转换
+    // 4. 设置曲线类型（仪器类型 + 信号类型）并进行质量百分比转换
     QString typeStr = config.value("curveType").toString();
     if (typeStr.isEmpty()) {
         typeStr = config.value("signalType").toString();
@@ -197,12 +381,16 @@ ThermalCurve TextFileReader::read(const QString& filePath, const QVariantMap& co
         curve.setSignalType(SignalType::Raw);
 
         // 如果是质量类型且设置了初始质量，转换为质量损失百分比
-        if (metadata.sampleMass > 0.0) {
-            qDebug() << "将质量数据转换为百分比，初始质量:" << metadata.sampleMass;
-            for (ThermalDataPoint& point : points) {
+        const double massBase = massPercentBase(config);
+        if (massBase > 0.0) {
+            qDebug() << "将质量数据转换为百分比，初始质量:" << massBase;
+            // 整列换算后一次替换（逐点 setValue 每次都会使缓存失效）
+            QVector<double> values = points.valueColumn();
+            for (double& value : values) {
                 // 质量损失百分比 = (当前质量 / 初始质量) * 100
-                point.value = (point.value / metadata.sampleMass) * 100.0;
+                value = (value / massBase) * 100.0;
             }
+            points = points.withValues(std::move(values));
         }
     } else if (normalizedType == "ARC") {
         curve.setInstrumentType(InstrumentType::ARC);
@@ -228,3 +416,53 @@ ThermalCurve TextFileReader::read(const QString& filePath, const QVariantMap& co
     qDebug() << "文件" << filePath << "已成功读取并应用配置。";
     return curve;
 }
+
+std::unique_ptr<IFileFollower> TextFileReader::createFollower(const QString& filePath, const QVariantMap& config, qint64 offset) const
+{
+    return std::unique_ptr<IFileFollower>(new TextFileFollower(filePath, config, offset));
+}
+
+TextColumnLayout TextFileReader::columnLayout(const QString& filePath, const QVariantMap& config)
+{
+    return columnLayout(TextFormatSniffer::plan(filePath), filePath, config);
+}
+
+TextColumnLayout TextFileReader::columnLayout(const TextParsePlan& plan, const QString& filePath, const QVariantMap& config)
+{
+    TextColumnLayout layout;
+    layout.timeColumn = config.value("timeColumn").toInt();
+    layout.tempColumn = config.value("tempColumn").toInt();
+    layout.signalColumn = config.value("signalColumn").toInt();
+    layout.tempIsFixed = config.value("tempIsFixed").toBool();
+    layout.tempFixedValue = config.value("tempFixedValue").toDouble();
+    if (plan.valid) {
+        layout.separator = plan.separator;
+        layout.utf8Text = plan.encoding == "UTF-8";
+    } else {
+        layout.separator = filePath.endsWith(".csv", Qt::CaseInsensitive) ? ',' : 0;
+    }
+
+    // 单位转换因子
+    if (config.value("timeUnit").toString() == "min")
+        layout.timeFactor = 60.0;
+    else if (config.value("timeUnit").toString() == "h")
+        layout.timeFactor = 3600.0;
+    else if (config.value("timeUnit").toString() == "ms")
+        layout.timeFactor = 0.001;
+
+    if (config.value("tempUnit").toString() == "K")
+        layout.tempOffset = -273.15;
+
+    return layout;
+}
+
+double TextFileReader::massPercentBase(const QVariantMap& config)
+{
+    QString typeStr = config.value("curveType").toString();
+    if (typeStr.isEmpty()) {
+        typeStr = config.value("signalType").toString();
+    }
+    const bool massSignal = typeStr.trimmed().toUpper() == "TGA" || typeStr == "质量";
+    const double sampleMass = config.value("initialMass").toDouble();
+    return massSignal && sampleMass > 0.0 ? sampleMass : 0.0;
+}
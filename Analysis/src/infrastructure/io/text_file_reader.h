@@ -5,6 +5,9 @@
 #include <QVariantMap>
 #include <QVector>
 
+struct TextColumnLayout;
+struct TextParsePlan;
+
 /**
  * @brief 文件预览列信息
  *
@@ -13,6 +16,7 @@
 struct FilePreviewColumn {
     int index = -1;      //!< 列索引（从0开始）
     QString label;       //!< 列标签（如 "温度", "时间", "质量"）
+    bool numeric = false; //!< 预览样本中该列的数据均为数值
 };
 
 /**
@@ -31,8 +35,9 @@ struct FilePreviewData {
  *
  * 支持：
  * - 智能列识别（温度、时间、质量等）
- * - 文件预览
+ * - 文件预览：只读取文件开头几 KB（见 TextFormatSniffer），识别结果缓存后供导入直接使用
  * - 用户自定义列映射
+ * - 跟随模式：读取仍在被仪器追加写入的文件（见 FileReaderOptions::FollowFile 与 createFollower()）
  */
 class TextFileReader : public IFileReader {
 public:
@@ -49,9 +54,10 @@ public:
      * @brief 读取文件并返回热分析曲线对象
      * @param filePath 文件路径
      * @param config 用户导入配置（列映射、单位等）
+     * @param progress 进度报告器（可选），按已解析的字节数报告进度
      * @return 解析后的 ThermalCurve 对象
      */
-    ThermalCurve read(const QString& filePath, const QVariantMap& config) const override;
+    ThermalCurve read(const QString& filePath, const QVariantMap& config, IProgressReporter* progress = nullptr) const override;
 
     /**
      * @brief 获取支持的文件格式列表
@@ -62,12 +68,34 @@ public:
     /**
      * @brief 读取文件预览数据
      *
-     * 读取文件的前几行和列信息，用于在导入对话框中显示预览和进行列映射
+     * 读取文件的前几行和列信息，用于在导入对话框中显示预览和进行列映射。
+     * 只读取文件开头一小段，识别出的分隔符、表头与编码被缓存，随后的 read() 不再重复识别。
      *
      * @param filePath 文件路径
      * @return 文件预览数据
      */
     FilePreviewData readPreview(const QString& filePath) const;
+
+    /**
+     * @brief 创建 TextFileFollower，从 offset 处继续解析新追加的行
+     */
+    std::unique_ptr<IFileFollower> createFollower(const QString& filePath, const QVariantMap& config, qint64 offset) const override;
+
+    /**
+     * @brief 由导入配置得到列布局与单位换算
+     */
+    static TextColumnLayout columnLayout(const QString& filePath, const QVariantMap& config);
+
+    /**
+     * @brief 由已识别的文件格式和导入配置得到列布局（分隔符与编码取自 plan）
+     */
+    static TextColumnLayout columnLayout(const TextParsePlan& plan, const QString& filePath, const QVariantMap& config);
+
+    /**
+     * @brief 质量信号换算为百分比时使用的初始质量
+     * @return 不需要换算（非质量信号或未设置初始质量）时返回 0
+     */
+    static double massPercentBase(const QVariantMap& config);
 };
 
 #endif // TEXTFILEREADER_H
@@ -0,0 +1,290 @@
+#include "text_format_sniffer.h"
+#include "infrastructure/io/text_data_parser.h"
+#include <QDebug>
+#include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QMutex>
+#include <QTextCodec>
+#include <algorithm>
+
+namespace {
+
+QMutex& planCacheMutex()
+{
+    static QMutex mutex;
+    return mutex;
+}
+
+QHash<QString, TextParsePlan>& planCache()
+{
+    static QHash<QString, TextParsePlan> plans;
+    return plans;
+}
+
+inline bool isSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+}
+
+/**
+ * @brief 样本中的一行（字节范围，已去除首尾空白）
+ */
+struct SampleLine {
+    const char* begin = nullptr;
+    const char* end = nullptr;
+};
+
+/**
+ * @brief 按某个分隔符切分样本数据行的结果
+ */
+struct SeparatorScore {
+    int columnCount = 0;          // 样本数据行中最多的字段数
+    QVector<bool> numericColumns; // 各列在所有样本行中都可解析为数值
+    int numericCount = 0;
+};
+
+SeparatorScore scoreSeparator(const QVector<SampleLine>& dataLines, char separator)
+{
+    SeparatorScore score;
+    for (int row = 0; row < dataLines.size(); ++row) {
+        const SampleLine& line = dataLines.at(row);
+        const char* field = line.begin;
+        int column = 0;
+        while (field) {
+            const char* fieldEnd = field;
+            const char* next = TextDataParser::splitField(field, line.end, separator, &fieldEnd);
+            while (field < fieldEnd && isSpace(*field)) {
+                ++field;
+            }
+            while (fieldEnd > field && isSpace(fieldEnd[-1])) {
+                --fieldEnd;
+            }
+            double value = 0.0;
+            const bool numeric = TextDataParser::parseDouble(field, fieldEnd, value);
+            if (column >= score.columnCount) {
+                // 之前的样本行没有这一列，只有从第一行起就出现的列才可能是数值列
+                score.columnCount = column + 1;
+                score.numericColumns.append(numeric && row == 0);
+            } else if (!numeric) {
+                score.numericColumns[column] = false;
+            }
+            ++column;
+            field = next;
+        }
+        // 本行缺少的列不是完整的数值列
+        for (int c = column; c < score.columnCount; ++c) {
+            score.numericColumns[c] = false;
+        }
+    }
+    score.numericCount = int(std::count(score.numericColumns.cbegin(), score.numericColumns.cend(), true));
+    return score;
+}
+
+/**
+ * @brief 判断不含 BOM 的样本是否为有效的 UTF-8 且含有多字节字符
+ */
+bool looksLikeUtf8(const QByteArray& sample)
+{
+    const bool hasNonAscii = std::any_of(sample.cbegin(), sample.cend(), [](char c) { return (c & 0x80) != 0; });
+    if (!hasNonAscii) {
+        return false;
+    }
+    QTextCodec::ConverterState state;
+    QTextCodec::codecForName("UTF-8")->toUnicode(sample.constData(), sample.size(), &state);
+    return state.invalidChars == 0 && state.remainingChars == 0;
+}
+
+/**
+ * @brief 按最后一行表头切出列标签（不使用正则表达式）
+ */
+QStringList splitHeaderLabels(const QString& header, char separator)
+{
+    if (separator == 0) {
+        return header.simplified().split(QLatin1Char(' '), Qt::SkipEmptyParts);
+    }
+    QStringList labels = header.split(QLatin1Char(separator));
+    for (QString& label : labels) {
+        label = label.trimmed();
+    }
+    return labels;
+}
+
+} // namespace
+
+TextParsePlan TextFormatSniffer::plan(const QString& filePath)
+{
+    const QFileInfo info(filePath);
+    const QString key = info.absoluteFilePath();
+    {
+        QMutexLocker locker(&planCacheMutex());
+        const auto it = planCache().constFind(key);
+        if (it != planCache().constEnd() && it->fileSize == info.size() && it->lastModified == info.lastModified()) {
+            return it.value();
+        }
+    }
+
+    TextParsePlan plan = sniff(filePath);
+    if (plan.valid) {
+        QMutexLocker locker(&planCacheMutex());
+        if (planCache().size() >= MaxCachedPlans) {
+            planCache().clear();
+        }
+        planCache().insert(key, plan);
+    }
+    return plan;
+}
+
+void TextFormatSniffer::clearCache()
+{
+    QMutexLocker locker(&planCacheMutex());
+    planCache().clear();
+}
+
+TextParsePlan TextFormatSniffer::sniff(const QString& filePath)
+{
+    TextParsePlan plan;
+    const QFileInfo info(filePath);
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qWarning() << "无法打开文件进行格式识别:" << filePath << file.errorString();
+        return plan;
+    }
+    plan.valid = true;
+    plan.fileSize = info.size();
+    plan.lastModified = info.lastModified();
+
+    // 1. 读取开头一段；样本中还没有数据行（表头很长）时逐步扩大，最多 MaxSniffBytes
+    QByteArray sample;
+    int limit = SniffBytes;
+    bool atEnd = false;
+    for (;;) {
+        const QByteArray more = file.read(limit - sample.size());
+        sample.append(more);
+        atEnd = sample.size() < limit;
+        if (atEnd || limit >= MaxSniffBytes) {
+            break;
+        }
+        // 快速检查：有以数字或符号开头的行即可停止扩大
+        bool hasDataLine = false;
+        for (int pos = 0; pos < sample.size() && !hasDataLine;) {
+            const int newline = sample.indexOf('\n', pos);
+            if (newline < 0) {
+                break;
+            }
+            int first = pos;
+            while (first < newline && isSpace(sample.at(first))) {
+                ++first;
+            }
+            const char c = sample.at(first);
+            hasDataLine = first < newline && ((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.');
+            pos = newline + 1;
+        }
+        if (hasDataLine) {
+            break;
+        }
+        limit = qMin(limit * 4, int(MaxSniffBytes));
+    }
+    file.close();
+
+    // 未读到文件末尾时丢弃最后一个不完整的行（也避免截断多字节字符）
+    if (!atEnd) {
+        const int lastNewline = sample.lastIndexOf('\n');
+        sample.truncate(lastNewline + 1);
+    }
+
+    // 2. 编码：UTF-8 BOM > 有效的 UTF-8 > GBK（与旧版预览的默认一致）
+    int start = 0;
+    if (sample.startsWith("\xEF\xBB\xBF")) {
+        plan.utf8Bom = true;
+        start = 3;
+    }
+    plan.encoding = (plan.utf8Bom || looksLikeUtf8(sample)) ? QByteArrayLiteral("UTF-8") : QByteArrayLiteral("GBK");
+    QTextCodec* codec = QTextCodec::codecForName(plan.encoding);
+
+    // 3. 逐行扫描：首个数据行之前为表头区，之后取一部分数据行作为分隔符与数值列的样本
+    QVector<SampleLine> dataLines;
+    QString preview;
+    int lineIndex = 0;
+    bool inHeader = true;
+    const char* const data = sample.constData();
+    for (int pos = start; pos < sample.size(); ++lineIndex) {
+        int newline = sample.indexOf('\n', pos);
+        if (newline < 0) {
+            newline = sample.size();
+        }
+        const char* begin = data + pos;
+        const char* end = data + newline;
+        const qint64 lineOffset = pos;
+        pos = newline + 1;
+
+        if (lineIndex < PreviewLineCount) {
+            const char* rawEnd = (end > begin && end[-1] == '\r') ? end - 1 : end;
+            preview.append(codec->toUnicode(begin, int(rawEnd - begin)));
+            preview.append(QLatin1Char('\n'));
+        }
+
+        while (begin < end && isSpace(*begin)) {
+            ++begin;
+        }
+        while (end > begin && isSpace(end[-1])) {
+            --end;
+        }
+        if (begin == end) {
+            continue;
+        }
+
+        if (!TextDataParser::isDataLine(begin, end, codec)) {
+            if (inHeader) {
+                plan.headerLines.append(codec->toUnicode(begin, int(end - begin)));
+            }
+            continue;
+        }
+
+        if (inHeader) {
+            inHeader = false;
+            plan.headerLineCount = lineIndex;
+            plan.dataOffset = lineOffset;
+        }
+        if (dataLines.size() < MaxSampleDataLines) {
+            dataLines.append({ begin, end });
+        } else if (lineIndex >= PreviewLineCount) {
+            break;
+        }
+    }
+    if (inHeader) {
+        plan.headerLineCount = lineIndex;
+    }
+    plan.previewText = preview;
+
+    // 4. 分隔符：在候选中选出能解析出最多数值列的一个（同分时优先与扩展名相符的）
+    const bool csv = filePath.endsWith(".csv", Qt::CaseInsensitive);
+    const char candidates[3] = { csv ? ',' : char(0), csv ? ';' : ',', csv ? char(0) : ';' };
+    SeparatorScore best;
+    plan.separator = candidates[0];
+    if (!dataLines.isEmpty()) {
+        best = scoreSeparator(dataLines, candidates[0]);
+        for (int i = 1; i < 3; ++i) {
+            SeparatorScore score = scoreSeparator(dataLines, candidates[i]);
+            if (score.numericCount > best.numericCount) {
+                best = std::move(score);
+                plan.separator = candidates[i];
+            }
+        }
+    }
+    plan.numericColumns = best.numericColumns;
+
+    // 5. 列标签：取最后一行表头，不足时以 "列 n" 补齐
+    QStringList labels;
+    if (!plan.headerLines.isEmpty()) {
+        labels = splitHeaderLabels(plan.headerLines.last(), plan.separator);
+    }
+    const int columnCount = dataLines.isEmpty() ? labels.size() : best.columnCount;
+    for (int i = 0; i < columnCount; ++i) {
+        const QString label = i < labels.size() ? labels.at(i) : QString();
+        plan.columnLabels.append(label.isEmpty() ? QStringLiteral("列 %1").arg(i + 1) : label);
+    }
+    plan.numericColumns.resize(columnCount);
+
+    return plan;
+}
@@ -0,0 +1,64 @@
+#ifndef TEXTFORMATSNIFFER_H
+#define TEXTFORMATSNIFFER_H
+
+#include <QByteArray>
+#include <QDateTime>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+/**
+ * @brief 文本数据文件的解析计划（由文件开头一小段内容嗅探得到）
+ *
+ * 预览与导入共用同一份计划：预览直接使用其中的表头、列信息和预览行，
+ * 导入据此确定分隔符与编码，并从 dataOffset 处开始解析，不再重新扫描表头。
+ */
+struct TextParsePlan {
+    bool valid = false;           //!< 文件能否打开并读取
+    qint64 fileSize = 0;          //!< 嗅探时的文件大小（与修改时间一起用于判断缓存是否过期）
+    QDateTime lastModified;       //!< 嗅探时的文件修改时间
+
+    bool utf8Bom = false;         //!< 文件以 UTF-8 BOM 开头
+    QByteArray encoding;          //!< 文本编码（"UTF-8" 或 "GBK"）
+    char separator = 0;           //!< 字段分隔符（',' 或 ';'，0 表示空白分隔）
+    int headerLineCount = 0;      //!< 首个数据行之前的行数（表头行与空行）
+    qint64 dataOffset = 0;        //!< 首个数据行的字节偏移（样本中没有数据行时为 0，由解析器逐行判断）
+
+    QStringList headerLines;      //!< 表头行（已去除首尾空白，不含空行）
+    QStringList columnLabels;     //!< 各列标签（来自最后一行表头，缺失时为 "列 n"）
+    QVector<bool> numericColumns; //!< 各列在样本数据行中是否全部可以解析为数值
+    QString previewText;          //!< 预览内容（开头最多 PreviewLineCount 行，已解码）
+};
+
+/**
+ * @brief TextFormatSniffer 读取文本数据文件开头的几 KB，一次确定分隔符、表头行、数值列与编码
+ *
+ * 只读取 SniffBytes 字节（样本中找不到数据行时逐步扩大，最多 MaxSniffBytes），
+ * 不解码整个文件、不使用正则表达式。结果按文件路径缓存，文件大小或修改时间变化时重新嗅探；
+ * 可以在多个线程中同时调用。
+ */
+class TextFormatSniffer {
+public:
+    /**
+     * @brief 获取文件的解析计划（优先使用缓存）
+     */
+    static TextParsePlan plan(const QString& filePath);
+
+    /**
+     * @brief 不经缓存直接嗅探文件
+     */
+    static TextParsePlan sniff(const QString& filePath);
+
+    /**
+     * @brief 清空缓存
+     */
+    static void clearCache();
+
+    static constexpr int SniffBytes = 16 * 1024;      ///< 首次读取的字节数
+    static constexpr int MaxSniffBytes = 256 * 1024;  ///< 表头很长时最多读取的字节数
+    static constexpr int PreviewLineCount = 30;       ///< 预览内容的行数
+    static constexpr int MaxSampleDataLines = 50;     ///< 用于判断分隔符与数值列的数据行数
+    static constexpr int MaxCachedPlans = 256;        ///< 缓存的文件数上限（超过时整体清空）
+};
+
+#endif // TEXTFORMATSNIFFER_H
@@ -2,6 +2,7 @@
 #include "thermal_chart.h"
 #include "thermal_chart_view.h"
 #include "floating_label.h"
+#include "domain/model/project_document.h"
 #include "domain/model/thermal_curve.h"
 #include "application/curve/curve_manager.h"
 #include <QDebug>
@@ -130,11 +131,21 @@ void ChartView::addCurve(const ThermalCurve& curve)
     m_chart->addCurve(curve);
 }
 
+void ChartView::addCurves(const QVector<const ThermalCurve*>& curves)
+{
+    m_chart->addCurves(curves);
+}
+
 void ChartView::updateCurve(const ThermalCurve& curve)
 {
     m_chart->updateCurve(curve);
 }
 
+void ChartView::appendCurveData(const ThermalCurve& curve, int firstNewIndex)
+{
+    m_chart->appendCurveData(curve, firstNewIndex);
+}
+
 void ChartView::removeCurve(const QString& curveId)
 {
     m_chart->removeCurve(curveId);
@@ -216,6 +227,11 @@ const QVector<FloatingLabel*>& ChartView::floatingLabels() const
     return m_chart->floatingLabels();
 }
 
+QVector<CurveLabelAnnotation> ChartView::curveLabelAnnotations() const
+{
+    return m_chart->curveLabelAnnotations();
+}
+
 void ChartView::addCurveMarkers(const QString& curveId, const QList<QPointF>& markers,
                                  const QColor& color, qreal size)
 {
@@ -232,6 +248,11 @@ void ChartView::clearAllMarkers()
     m_chart->clearAllMarkers();
 }
 
+QVector<CurveMarkerSet> ChartView::curveMarkerSets() const
+{
+    return m_chart->curveMarkerSets();
+}
+
 void ChartView::startMassLossTool()
 {
     m_chartView->startMassLossTool();
@@ -379,32 +400,23 @@ void ChartView::handlePointSelection(const QPointF& value)
 
     // 从目标曲线数据中查找最接近的点
     double targetXValue = value.x();
-    int closestIndex = 0;
-    double minDist = qAbs(curveData[0].temperature - targetXValue);
 
-    // 根据当前横轴模式选择比较方式
+    // 根据当前横轴模式选择比较的列
     bool useTemperature = (xAxisMode() == 0);  // 0 = Temperature
+    const ColumnView<double> xs = curveData.xColumn(!useTemperature);
 
-    if (useTemperature) {
-        for (int i = 1; i < curveData.size(); ++i) {
-            double dist = qAbs(curveData[i].temperature - targetXValue);
-            if (dist < minDist) {
-                minDist = dist;
-                closestIndex = i;
-            }
-        }
-    } else {
-        for (int i = 1; i < curveData.size(); ++i) {
-            double dist = qAbs(curveData[i].time - targetXValue);
-            if (dist < minDist) {
-                minDist = dist;
-                closestIndex = i;
-            }
+    int closestIndex = 0;
+    double minDist = qAbs(xs[0] - targetXValue);
+    for (int i = 1; i < xs.size(); ++i) {
+        double dist = qAbs(xs[i] - targetXValue);
+        if (dist < minDist) {
+            minDist = dist;
+            closestIndex = i;
         }
     }
 
     // 保存完整的数据点
-    ThermalDataPoint selectedDataPoint = curveData[closestIndex];
+    ThermalDataPoint selectedDataPoint = curveData.at(closestIndex);
 
     // 记录选中点所属的曲线ID（第一次选点时记录）
     if (m_selectedPoints.isEmpty()) {
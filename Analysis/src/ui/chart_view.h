@@ -15,6 +15,8 @@ class ThermalChartView;
 class ThermalCurve;
 class CurveManager;
 class FloatingLabel;
+struct CurveMarkerSet;
+struct CurveLabelAnnotation;
 class QGraphicsObject;
 class QPen;
 
@@ -176,12 +178,14 @@ public:
     void removeFloatingLabel(FloatingLabel* label);
     void clearFloatingLabels();
     const QVector<FloatingLabel*>& floatingLabels() const;
+    QVector<CurveLabelAnnotation> curveLabelAnnotations() const;
 
     // 标注点（Markers）
     void addCurveMarkers(const QString& curveId, const QList<QPointF>& markers,
                          const QColor& color, qreal size);
     void removeCurveMarkers(const QString& curveId);
     void clearAllMarkers();
+    QVector<CurveMarkerSet> curveMarkerSets() const;
 
     // 测量工具
     void startMassLossTool();
@@ -205,7 +209,9 @@ public:
 public slots:
     // ==================== 曲线管理（转发给 ThermalChart）====================
     void addCurve(const ThermalCurve& curve);
+    void addCurves(const QVector<const ThermalCurve*>& curves);
     void updateCurve(const ThermalCurve& curve);
+    void appendCurveData(const ThermalCurve& curve, int firstNewIndex);
     void removeCurve(const QString& curveId);
     void clearCurves();
     void setCurveVisible(const QString& curveId, bool visible);
@@ -30,8 +30,10 @@ CurveViewController::CurveViewController(
 
     // 连接 CurveManager 的信号
     connect(m_curveManager, &CurveManager::curveAdded, this, &CurveViewController::onCurveAdded);
+    connect(m_curveManager, &CurveManager::curvesAdded, this, &CurveViewController::onCurvesAdded);
     connect(m_curveManager, &CurveManager::curveRemoved, this, &CurveViewController::onCurveRemoved);
     connect(m_curveManager, &CurveManager::curveDataChanged, this, &CurveViewController::onCurveDataChanged);
+    connect(m_curveManager, &CurveManager::curveDataAppended, this, &CurveViewController::onCurveDataAppended);
     connect(m_curveManager, &CurveManager::activeCurveChanged, this, &CurveViewController::onActiveCurveChanged);
     connect(m_curveManager, &CurveManager::curvesCleared, this, &CurveViewController::onCurvesCleared);
 
@@ -82,6 +84,108 @@ void CurveViewController::updateAllCurves()
     // m_plotWidget->update();
 }
 
+void CurveViewController::prepareProjectRestore(const ProjectViewState& viewState)
+{
+    m_hiddenOnRestore = QSet<QString>(viewState.hiddenCurveIds.begin(), viewState.hiddenCurveIds.end());
+    m_treeManager->setCurvesInitiallyUnchecked(viewState.hiddenCurveIds);
+
+    m_pendingMarkers.clear();
+    for (const CurveMarkerSet& markers : viewState.markers) {
+        m_pendingMarkers.insert(markers.curveId, markers);
+    }
+    m_pendingLabels.clear();
+    for (const CurveLabelAnnotation& label : viewState.labels) {
+        m_pendingLabels.insert(label.curveId, label);
+    }
+
+    qDebug() << "CurveViewController::prepareProjectRestore - 未勾选曲线:" << viewState.hiddenCurveIds.size()
+             << ", 标注点组:" << viewState.markers.size() << ", 浮动标签:" << viewState.labels.size();
+}
+
+ProjectViewState CurveViewController::collectViewState() const
+{
+    ProjectViewState viewState;
+
+    // 强绑定曲线不在树中，随父曲线显示，不单独记录
+    const QStringList checkedIds = m_treeManager->getCheckedCurveIds();
+    const QSet<QString> checked(checkedIds.begin(), checkedIds.end());
+    const auto& allCurves = m_curveManager->getAllCurves();
+    for (const ThermalCurve& curve : allCurves) {
+        if (!curve.isStronglyBound() && !checked.contains(curve.id())) {
+            viewState.hiddenCurveIds.append(curve.id());
+        }
+    }
+
+    viewState.markers = m_plotWidget->curveMarkerSets();
+    viewState.labels = m_plotWidget->curveLabelAnnotations();
+
+    // 尚未绘制的曲线的标注仍在等待恢复，一并保存
+    for (const CurveMarkerSet& markers : m_pendingMarkers) {
+        if (allCurves.contains(markers.curveId)) {
+            viewState.markers.append(markers);
+        }
+    }
+    for (const CurveLabelAnnotation& label : m_pendingLabels) {
+        if (allCurves.contains(label.curveId)) {
+            viewState.labels.append(label);
+        }
+    }
+
+    return viewState;
+}
+
+// ========== 绘制辅助函数 ==========
+
+void CurveViewController::plotCurve(const ThermalCurve& curve)
+{
+    m_plotWidget->addCurve(curve);
+
+    // 获取曲线颜色并同步到项目浏览器
+    QColor curveColor = m_plotWidget->getCurveColor(curve.id());
+    m_treeManager->setCurveColor(curve.id(), curveColor);
+
+    applyPendingAnnotations(curve.id());
+}
+
+void CurveViewController::plotDeferredCurve(const QString& curveId)
+{
+    if (!m_deferredCurveIds.remove(curveId)) {
+        return;
+    }
+
+    ThermalCurve* curve = m_curveManager->getCurve(curveId);
+    if (!curve) {
+        return;
+    }
+
+    qDebug() << "CurveViewController::plotDeferredCurve - 首次显示，绘制曲线:" << curveId;
+    plotCurve(*curve);
+
+    // 强绑定子曲线随父曲线一起首次绘制
+    const auto& allCurves = m_curveManager->getAllCurves();
+    for (const ThermalCurve& childCurve : allCurves) {
+        if (childCurve.isStronglyBound() && childCurve.parentId() == curveId && m_deferredCurveIds.remove(childCurve.id())) {
+            plotCurve(childCurve);
+        }
+    }
+}
+
+void CurveViewController::applyPendingAnnotations(const QString& curveId)
+{
+    const auto markerIt = m_pendingMarkers.find(curveId);
+    if (markerIt != m_pendingMarkers.end()) {
+        const CurveMarkerSet& markers = markerIt.value();
+        m_plotWidget->addCurveMarkers(curveId, markers.points, markers.color, markers.size);
+        m_pendingMarkers.erase(markerIt);
+    }
+
+    const QList<CurveLabelAnnotation> labels = m_pendingLabels.values(curveId);
+    for (const CurveLabelAnnotation& label : labels) {
+        m_plotWidget->addFloatingLabel(label.text, label.anchor, curveId);
+    }
+    m_pendingLabels.remove(curveId);
+}
+
 // ========== 响应 CurveManager 信号 ==========
 
 void CurveViewController::onCurveAdded(const QString& curveId)
@@ -98,11 +202,14 @@ void CurveViewController::onCurveAdded(const QString& curveId)
         return;
     }
 
-    m_plotWidget->addCurve(*curve);
-
-    // 获取曲线颜色并同步到项目浏览器
-    QColor curveColor = m_plotWidget->getCurveColor(curveId);
-    m_treeManager->setCurveColor(curveId, curveColor);
+    // 恢复项目时保存为未勾选的曲线暂不绘制（强绑定曲线随父曲线），采样数据在首次勾选时才读取
+    const bool hidden = curve->isStronglyBound() ? m_deferredCurveIds.contains(curve->parentId())
+                                                 : m_hiddenOnRestore.remove(curveId);
+    if (hidden) {
+        m_deferredCurveIds.insert(curveId);
+    } else {
+        plotCurve(*curve);
+    }
 
     if (m_projectExplorer && m_projectExplorer->treeView()) {
         m_projectExplorer->treeView()->expandAll();
@@ -115,6 +222,47 @@ void CurveViewController::onCurveAdded(const QString& curveId)
     }
 }
 
+void CurveViewController::onCurvesAdded(const QStringList& curveIds)
+{
+    qDebug() << "CurveViewController::onCurvesAdded - 批量添加曲线:" << curveIds.size();
+
+    if (!validateComponents()) {
+        return;
+    }
+
+    // 与 onCurveAdded 相同的可见性规则，要绘制的曲线一次性加入图表（坐标轴只重算一次）
+    QVector<const ThermalCurve*> curvesToPlot;
+    for (const QString& curveId : curveIds) {
+        const ThermalCurve* curve = m_curveManager->getCurve(curveId);
+        if (!curve) {
+            qWarning() << "CurveViewController::onCurvesAdded - 未找到曲线数据，ID:" << curveId;
+            continue;
+        }
+        const bool hidden = curve->isStronglyBound() ? m_deferredCurveIds.contains(curve->parentId())
+                                                     : m_hiddenOnRestore.remove(curveId);
+        if (hidden) {
+            m_deferredCurveIds.insert(curveId);
+        } else {
+            curvesToPlot.append(curve);
+        }
+    }
+
+    m_plotWidget->addCurves(curvesToPlot);
+    for (const ThermalCurve* curve : qAsConst(curvesToPlot)) {
+        m_treeManager->setCurveColor(curve->id(), m_plotWidget->getCurveColor(curve->id()));
+        applyPendingAnnotations(curve->id());
+    }
+
+    if (m_projectExplorer && m_projectExplorer->treeView()) {
+        m_projectExplorer->treeView()->expandAll();
+    }
+
+    ThermalCurve* activeCurve = m_curveManager->getActiveCurve();
+    if (activeCurve && curveIds.contains(activeCurve->id())) {
+        highlightCurve(activeCurve->id());
+    }
+}
+
 void CurveViewController::onCurveRemoved(const QString& curveId)
 {
     qDebug() << "CurveViewController::onCurveRemoved - 曲线已移除:" << curveId;
@@ -123,6 +271,10 @@ void CurveViewController::onCurveRemoved(const QString& curveId)
         return;
     }
 
+    m_deferredCurveIds.remove(curveId);
+    m_pendingMarkers.remove(curveId);
+    m_pendingLabels.remove(curveId);
+
     m_plotWidget->removeCurve(curveId);
 }
 
@@ -134,6 +286,11 @@ void CurveViewController::onCurveDataChanged(const QString& curveId)
         return;
     }
 
+    // 尚未绘制的曲线在首次绘制时读取最新数据
+    if (m_deferredCurveIds.contains(curveId)) {
+        return;
+    }
+
     ThermalCurve* curve = m_curveManager->getCurve(curveId);
     if (!curve) {
         qWarning() << "CurveViewController::onCurveDataChanged - 未找到曲线数据，ID:" << curveId;
@@ -143,6 +300,22 @@ void CurveViewController::onCurveDataChanged(const QString& curveId)
     m_plotWidget->updateCurve(*curve);
 }
 
+void CurveViewController::onCurveDataAppended(const QString& curveId, int firstNewIndex)
+{
+    if (!validateComponents() || m_deferredCurveIds.contains(curveId)) {
+        return;
+    }
+
+    ThermalCurve* curve = m_curveManager->getCurve(curveId);
+    if (!curve) {
+        qWarning() << "CurveViewController::onCurveDataAppended - 未找到曲线数据，ID:" << curveId;
+        return;
+    }
+
+    // 只追加新点，不重建整条系列
+    m_plotWidget->appendCurveData(*curve, firstNewIndex);
+}
+
 void CurveViewController::onActiveCurveChanged(const QString& curveId)
 {
     qDebug() << "CurveViewController::onActiveCurveChanged - 活动曲线已变化:" << curveId;
@@ -168,6 +341,7 @@ void CurveViewController::onCurvesCleared()
         return;
     }
 
+    m_deferredCurveIds.clear();
     m_plotWidget->clearCurves();
 }
 
@@ -190,6 +364,11 @@ void CurveViewController::onCurveCheckStateChanged(const QString& curveId, bool
 {
     qDebug() << "CurveViewController::onCurveCheckStateChanged - 曲线:" << curveId << ", 勾选状态:" << checked;
 
+    // 未绘制的曲线在首次勾选时才绘制
+    if (checked) {
+        plotDeferredCurve(curveId);
+    }
+
     // 更新 ChartView 的曲线可见性
     setCurveVisible(curveId, checked);
 
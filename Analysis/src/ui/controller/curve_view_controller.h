@@ -1,8 +1,11 @@
 #ifndef CURVEVIEWCONTROLLER_H
 #define CURVEVIEWCONTROLLER_H
 
+#include "domain/model/project_document.h"
+#include <QHash>
 #include <QObject>
 #include <QPointF>
+#include <QSet>
 #include <QVector>
 #include <QString>
 
@@ -58,11 +61,30 @@ public:
      */
     void updateAllCurves();
 
+    /**
+     * @brief 准备恢复项目（须在 CurveManager::restoreProject() 之前调用）
+     * @param viewState 项目中保存的视图状态
+     *
+     * 保存时未勾选的曲线以未勾选状态加入树中且暂不绘制，其采样数据在首次勾选时才读取；
+     * 标注点与浮动标签在对应曲线首次绘制时恢复。
+     */
+    void prepareProjectRestore(const ProjectViewState& viewState);
+
+    /**
+     * @brief 收集当前视图状态（用于保存项目）
+     *
+     * 包括未勾选的曲线、图表上的标注点与数据锚定的浮动标签，
+     * 以及尚未绘制的曲线仍在等待恢复的标注。
+     */
+    ProjectViewState collectViewState() const;
+
 private slots:
     // --- 响应 CurveManager 信号 ---
     void onCurveAdded(const QString& curveId);
+    void onCurvesAdded(const QStringList& curveIds);
     void onCurveRemoved(const QString& curveId);
     void onCurveDataChanged(const QString& curveId);
+    void onCurveDataAppended(const QString& curveId, int firstNewIndex);
     void onActiveCurveChanged(const QString& curveId);
     void onCurvesCleared();
 
@@ -80,10 +102,20 @@ private:
     bool validatePlotWidget() const;
     bool validateCurveId(const QString& curveId) const;
 
+    // --- 绘制辅助函数 ---
+    void plotCurve(const ThermalCurve& curve);
+    void plotDeferredCurve(const QString& curveId);
+    void applyPendingAnnotations(const QString& curveId);
+
     CurveManager* m_curveManager;
     ChartView* m_plotWidget;
     ProjectTreeManager* m_treeManager;
     ProjectExplorerView* m_projectExplorer;
+
+    QSet<QString> m_hiddenOnRestore;                           // 恢复项目时保存为未勾选、尚未添加的曲线
+    QSet<QString> m_deferredCurveIds;                          // 已添加但未绘制的曲线（首次勾选时绘制）
+    QHash<QString, CurveMarkerSet> m_pendingMarkers;           // 等待曲线首次绘制时恢复的标注点
+    QMultiHash<QString, CurveLabelAnnotation> m_pendingLabels; // 等待曲线首次绘制时恢复的浮动标签
 };
 
 #endif // CURVEVIEWCONTROLLER_H
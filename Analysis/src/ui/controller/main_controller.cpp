@@ -4,23 +4,31 @@
 #include "ui/controller/curve_view_controller.h"
 #include "ui/data_import_widget.h"
 #include "ui/peak_area_dialog.h"
+#include <QCollator>
 #include <QDebug>
+#include <QDir>
+#include <QFileDialog>
+#include <QFileInfo>
 #include <QtGlobal>
 
 #include "application/algorithm/algorithm_context.h"
 #include "application/algorithm/algorithm_coordinator.h"
 #include "application/algorithm/algorithm_manager.h"
 #include "application/history/algorithm_command.h"
+#include "application/history/autosave_manager.h"
 #include "application/history/add_curve_command.h"
 #include "application/history/clear_curves_command.h"
 #include "application/history/remove_curve_command.h"
 #include "application/history/history_manager.h"
+#include "domain/model/project_document.h"
 #include "domain/algorithm/i_thermal_algorithm.h"
+#include "infrastructure/io/i_file_reader.h"
 #include "ui/chart_view.h"
 #include "ui/main_window.h"
 #include <QMessageBox>
 #include <QSignalBlocker>
 #include <QProgressDialog>
+#include <algorithm>
 #include <memory>
 
 MainController::MainController(CurveManager* curveManager,
@@ -45,6 +53,16 @@ MainController::MainController(CurveManager* curveManager,
     // 命令路径：DataImportWidget → MainController
     connect(m_dataImportWidget, &DataImportWidget::previewRequested, this, &MainController::onPreviewRequested);
     connect(m_dataImportWidget, &DataImportWidget::importRequested, this, &MainController::onImportTriggered);
+    connect(m_dataImportWidget, &DataImportWidget::folderImportRequested, this, &MainController::onFolderImportTriggered);
+
+    // 异步导入：CurveManager → MainController
+    connect(m_curveManager, &CurveManager::importStarted, this, &MainController::onImportStarted);
+    connect(m_curveManager, &CurveManager::importProgress, this, &MainController::onImportProgress);
+    connect(m_curveManager, &CurveManager::importFinished, this, &MainController::onImportFinished);
+    connect(m_curveManager, &CurveManager::importBatchFinished, this, &MainController::onImportBatchFinished);
+    connect(m_curveManager, &CurveManager::importFailed, this, &MainController::onImportFailed);
+    connect(m_curveManager, &CurveManager::importCancelled, this, &MainController::onImportCancelled);
+    connect(m_curveManager, &CurveManager::followStopped, this, &MainController::onFollowStopped);
 }
 
 MainController::~MainController()
@@ -107,6 +125,35 @@ void MainController::setPlotWidget(ChartView* plotWidget)
             }, Qt::UniqueConnection);
 }
 
+void MainController::setAutosaveManager(AutosaveManager* autosaveManager) { m_autosaveManager = autosaveManager; }
+
+void MainController::offerAutosaveRecovery()
+{
+    if (!m_autosaveManager || !m_autosaveManager->hasRecoverableJournal()) {
+        return;
+    }
+
+    const auto answer = QMessageBox::question(m_mainWindow, QStringLiteral("恢复自动保存"),
+                                              QStringLiteral("程序上次未正常退出，是否从自动保存恢复曲线？\n"
+                                                             "（标注点与浮动标签不会恢复；选择“否”将丢弃自动保存的内容）"));
+    if (answer != QMessageBox::Yes) {
+        return;
+    }
+
+    ProjectDocument document;
+    int batchCount = 0;
+    QString errorMessage;
+    if (!m_autosaveManager->recover(&document, &batchCount, &errorMessage)) {
+        QMessageBox::warning(m_mainWindow, QStringLiteral("恢复失败"), errorMessage);
+        return;
+    }
+
+    m_curveViewController->prepareProjectRestore(document.viewState);
+    m_curveManager->restoreProject(document);
+    m_historyManager->clear();
+    qDebug() << "MainController: 已从自动保存恢复" << document.curves.size() << "条曲线，批次数:" << batchCount;
+}
+
 void MainController::attachMainWindow(MainWindow* mainWindow)
 {
     if (!mainWindow) {
@@ -116,6 +163,9 @@ void MainController::attachMainWindow(MainWindow* mainWindow)
     m_mainWindow = mainWindow;
 
     connect(mainWindow, &MainWindow::dataImportRequested, this, &MainController::onShowDataImport, Qt::UniqueConnection);
+    connect(mainWindow, &MainWindow::curveCacheSaveRequested, this, &MainController::onCurveCacheSaveRequested, Qt::UniqueConnection);
+    connect(mainWindow, &MainWindow::projectOpenRequested, this, &MainController::onProjectOpenRequested, Qt::UniqueConnection);
+    connect(mainWindow, &MainWindow::projectSaveRequested, this, &MainController::onProjectSaveRequested, Qt::UniqueConnection);
     connect(mainWindow, &MainWindow::curveDeleteRequested, this, &MainController::onCurveDeleteRequested, Qt::UniqueConnection);
     connect(mainWindow, &MainWindow::undoRequested, this, &MainController::onUndo, Qt::UniqueConnection);
     connect(mainWindow, &MainWindow::redoRequested, this, &MainController::onRedo, Qt::UniqueConnection);
@@ -141,6 +191,7 @@ void MainController::attachMainWindow(MainWindow* mainWindow)
     }, Qt::UniqueConnection);
 
     connect(mainWindow, &MainWindow::algorithmRequestedWithParams, this, &MainController::onAlgorithmRequested, Qt::UniqueConnection);
+    connect(mainWindow, &MainWindow::batchAlgorithmRequested, this, &MainController::onBatchAlgorithmRequested, Qt::UniqueConnection);
 }
 
 void MainController::setCurveViewController(CurveViewController* ViewController)
@@ -225,24 +276,118 @@ void MainController::onImportTriggered()
         return;
     }
 
-    // 2. 使用命令模式清空已有曲线（支持撤销）
-    auto clearCommand = std::make_unique<ClearCurvesCommand>(
-        m_curveManager,
-        QStringLiteral("导入前清空曲线")
-    );
-    if (!m_historyManager->executeCommand(std::move(clearCommand))) {
+    if (!m_importTaskId.isEmpty()) {
+        qWarning() << "导入请求被忽略：上一个导入任务尚未结束。";
+        return;
+    }
+
+    // 仪器导出的大文件按行切块多线程解析（读取器对小文件仍按单线程顺序读取）
+    config.insert(FileReaderOptions::ParallelParse, true);
+
+    // 2. 使用命令模式清空已有曲线（支持撤销；导入失败或取消时撤销此命令恢复原曲线）
+    if (!clearCurvesForImport()) {
         qWarning() << "MainController::onImportTriggered - 清空曲线命令执行失败";
         return;
     }
 
-    // 3. 委托给 CurveManager 读取文件（支持配置）
-    QString curveId = m_curveManager->loadCurveFromFileWithConfig(filePath, config);
+    // 3. 委托给 CurveManager 在导入线程中读取文件，结果通过 onImportFinished 返回
+    m_importTaskId = m_curveManager->loadCurveFromFileAsync(filePath, config);
+
+    if (m_importTaskId.isEmpty()) {
+        qWarning() << "导入失败：未找到适用于文件的读取器。";
+        restoreCurvesClearedForImport();
+    }
+}
+
+void MainController::onFolderImportTriggered(const QString& folderPath)
+{
+    qDebug() << "控制器：收到文件夹导入请求：" << folderPath;
+
+    if (!m_importTaskId.isEmpty()) {
+        qWarning() << "导入请求被忽略：上一个导入任务尚未结束。";
+        return;
+    }
+
+    // 1. 与当前预览文件同类型的文件使用同一套列映射；未选择文件时导入所有 .txt/.csv
+    const QVariantMap config = m_dataImportWidget->getImportConfig();
+    const QString suffix = QFileInfo(config.value("filePath").toString()).suffix();
+    const QStringList nameFilters = suffix.isEmpty() ? QStringList { "*.txt", "*.csv" } : QStringList { "*." + suffix };
+    const QDir folder(folderPath);
+    QStringList fileNames = folder.entryList(nameFilters, QDir::Files);
+
+    // 按自然顺序排列（如 5K、10K、20K），曲线按此顺序加入
+    QCollator collator;
+    collator.setNumericMode(true);
+    std::sort(fileNames.begin(), fileNames.end(), collator);
+
+    if (fileNames.isEmpty()) {
+        QMessageBox::information(m_dataImportWidget, QStringLiteral("导入文件夹"), QStringLiteral("文件夹中没有可导入的文件。"));
+        return;
+    }
+    QStringList filePaths;
+    for (const QString& fileName : qAsConst(fileNames)) {
+        filePaths.append(folder.filePath(fileName));
+    }
+
+    // 2. 与单文件导入相同：先以可撤销的命令清空已有曲线，失败或取消时撤销
+    if (!clearCurvesForImport()) {
+        qWarning() << "MainController::onFolderImportTriggered - 清空曲线命令执行失败";
+        return;
+    }
+
+    // 3. 各文件在导入线程的线程池中并发读取（每个文件单线程解析），结果通过 onImportBatchFinished 一次性返回
+    m_importTaskId = m_curveManager->loadCurvesFromFilesAsync(filePaths, config);
+
+    if (m_importTaskId.isEmpty()) {
+        qWarning() << "导入失败：未找到适用于文件的读取器。";
+        restoreCurvesClearedForImport();
+    }
+}
+
+void MainController::onImportStarted(const QString& taskId, const QString& filePath)
+{
+    if (taskId != m_importTaskId) {
+        return;
+    }
+
+    cleanupProgressDialog();
+
+    QProgressDialog* dialog = ensureProgressDialog();
+    {
+        QSignalBlocker blocker(dialog);
+        dialog->setWindowTitle(QStringLiteral("导入数据"));
+        dialog->setLabelText(QStringLiteral("正在导入: %1\n请稍候...").arg(QFileInfo(filePath).fileName()));
+        dialog->setRange(0, 100);
+        dialog->setValue(0);
+        dialog->setMinimumDuration(0);
+    }
+
+    dialog->show();
+}
+
+void MainController::onImportProgress(const QString& taskId, int percentage, const QString& message)
+{
+    if (taskId != m_importTaskId || !m_progressDialog) {
+        return;
+    }
+
+    m_progressDialog->setValue(percentage);
+    if (!message.isEmpty()) {
+        QString text = m_progressDialog->labelText().split('\n').first();  // 保留第一行（文件名）
+        m_progressDialog->setLabelText(text + "\n" + message);
+    }
+}
 
-    if (curveId.isEmpty()) {
-        qWarning() << "导入失败：读取文件失败或曲线无效。";
+void MainController::onImportFinished(const QString& taskId, const QString& curveId)
+{
+    if (taskId != m_importTaskId) {
         return;
     }
 
+    m_importTaskId.clear();
+    cleanupProgressDialog();
+    discardCurvesClearedForImport();
+
     // 4. 设置为活动曲线
     m_curveManager->setActiveCurve(curveId);
 
@@ -256,6 +401,228 @@ void MainController::onImportTriggered()
     m_dataImportWidget->close();
 }
 
+void MainController::onImportBatchFinished(const QString& taskId, const QStringList& curveIds, const QStringList& errors)
+{
+    if (taskId != m_importTaskId) {
+        return;
+    }
+
+    m_importTaskId.clear();
+    cleanupProgressDialog();
+    discardCurvesClearedForImport();
+
+    if (!curveIds.isEmpty()) {
+        m_curveManager->setActiveCurve(curveIds.last());
+        if (ThermalCurve* curve = m_curveManager->getCurve(curveIds.last())) {
+            emit curveAvailable(*curve);
+        }
+    }
+
+    if (!errors.isEmpty()) {
+        qWarning() << "部分文件导入失败：" << errors;
+        QMessageBox::warning(m_dataImportWidget, QStringLiteral("部分文件导入失败"),
+                             QStringLiteral("已导入 %1 个文件，以下 %2 个文件导入失败：\n%3")
+                                 .arg(curveIds.size())
+                                 .arg(errors.size())
+                                 .arg(errors.join('\n')));
+    }
+
+    m_dataImportWidget->close();
+}
+
+void MainController::onImportFailed(const QString& taskId, const QString& errorMessage)
+{
+    if (taskId != m_importTaskId) {
+        return;
+    }
+
+    m_importTaskId.clear();
+    cleanupProgressDialog();
+
+    // 撤销导入前的清空操作，恢复原有曲线
+    restoreCurvesClearedForImport();
+
+    qWarning() << "导入失败：" << errorMessage;
+    QMessageBox::warning(m_dataImportWidget, QStringLiteral("导入失败"), errorMessage);
+}
+
+void MainController::onImportCancelled(const QString& taskId)
+{
+    if (taskId != m_importTaskId) {
+        return;
+    }
+
+    m_importTaskId.clear();
+    cleanupProgressDialog();
+
+    // 撤销导入前的清空操作，恢复原有曲线
+    restoreCurvesClearedForImport();
+
+    qDebug() << "控制器：导入已取消。";
+}
+
+bool MainController::clearCurvesForImport()
+{
+    m_importSavedCurves = m_curveManager->getAllCurves();
+    const ThermalCurve* active = m_curveManager->getActiveCurve();
+    m_importSavedActiveId = active ? active->id() : QString();
+
+    auto clearCommand = std::make_unique<ClearCurvesCommand>(
+        m_curveManager,
+        QStringLiteral("导入前清空曲线")
+    );
+    const ICommand* command = clearCommand.get();
+    if (!m_historyManager->executeCommand(std::move(clearCommand))) {
+        discardCurvesClearedForImport();
+        return false;
+    }
+    m_importClearCommand = command;
+    return true;
+}
+
+void MainController::restoreCurvesClearedForImport()
+{
+    // 导入是异步的，进度对话框显示之前用户可能又执行了其他命令：栈顶已不是清空命令时不能盲目撤销
+    if (!m_historyManager->undoIfTop(m_importClearCommand)) {
+        qWarning() << "MainController: 导入前的清空命令已不在撤销栈顶，直接恢复被清空的曲线";
+        QVector<ThermalCurve> missing;
+        for (const ThermalCurve& curve : orderParentFirst(m_importSavedCurves)) {
+            if (!m_curveManager->getCurve(curve.id())) {
+                missing.append(curve);
+            }
+        }
+        if (!missing.isEmpty()) {
+            m_curveManager->addCurves(missing);
+        }
+        if (!m_importSavedActiveId.isEmpty() && m_curveManager->getCurve(m_importSavedActiveId)) {
+            m_curveManager->setActiveCurve(m_importSavedActiveId);
+        }
+    }
+
+    discardCurvesClearedForImport();
+}
+
+void MainController::discardCurvesClearedForImport()
+{
+    m_importClearCommand = nullptr;
+    m_importSavedCurves.clear();
+    m_importSavedActiveId.clear();
+}
+
+void MainController::onFollowStopped(const QString& curveId, const QString& reason)
+{
+    // 主动停止（删除曲线等）时原因为空，无需提示
+    if (reason.isEmpty()) {
+        return;
+    }
+
+    const ThermalCurve* curve = m_curveManager->getCurve(curveId);
+    const QString name = curve ? curve->name() : curveId;
+    QMessageBox::information(m_mainWindow, QStringLiteral("停止跟随文件"),
+                             QStringLiteral("曲线“%1”已停止跟随源文件：%2").arg(name, reason));
+}
+
+void MainController::onCurveCacheSaveRequested()
+{
+    // 写入后会释放曲线的文件映射，算法线程可能仍在读取这些数据
+    if (!m_currentTaskId.isEmpty()) {
+        QMessageBox::information(m_mainWindow, QStringLiteral("保存曲线缓存"), QStringLiteral("请等待当前算法任务完成。"));
+        return;
+    }
+
+    ThermalCurve* curve = m_curveManager->getActiveCurve();
+    if (!curve) {
+        QMessageBox::information(m_mainWindow, QStringLiteral("保存曲线缓存"), QStringLiteral("请先选择要保存的曲线。"));
+        return;
+    }
+
+    // 默认保存在源文件旁边，文件名与源文件相同
+    const QString sourceFile = curve->getMetadata().additional.value("source_file").toString();
+    const QFileInfo sourceInfo(sourceFile.isEmpty() ? curve->projectName() : sourceFile);
+    const QString defaultPath = sourceInfo.absoluteDir().filePath(sourceInfo.completeBaseName() + ".tcurve");
+
+    const QString filePath = QFileDialog::getSaveFileName(m_mainWindow, QStringLiteral("保存曲线缓存"), defaultPath,
+                                                          QStringLiteral("曲线缓存文件 (*.tcurve)"));
+    if (filePath.isEmpty()) {
+        return;
+    }
+
+    // 目标文件可能正被映射，覆盖前等待自动保存线程停止读取曲线数据
+    if (m_autosaveManager) {
+        m_autosaveManager->waitForPendingWrites();
+    }
+
+    QString errorMessage;
+    if (!m_curveManager->saveCurveToFile(curve->id(), filePath, &errorMessage)) {
+        QMessageBox::warning(m_mainWindow, QStringLiteral("保存失败"), errorMessage);
+    }
+}
+
+void MainController::onProjectOpenRequested()
+{
+    // 导入或算法执行期间替换曲线会使结果落到新项目中
+    if (!m_importTaskId.isEmpty() || !m_currentTaskId.isEmpty() || m_curveManager->hasPendingImports()) {
+        QMessageBox::information(m_mainWindow, QStringLiteral("打开项目"), QStringLiteral("请等待当前导入或算法任务完成。"));
+        return;
+    }
+
+    if (!m_curveManager->getAllCurves().isEmpty()) {
+        const auto answer = QMessageBox::question(m_mainWindow, QStringLiteral("打开项目"),
+                                                  QStringLiteral("打开项目将替换当前所有曲线，且无法撤销。是否继续？"));
+        if (answer != QMessageBox::Yes) {
+            return;
+        }
+    }
+
+    const QString filePath = QFileDialog::getOpenFileName(m_mainWindow, QStringLiteral("打开项目"), QString(),
+                                                          QStringLiteral("项目文件 (*.tproj)"));
+    if (filePath.isEmpty()) {
+        return;
+    }
+
+    // 只读取索引块，曲线采样数据在首次绘制或分析时才从文件读入
+    ProjectDocument document;
+    QString errorMessage;
+    if (!m_curveManager->readProject(filePath, &document, &errorMessage)) {
+        QMessageBox::warning(m_mainWindow, QStringLiteral("打开失败"), errorMessage);
+        return;
+    }
+
+    m_curveViewController->prepareProjectRestore(document.viewState);
+    m_curveManager->restoreProject(document);
+    m_historyManager->clear();
+    m_projectFilePath = filePath;
+}
+
+void MainController::onProjectSaveRequested()
+{
+    if (!m_currentTaskId.isEmpty()) {
+        QMessageBox::information(m_mainWindow, QStringLiteral("保存项目"), QStringLiteral("请等待当前算法任务完成。"));
+        return;
+    }
+
+    QString filePath = m_projectFilePath;
+    if (filePath.isEmpty()) {
+        const QString defaultPath = QDir::home().filePath(QStringLiteral("未命名项目.tproj"));
+        filePath = QFileDialog::getSaveFileName(m_mainWindow, QStringLiteral("保存项目"), defaultPath,
+                                                QStringLiteral("项目文件 (*.tproj)"));
+        if (filePath.isEmpty()) {
+            return;
+        }
+    }
+
+    if (m_autosaveManager) {
+        m_autosaveManager->waitForPendingWrites();
+    }
+
+    QString errorMessage;
+    if (!m_curveManager->saveProject(filePath, m_curveViewController->collectViewState(), &errorMessage)) {
+        QMessageBox::warning(m_mainWindow, QStringLiteral("保存失败"), errorMessage);
+        return;
+    }
+    m_projectFilePath = filePath;
+}
+
 // ========== 处理命令的槽函数（命令路径：UI → Controller → Service） ==========
 void MainController::onAlgorithmRequested(const QString& algorithmName, const QVariantMap& params)
 {
@@ -269,6 +636,15 @@ void MainController::onAlgorithmRequested(const QString& algorithmName, const QV
     m_algorithmCoordinator->handleAlgorithmTriggered(algorithmName, params);
 }
 
+void MainController::onBatchAlgorithmRequested(const QString& algorithmName, const QVariantMap& params)
+{
+    Q_ASSERT(m_initialized);  // 确保依赖完整
+
+    qDebug() << "MainController: 接收到批量算法执行请求：" << algorithmName;
+
+    m_algorithmCoordinator->handleBatchAlgorithmTriggered(algorithmName, params);
+}
+
 
 void MainController::onUndo()
 {
@@ -586,6 +962,13 @@ QProgressDialog* MainController::ensureProgressDialog()
 
 void MainController::handleProgressDialogCancelled()
 {
+    if (!m_importTaskId.isEmpty()) {
+        // 导入任务：请求取消后由 onImportCancelled 收尾（读取器在下一次检查取消标志时停止）
+        qDebug() << "[MainController] 用户点击取消按钮，取消导入:" << m_importTaskId;
+        m_curveManager->cancelImport(m_importTaskId);
+        return;
+    }
+
     qDebug() << "[MainController] 用户点击取消按钮，尝试取消算法:" << m_currentAlgorithmName
              << "taskId:" << m_currentTaskId;
 
@@ -593,7 +976,11 @@ void MainController::handleProgressDialogCancelled()
     const QString algorithmName = m_currentAlgorithmName;
 
     bool cancelled = false;
-    if (m_algorithmManager && !taskId.isEmpty()) {
+    if (m_algorithmCoordinator && !taskId.isEmpty()) {
+        // 批量执行时 taskId 为批次ID，由协调器取消整个批次
+        cancelled = m_algorithmCoordinator->cancelBatch(taskId);
+    }
+    if (!cancelled && m_algorithmManager && !taskId.isEmpty()) {
         cancelled = m_algorithmManager->cancelTask(taskId);
     }
 
@@ -1,6 +1,8 @@
 ﻿#ifndef MAINCONTROLLER_H
 #define MAINCONTROLLER_H
 
+#include "domain/model/thermal_curve.h"
+#include <QMap>
 #include <QObject>
 #include <QString>
 #include <QVariantMap>
@@ -9,7 +11,7 @@
 // 前置声明
 class CurveManager;
 class DataImportWidget;
-class ThermalCurve;
+class ICommand;
 class AlgorithmManager;
 class AlgorithmCoordinator;
 class AlgorithmContext;
@@ -17,6 +19,7 @@ class HistoryManager;
 class ChartView;
 class MainWindow;
 class CurveViewController;
+class AutosaveManager;
 
 /**
  * @brief MainController 协调UI和应用服务。
@@ -36,6 +39,7 @@ public:
     void attachMainWindow(MainWindow* mainWindow);
     void setCurveViewController(CurveViewController* ViewController);
     void setAlgorithmCoordinator(AlgorithmCoordinator* coordinator, AlgorithmContext* context);
+    void setAutosaveManager(AutosaveManager* autosaveManager); // 可选：未设置时不提供崩溃恢复
 
     /**
      * @brief 完整性校验与状态标记
@@ -47,6 +51,13 @@ public:
      */
     void initialize();
 
+    /**
+     * @brief 存在上次异常退出留下的自动保存日志时询问用户是否恢复
+     *
+     * 在主窗口显示后、AutosaveManager::start() 之前调用（start() 会覆盖日志）。
+     */
+    void offerAutosaveRecovery();
+
 signals:
     /**
      * @brief 当一个曲线被加载并可用于在UI的其他部分显示时发出此信号。
@@ -68,6 +79,13 @@ public slots:
      */
     void onAlgorithmRequested(const QString& algorithmName, const QVariantMap& params = QVariantMap());
 
+    /**
+     * @brief 对所有勾选的曲线批量执行算法
+     * @param algorithmName 算法名称
+     * @param params 算法参数（所有曲线共用）
+     */
+    void onBatchAlgorithmRequested(const QString& algorithmName, const QVariantMap& params = QVariantMap());
+
     /**
      * @brief 撤销最近的操作。
      */
@@ -81,6 +99,21 @@ public slots:
     // 响应UI的曲线删除请求
     void onCurveDeleteRequested(const QString& curveId);
 
+    /**
+     * @brief 将活动曲线保存为 .tcurve 缓存文件（弹出保存对话框）
+     */
+    void onCurveCacheSaveRequested();
+
+    /**
+     * @brief 打开 .tproj 项目文件，替换当前所有曲线（清空撤销历史）
+     */
+    void onProjectOpenRequested();
+
+    /**
+     * @brief 保存当前项目（尚未保存过时弹出保存对话框）
+     */
+    void onProjectSaveRequested();
+
     /**
      * @brief 处理峰面积工具请求
      */
@@ -97,6 +130,21 @@ private slots:
      * @brief 处理最终的数据导入请求。
      */
     void onImportTriggered();
+
+    /**
+     * @brief 按导入窗口的当前配置并发导入文件夹中的所有同类文件。
+     * @param folderPath 文件夹路径。
+     */
+    void onFolderImportTriggered(const QString& folderPath);
+
+    // ==================== 异步导入反馈槽函数 ====================
+    void onImportStarted(const QString& taskId, const QString& filePath);
+    void onImportProgress(const QString& taskId, int percentage, const QString& message);
+    void onImportFinished(const QString& taskId, const QString& curveId);
+    void onImportBatchFinished(const QString& taskId, const QStringList& curveIds, const QStringList& errors);
+    void onImportFailed(const QString& taskId, const QString& errorMessage);
+    void onImportCancelled(const QString& taskId);
+    void onFollowStopped(const QString& curveId, const QString& reason);
     void onCoordinatorRequestPointSelection(const QString& algorithmName, const QString& curveId, int requiredPoints, const QString& hint);
     void onCoordinatorShowMessage(const QString& text);
     void onCoordinatorAlgorithmFailed(const QString& algorithmName, const QString& reason);
@@ -122,6 +170,7 @@ private:
     ChartView* m_plotWidget = nullptr;    // 非拥有指针
     MainWindow* m_mainWindow = nullptr;   // 非拥有指针
     CurveViewController* m_curveViewController = nullptr;
+    AutosaveManager* m_autosaveManager = nullptr; // 非拥有指针（可选）
 
     // 拥有的对象
     DataImportWidget* m_dataImportWidget; // 拥有指针
@@ -130,9 +179,31 @@ private:
     class QProgressDialog* m_progressDialog = nullptr;  // 拥有指针
     QString m_currentTaskId;         // 当前任务ID（用于验证进度信号）
     QString m_currentAlgorithmName;  // 当前算法名称（用于提示）
+    QString m_importTaskId;          // 当前导入任务ID（非空表示正在导入）
+    const ICommand* m_importClearCommand = nullptr;  // 导入前提交的清空命令（只用于比较身份）
+    QMap<QString, ThermalCurve> m_importSavedCurves; // 导入前清空的曲线（采样数据为共享句柄）
+    QString m_importSavedActiveId;                   // 导入前的活动曲线
+    QString m_projectFilePath;       // 当前项目文件路径（打开或保存后设置）
 
     void cleanupProgressDialog();
     QProgressDialog* ensureProgressDialog();
+
+    /**
+     * @brief 导入前以可撤销的命令清空已有曲线，并记下被清空的曲线
+     */
+    bool clearCurvesForImport();
+
+    /**
+     * @brief 导入失败或取消后恢复导入前清空的曲线
+     *
+     * 清空命令仍在撤销栈顶时撤销它；期间已有其他命令入栈时不动历史记录，直接加回被清空的曲线。
+     */
+    void restoreCurvesClearedForImport();
+
+    /**
+     * @brief 导入成功后丢弃保存的清空前状态（清空命令留在历史中，由用户撤销）
+     */
+    void discardCurvesClearedForImport();
     void handleProgressDialogCancelled();
 };
 
@@ -5,6 +5,7 @@
 #include <QDebug>
 #include <QDoubleSpinBox>
 #include <QFileDialog>
+#include <QFileInfo>
 #include <QFormLayout>
 #include <QFrame>
 #include <QGridLayout>
@@ -96,11 +97,15 @@ DataImportWidget::DataImportWidget(QWidget* parent)
     paramsLayout->addWidget(rateGroup);
 
     // 底部按钮
+    m_followFileChk = new QCheckBox(tr("导入后跟随文件追加（实验进行中）"), this);
     m_importBtn = new QPushButton(tr("导入"), this);
+    m_importFolderBtn = new QPushButton(tr("按此配置导入文件夹..."), this);
     m_closeBtn = new QPushButton(tr("关闭"), this);
 
     auto* btnLayout = new QHBoxLayout;
+    btnLayout->addWidget(m_followFileChk);
     btnLayout->addStretch();
+    btnLayout->addWidget(m_importFolderBtn);
     btnLayout->addWidget(m_importBtn);
     btnLayout->addWidget(m_closeBtn);
 
@@ -241,6 +246,7 @@ void DataImportWidget::setupConnections()
 {
     connect(m_browseBtn, &QPushButton::clicked, this, &DataImportWidget::onBrowseFile);
     connect(m_importBtn, &QPushButton::clicked, this, &DataImportWidget::onImportClicked);
+    connect(m_importFolderBtn, &QPushButton::clicked, this, &DataImportWidget::onImportFolderClicked);
     connect(m_closeBtn, &QPushButton::clicked, this, &DataImportWidget::onCloseClicked);
 
     connect(m_tempHasColumnChk, &QCheckBox::toggled, this, [this](bool checked) {
@@ -360,6 +366,16 @@ void DataImportWidget::setPreviewData(const FilePreviewData& previewData)
 
 void DataImportWidget::onImportClicked() { emit importRequested(); }
 
+void DataImportWidget::onImportFolderClicked()
+{
+    const QString startDir = QFileInfo(m_filePathEdit->text()).absolutePath();
+    const QString folder = QFileDialog::getExistingDirectory(this, tr("选择要批量导入的文件夹"), startDir);
+    if (folder.isEmpty()) {
+        return;
+    }
+    emit folderImportRequested(folder);
+}
+
 void DataImportWidget::onCloseClicked() { close(); }
 
 QVariantMap DataImportWidget::getImportConfig() const
@@ -400,5 +416,7 @@ QVariantMap DataImportWidget::getImportConfig() const
     config.insert(QStringLiteral("rateUnit"), m_rateUnitCombo->currentText());
     config.insert(QStringLiteral("dynamicRate"), m_dynamicRateSpin->value());
 
+    config.insert(QStringLiteral("followFile"), m_followFileChk->isChecked());
+
     return config;
 }
@@ -71,6 +71,12 @@ signals:
      */
     void importRequested();
 
+    /**
+     * @brief 当用户选择按当前配置导入整个文件夹时发出
+     * @param folderPath 文件夹路径
+     */
+    void folderImportRequested(const QString& folderPath);
+
     /**
      * @brief 当用户选择文件后，请求预览
      * @param filePath 文件路径
@@ -88,6 +94,11 @@ private slots:
      */
     void onImportClicked();
 
+    /**
+     * @brief 处理"导入文件夹"按钮点击
+     */
+    void onImportFolderClicked();
+
     /**
      * @brief 处理"关闭"按钮点击
      */
@@ -201,7 +212,9 @@ private:
     QSpinBox* m_dynamicRateSpin;
 
     // 底部按钮
+    QCheckBox* m_followFileChk;
     QPushButton* m_importBtn;
+    QPushButton* m_importFolderBtn;
     QPushButton* m_closeBtn;
 };
 #endif // DATAIMPORTWIDGET_H
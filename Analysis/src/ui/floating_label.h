@@ -86,6 +86,11 @@ public:
      */
     QPointF anchorValue() const { return m_anchorValue; }
 
+    /**
+     * @brief 获取锚点所属的曲线系列（ViewAnchored 模式或未指定时为空）
+     */
+    QAbstractSeries* anchorSeries() const { return m_series; }
+
     /**
      * @brief 设置内边距
      * @param padding 边距（像素）
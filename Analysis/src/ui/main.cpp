@@ -1,6 +1,8 @@
 #include "application/application_context.h"
+#include "infrastructure/acquisition/simulated_instrument.h"
 
 #include <QApplication>
+#include <QCommandLineParser>
 #include <QLocale>
 #include <QTranslator>
 
@@ -18,8 +20,27 @@ int main(int argc, char* argv[])
         }
     }
 
+    // 开发/压测选项：--simulate TGA|DSC|ARC [--simulate-rate Hz] 启动后连接模拟仪器数据流
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    const QCommandLineOption simulateOption(QStringLiteral("simulate"), QStringLiteral("Stream simulated instrument data."),
+                                            QStringLiteral("TGA|DSC|ARC"));
+    const QCommandLineOption rateOption(QStringLiteral("simulate-rate"), QStringLiteral("Simulated sample rate in Hz."),
+                                        QStringLiteral("Hz"), QStringLiteral("10"));
+    parser.addOption(simulateOption);
+    parser.addOption(rateOption);
+    parser.process(a);
+
     ApplicationContext context;
     context.start();
 
+    if (parser.isSet(simulateOption)) {
+        const QString instrument = parser.value(simulateOption).trimmed().toUpper();
+        SimulatedInstrumentConfig config = SimulatedInstrumentConfig::defaults(
+            instrument == "DSC" ? InstrumentType::DSC : instrument == "ARC" ? InstrumentType::ARC : InstrumentType::TGA);
+        config.sampleRateHz = qBound(1.0, parser.value(rateOption).toDouble(), 1e6);
+        context.startSimulatedInstrument(config);
+    }
+
     return a.exec();
 }
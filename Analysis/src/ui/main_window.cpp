@@ -145,11 +145,18 @@ QToolBar* MainWindow::createFileToolBar()
 {
     QToolBar* toolbar = new QToolBar();
     toolbar->addAction(style()->standardIcon(QStyle::SP_FileIcon), tr("新建项目"));
-    toolbar->addAction(style()->standardIcon(QStyle::SP_DialogOpenButton), tr("打开..."));
-    toolbar->addAction(style()->standardIcon(QStyle::SP_DialogSaveButton), tr("保存"));
+    QAction* openProjectAction = toolbar->addAction(style()->standardIcon(QStyle::SP_DialogOpenButton), tr("打开..."));
+    openProjectAction->setToolTip(tr("打开 .tproj 项目文件"));
+    connect(openProjectAction, &QAction::triggered, this, &MainWindow::projectOpenRequested);
+    QAction* saveProjectAction = toolbar->addAction(style()->standardIcon(QStyle::SP_DialogSaveButton), tr("保存"));
+    saveProjectAction->setToolTip(tr("保存整个项目（曲线树、派生曲线、标注点与浮动标签）"));
+    connect(saveProjectAction, &QAction::triggered, this, &MainWindow::projectSaveRequested);
     toolbar->addSeparator();
     QAction* importDataAction = toolbar->addAction(style()->standardIcon(QStyle::SP_DirOpenIcon), tr("导入数据..."));
     connect(importDataAction, &QAction::triggered, this, &MainWindow::on_toolButtonOpen_clicked);
+    QAction* saveCurveCacheAction = toolbar->addAction(style()->standardIcon(QStyle::SP_DriveHDIcon), tr("保存曲线缓存..."));
+    saveCurveCacheAction->setToolTip(tr("将活动曲线保存为 .tcurve 文件，之后可直接导入而无需重新解析文本"));
+    connect(saveCurveCacheAction, &QAction::triggered, this, &MainWindow::curveCacheSaveRequested);
     toolbar->addAction(style()->standardIcon(QStyle::SP_ArrowUp), tr("导出图表..."));
 
     toolbar->addSeparator();
@@ -224,6 +231,11 @@ QToolBar* MainWindow::createMathToolBar()
     QAction* integAction = toolbar->addAction(tr("积分"));
     integAction->setData("integration");
 
+    // 批量模式开关：开启后上述算法应用到项目树中所有勾选的曲线
+    m_batchModeAction = toolbar->addAction(tr("应用到勾选曲线"));
+    m_batchModeAction->setCheckable(true);
+    m_batchModeAction->setToolTip(tr("开启后，算法将对项目浏览器中所有勾选的曲线批量执行"));
+
     toolbar->addSeparator();
 
     // 添加基线校正按钮
@@ -273,6 +285,15 @@ void MainWindow::setupRightDock()
 // 通用算法触发槽（统一处理，减少代码重复）
 void MainWindow::onAlgorithmActionTriggered()
 {
+    // 批量模式下改为发射批量请求
+    if (m_batchModeAction && m_batchModeAction->isChecked()) {
+        auto* action = qobject_cast<QAction*>(sender());
+        if (action && !action->data().toString().isEmpty()) {
+            emit batchAlgorithmRequested(action->data().toString(), QVariantMap());
+        }
+        return;
+    }
+
     // 由于 algorithmRequested 和 newAlgorithmRequested 都连接到同一个 MainController 方法，
     // 我们可以简单地发射 algorithmRequested 信号
     triggerAlgorithmFromAction(&MainWindow::algorithmRequested);
@@ -287,7 +308,7 @@ void MainWindow::onMovingAverageAction()
     }
     QVariantMap params;
     params.insert("window", window);
-    emit algorithmRequestedWithParams("moving_average", params);
+    requestAlgorithm("moving_average", params);
 }
 
 void MainWindow::onMassLossToolRequested()
@@ -314,6 +335,15 @@ void MainWindow::triggerAlgorithmFromAction(void (MainWindow::*signal)(const QSt
     }
 }
 
+void MainWindow::requestAlgorithm(const QString& algorithmName, const QVariantMap& params)
+{
+    if (m_batchModeAction && m_batchModeAction->isChecked()) {
+        emit batchAlgorithmRequested(algorithmName, params);
+    } else {
+        emit algorithmRequestedWithParams(algorithmName, params);
+    }
+}
+
 void MainWindow::updateHistoryButtons()
 {
     if (!m_historyManager) {
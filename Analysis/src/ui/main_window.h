@@ -64,6 +64,21 @@ signals:
      */
     void dataImportRequested();
 
+    /**
+     * @brief 请求将活动曲线保存为二进制 .tcurve 缓存文件
+     */
+    void curveCacheSaveRequested();
+
+    /**
+     * @brief 请求打开 .tproj 项目文件
+     */
+    void projectOpenRequested();
+
+    /**
+     * @brief 请求保存当前项目（曲线树、派生曲线与标注）
+     */
+    void projectSaveRequested();
+
     /**
      * @brief 请求撤销操作
      */
@@ -93,6 +108,13 @@ signals:
      */
     void algorithmRequestedWithParams(const QString& algorithmName, const QVariantMap& params);
 
+    /**
+     * @brief 请求对所有勾选的曲线批量执行算法
+     * @param algorithmName 算法名称
+     * @param params 算法参数（所有曲线共用）
+     */
+    void batchAlgorithmRequested(const QString& algorithmName, const QVariantMap& params);
+
     // 视图操作信号
 
     /**
@@ -169,6 +191,13 @@ private:
      */
     void triggerAlgorithmFromAction(void (MainWindow::*signal)(const QString&));
 
+    /**
+     * @brief 发射算法请求（批量模式开启时改为批量请求）
+     * @param algorithmName 算法名称
+     * @param params 算法参数
+     */
+    void requestAlgorithm(const QString& algorithmName, const QVariantMap& params);
+
     // 初始化函数
 
     /**
@@ -240,6 +269,7 @@ private:
     // --- 操作 ---
     QAction* m_undoAction { nullptr };
     QAction* m_redoAction { nullptr };
+    QAction* m_batchModeAction { nullptr }; // 勾选时算法应用到所有勾选的曲线
 
     // --- 视图操作 ---
     QAction* m_toggleProjectExplorerAction { nullptr };
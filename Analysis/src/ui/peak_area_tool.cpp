@@ -1,5 +1,7 @@
 #include "peak_area_tool.h"
 #include "application/curve/curve_manager.h"
+#include "domain/model/cumulative_integral.h"
+#include "domain/model/monotonic_segment_index.h"
 #include "domain/model/thermal_curve.h"
 #include <QPainter>
 #include <QGraphicsSceneMouseEvent>
@@ -15,6 +17,39 @@
 // 设置为 1 启用调试日志，设置为 0 禁用（生产环境）
 #define DEBUG_PEAK_AREA_TOOL 0
 
+namespace {
+
+/**
+ * @brief 单调段的 X 范围
+ */
+void segmentRange(const ColumnView<double>& xs, const MonotonicSegmentIndex::Segment& segment,
+                  double& minX, double& maxX)
+{
+    minX = segment.ascending ? xs[segment.first] : xs[segment.last];
+    maxX = segment.ascending ? xs[segment.last] : xs[segment.first];
+}
+
+/**
+ * @brief 参考曲线 X 最小、最大的采样点（由各段端点求得，升温、降温曲线都适用）
+ */
+void extremeSamples(const ColumnView<double>& xs, const MonotonicSegmentIndex& segments,
+                    int& minIndex, int& maxIndex)
+{
+    minIndex = maxIndex = 0;
+    for (const MonotonicSegmentIndex::Segment& segment : segments.segments()) {
+        for (int i : { segment.first, segment.last }) {
+            if (xs[i] < xs[minIndex]) {
+                minIndex = i;
+            }
+            if (xs[i] > xs[maxIndex]) {
+                maxIndex = i;
+            }
+        }
+    }
+}
+
+} // namespace
+
 PeakAreaTool::PeakAreaTool(QChart* chart, QGraphicsItem* parent)
     : QGraphicsObject(parent)
     , m_chart(chart)
@@ -116,7 +151,8 @@ void PeakAreaTool::setXAxisMode(bool useTimeAxis)
     }
 
     m_useTimeAxis = useTimeAxis;
-    markDirty();  // ✅ 优化：标记脏，延迟计算
+    // 基线曲线未变，保留基线数据缓存；面积与多边形按新横轴重算（前缀积分和单调段索引按横轴各缓存一份，无需重新扫描）
+    m_isDirty = true;
     update();
 }
 
@@ -342,70 +378,137 @@ qreal PeakAreaTool::calculateArea()
 #endif
     }
 
-    // 梯形积分法计算面积
+    // 梯形积分法计算面积：逐个单调段按 X 升序求 ∫(曲线 - 基线) dx 后取绝对值累加。
+    // 降温段与升温段的峰面积同号，升降温循环的两段不会相互抵消；基线只在该段覆盖的范围内扣除
+    const ColumnView<double> xs = data.xColumn(m_useTimeAxis);
+    const ColumnView<double> ys = data.values();
+    const QSharedPointer<const CumulativeIntegral> integral = data.cumulativeIntegral(m_useTimeAxis);
     double area = 0.0;
-    int inRangeCount = 0;
-
-    for (int i = 0; i < data.size() - 1; ++i) {
-        double xi = m_useTimeAxis ? data[i].time : data[i].temperature;
-        double xi1 = m_useTimeAxis ? data[i + 1].time : data[i + 1].temperature;
-
-        // 检查是否在积分范围内
-        if (xi1 < x1 || xi > x2) {
+    for (const MonotonicSegmentIndex::Segment& segment : data.xSegments(m_useTimeAxis)->segments()) {
+        double segMin = 0.0;
+        double segMax = 0.0;
+        segmentRange(xs, segment, segMin, segMax);
+        const double lo = qMax(x1, segMin);
+        const double hi = qMin(x2, segMax);
+        if (hi <= lo) {
             continue;
         }
 
-        inRangeCount++;
+        const double curveArea = integral->integrateSegment(xs, ys, segment, lo, hi);
+        area += qAbs(curveArea - baselineArea(lo, hi));
 
-        // 裁剪到积分范围
-        double effectiveX1 = qMax(xi, x1);
-        double effectiveX2 = qMin(xi1, x2);
+#if DEBUG_PEAK_AREA_TOOL
+        qDebug() << "  单调段 [" << segment.first << "," << segment.last << "] 积分范围: [" << lo << "," << hi << "]"
+                 << "曲线面积:" << curveArea;
+#endif
+    }
 
-        // 🐛 BUG修复：使用 effectiveX1 和 effectiveX2 计算基线值（而不是 xi 和 xi1）
-        double baselineY1 = getBaselineValue(effectiveX1);
-        double baselineY2 = getBaselineValue(effectiveX2);
+#if DEBUG_PEAK_AREA_TOOL
+    qDebug() << "  计算得到的面积:" << area;
+#endif
 
-        // 插值计算边界点的曲线值
-        double curveY1, curveY2;
-        if (qAbs(xi1 - xi) > 1e-9) {
-            // 线性插值计算 effectiveX1 处的 Y 值
-            double ratio1 = (effectiveX1 - xi) / (xi1 - xi);
-            curveY1 = data[i].value + ratio1 * (data[i + 1].value - data[i].value);
+    return area;
+}
 
-            // 线性插值计算 effectiveX2 处的 Y 值
-            double ratio2 = (effectiveX2 - xi) / (xi1 - xi);
-            curveY2 = data[i].value + ratio2 * (data[i + 1].value - data[i].value);
-        } else {
-            // 避免除零
-            curveY1 = curveY2 = data[i].value;
-        }
+qreal PeakAreaTool::baselineArea(qreal lo, qreal hi)
+{
+    switch (m_baselineMode) {
+    case BaselineMode::Zero:
+        return 0.0;
 
-        // 计算有效的Y值（计算曲线 - 参考曲线）
-        double yi = curveY1 - baselineY1;
-        double yi1 = curveY2 - baselineY2;
+    case BaselineMode::Linear:
+        // 直线基线：梯形面积即精确值
+        return (getBaselineValue(lo) + getBaselineValue(hi)) / 2.0 * (hi - lo);
 
-#if DEBUG_PEAK_AREA_TOOL
-        if (inRangeCount <= 3) {
-            qDebug() << "  第" << inRangeCount << "个有效数据段:";
-            qDebug() << "    X: [" << effectiveX1 << "," << effectiveX2 << "], dx =" << (effectiveX2 - effectiveX1);
-            qDebug() << "    曲线Y: [" << curveY1 << "," << curveY2 << "]";
-            qDebug() << "    基线Y: [" << baselineY1 << "," << baselineY2 << "]";
-            qDebug() << "    净Y: [" << yi << "," << yi1 << "]";
+    case BaselineMode::ReferenceCurve: {
+        const ThermalDataSeries* data = referenceBaselineData();
+        if (!data) {
+            return 0.0;
+        }
+
+        const ColumnView<double> xs = data->xColumn(m_useTimeAxis);
+        const ColumnView<double> ys = data->values();
+        const QSharedPointer<const MonotonicSegmentIndex> segments = data->xSegments(m_useTimeAxis);
+        if (segments->segments().isEmpty()) {
+            return ys[0] * (hi - lo);  // 单点参考曲线即水平基线
+        }
+        const QSharedPointer<const CumulativeIntegral> integral = data->cumulativeIntegral(m_useTimeAxis);
+
+        // 与 getBaselineValue() 一致：每个 X 取第一个覆盖它的单调段上的值，各段按 X 升序积分。
+        // 相邻段共享折返点，之前各段覆盖的范围总是一个区间 [coveredLo, coveredHi]，每段只积分伸出该区间的部分
+        double area = 0.0;
+        double coveredLo = 0.0;
+        double coveredHi = 0.0;
+        bool first = true;
+        for (const MonotonicSegmentIndex::Segment& segment : segments->segments()) {
+            double segMin = 0.0;
+            double segMax = 0.0;
+            segmentRange(xs, segment, segMin, segMax);
+            const auto addPart = [&](double partLo, double partHi) {
+                partLo = qMax(partLo, lo);
+                partHi = qMin(partHi, hi);
+                if (partHi > partLo) {
+                    area += integral->integrateSegment(xs, ys, segment, partLo, partHi);
+                }
+            };
+            if (first) {
+                addPart(segMin, segMax);
+                coveredLo = segMin;
+                coveredHi = segMax;
+                first = false;
+                continue;
+            }
+            if (segMin < coveredLo) {
+                addPart(segMin, coveredLo);
+                coveredLo = segMin;
+            }
+            if (segMax > coveredHi) {
+                addPart(coveredHi, segMax);
+                coveredHi = segMax;
+            }
         }
-#endif
 
-        // 梯形面积（使用绝对值，不关心曲线在基线上方还是下方）
-        double dx = effectiveX2 - effectiveX1;
-        double trapezoidArea = (yi + yi1) / 2.0 * dx;
-        area += qAbs(trapezoidArea);
+        // 参考曲线范围外取 X 最小、最大端点的值
+        int minIndex = 0;
+        int maxIndex = 0;
+        extremeSamples(xs, *segments, minIndex, maxIndex);
+        if (lo < coveredLo) {
+            area += ys[minIndex] * (qMin(hi, coveredLo) - lo);
+        }
+        if (hi > coveredHi) {
+            area += ys[maxIndex] * (hi - qMax(lo, coveredHi));
+        }
+        return area;
+    }
     }
 
-#if DEBUG_PEAK_AREA_TOOL
-    qDebug() << "  有效数据段数量:" << inRangeCount;
-    qDebug() << "  计算得到的面积:" << area;
-#endif
+    return 0.0;
+}
 
-    return area;
+const ThermalDataSeries* PeakAreaTool::referenceBaselineData()
+{
+    // 检查缓存是否有效
+    if (m_cachedBaselineCurveId != m_baselineCurveId || m_cachedBaselineData.isEmpty()) {
+        // 缓存失效，重新加载基线数据
+        if (!m_curveManager || m_baselineCurveId.isEmpty()) {
+            m_cachedBaselineData.clear();
+            m_cachedBaselineCurveId.clear();
+            return nullptr;
+        }
+
+        ThermalCurve* baseline = m_curveManager->getCurve(m_baselineCurveId);
+        if (!baseline) {
+            m_cachedBaselineData.clear();
+            m_cachedBaselineCurveId.clear();
+            return nullptr;
+        }
+
+        // 缓存基线数据（共享句柄，前缀积分等派生缓存随之复用）
+        m_cachedBaselineData = baseline->getProcessedData();
+        m_cachedBaselineCurveId = m_baselineCurveId;
+    }
+
+    return m_cachedBaselineData.isEmpty() ? nullptr : &m_cachedBaselineData;
 }
 
 QPolygonF PeakAreaTool::buildAreaPolygon()
@@ -439,20 +542,32 @@ QPolygonF PeakAreaTool::buildAreaPolygon()
     QVector<QPointF> upperBoundary;  // 曲线上边界
     QVector<QPointF> lowerBoundary;  // 基线下边界
 
-    for (const auto& pt : data) {
-        double x = m_useTimeAxis ? pt.time : pt.temperature;
-        if (x >= x1 && x <= x2) {
-            // 上边界：曲线点
-            QPointF scenePos = dataToScene(pt);
-            upperBoundary.append(scenePos);
-
-            // 下边界：基线点（逆序添加）
-            ThermalDataPoint baselinePt = pt;
-            baselinePt.value = getBaselineValue(x);
-            QPointF baselineScenePos = dataToScene(baselinePt);
-            lowerBoundary.prepend(baselineScenePos);  // 逆序插入
+    // 只遍历各单调段中二分定位到的区间，不扫描整条曲线
+    const ColumnView<double> xs = data.xColumn(m_useTimeAxis);
+    const QSharedPointer<const MonotonicSegmentIndex> segments = data.xSegments(m_useTimeAxis);
+    for (const MonotonicSegmentIndex::Segment& segment : segments->segments()) {
+        int first = 0;
+        int last = 0;
+        if (!MonotonicSegmentIndex::bracket(xs, segment, x1, x2, first, last)) {
+            continue;
+        }
+        for (int i = first; i <= last; ++i) {
+            double x = xs[i];
+            if (x >= x1 && x <= x2) {
+                const ThermalDataPoint pt = data.at(i);
+
+                // 上边界：曲线点
+                QPointF scenePos = dataToScene(pt);
+                upperBoundary.append(scenePos);
+
+                // 下边界：基线点（先顺序添加，最后整体反转）
+                ThermalDataPoint baselinePt = pt;
+                baselinePt.value = getBaselineValue(x);
+                lowerBoundary.append(dataToScene(baselinePt));
+            }
         }
     }
+    std::reverse(lowerBoundary.begin(), lowerBoundary.end());
 
     // 合并上下边界形成闭合多边形
     polygon << upperBoundary << lowerBoundary;
@@ -485,68 +600,44 @@ qreal PeakAreaTool::getBaselineValue(qreal xValue)
     case BaselineMode::ReferenceCurve: {
         // ==================== 性能优化v2：缓存 + 二分查找 + 插值 ====================
 
-        // 1. 检查缓存是否有效
-        if (m_cachedBaselineCurveId != m_baselineCurveId || m_cachedBaselineData.isEmpty()) {
-            // 缓存失效，重新加载基线数据
-            if (!m_curveManager || m_baselineCurveId.isEmpty()) {
-                m_cachedBaselineData.clear();
-                m_cachedBaselineCurveId.clear();
-                return 0.0;
-            }
-
-            ThermalCurve* baseline = m_curveManager->getCurve(m_baselineCurveId);
-            if (!baseline) {
-                m_cachedBaselineData.clear();
-                m_cachedBaselineCurveId.clear();
-                return 0.0;
-            }
-
-            // 缓存基线数据
-            m_cachedBaselineData = baseline->getProcessedData();
-            m_cachedBaselineCurveId = m_baselineCurveId;
-
-            if (m_cachedBaselineData.isEmpty()) {
-                return 0.0;
-            }
-        }
-
-        const auto& data = m_cachedBaselineData;
-        if (data.isEmpty()) {
+        // 1. 获取（缓存的）参考曲线数据
+        const ThermalDataSeries* cached = referenceBaselineData();
+        if (!cached) {
             return 0.0;
         }
-
-        // 2. 二分查找最接近的索引（O(log n)）
-        int left = 0;
-        int right = data.size() - 1;
-
-        // 边界检查
-        double firstX = m_useTimeAxis ? data[left].time : data[left].temperature;
-        double lastX = m_useTimeAxis ? data[right].time : data[right].temperature;
-
-        if (xValue <= firstX) {
-            return data[left].value;
-        }
-        if (xValue >= lastX) {
-            return data[right].value;
+        const auto& data = *cached;
+
+        // 2. 在第一个覆盖 xValue 的单调段内二分查找所在区间 [i, i+1]（O(log n)，升温、降温参考曲线都适用）
+        const ColumnView<double> xs = data.xColumn(m_useTimeAxis);
+        const ColumnView<double> ys = data.values();
+        const QSharedPointer<const MonotonicSegmentIndex> segments = data.xSegments(m_useTimeAxis);
+        if (segments->segments().isEmpty()) {
+            return ys[0];
         }
 
-        // 二分查找找到 xValue 所在的区间 [i, i+1]
-        while (right - left > 1) {
-            int mid = left + (right - left) / 2;
-            double midX = m_useTimeAxis ? data[mid].time : data[mid].temperature;
-
-            if (xValue < midX) {
-                right = mid;
-            } else {
-                left = mid;
+        int left = -1;
+        for (const MonotonicSegmentIndex::Segment& segment : segments->segments()) {
+            int unused = 0;
+            if (MonotonicSegmentIndex::bracket(xs, segment, xValue, xValue, left, unused)) {
+                break;
             }
+            left = -1;
+        }
+
+        // 边界检查：参考曲线范围外取 X 最小、最大端点的值
+        if (left < 0) {
+            int minIndex = 0;
+            int maxIndex = 0;
+            extremeSamples(xs, *segments, minIndex, maxIndex);
+            return xValue < xs[minIndex] ? ys[minIndex] : ys[maxIndex];
         }
+        const int right = left + 1;
 
         // 3. 线性插值（left 和 right 是相邻的两个点）
-        double x0 = m_useTimeAxis ? data[left].time : data[left].temperature;
-        double x1 = m_useTimeAxis ? data[right].time : data[right].temperature;
-        double y0 = data[left].value;
-        double y1 = data[right].value;
+        double x0 = xs[left];
+        double x1 = xs[right];
+        double y0 = ys[left];
+        double y1 = ys[right];
 
         if (qAbs(x1 - x0) < 1e-9) {
             return y0;  // 避免除零
@@ -777,20 +868,8 @@ ThermalDataPoint PeakAreaTool::findNearestPointOnCurve(qreal xValue)
         return result;
     }
 
-    // 查找最接近xValue的点
-    int closestIndex = 0;
-    double minDist = qAbs((m_useTimeAxis ? data[0].time : data[0].temperature) - xValue);
-
-    for (int i = 1; i < data.size(); ++i) {
-        double x = m_useTimeAxis ? data[i].time : data[i].temperature;
-        double dist = qAbs(x - xValue);
-        if (dist < minDist) {
-            minDist = dist;
-            closestIndex = i;
-        }
-    }
-
-    return data[closestIndex];
+    // 查找最接近xValue的点（单调段内二分查找，拖动时每次鼠标事件 O(log N)）
+    return data.at(data.nearestIndex(xValue, m_useTimeAxis));
 }
 
 bool PeakAreaTool::isPointInCloseButton(const QPointF& pos) const
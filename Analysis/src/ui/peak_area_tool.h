@@ -10,7 +10,7 @@
 #include <QtCharts/QAbstractSeries>
 #include <QtCharts/QChart>
 #include <QtCharts/QValueAxis>
-#include "domain/model/thermal_data_point.h"
+#include "domain/model/thermal_data_series.h"
 
 QT_CHARTS_USE_NAMESPACE
 
@@ -190,10 +190,23 @@ private:
     // ==================== 计算函数 ====================
     /**
      * @brief 计算峰面积（梯形积分法）
-     * @return 峰面积值
+     *
+     * 曲线和参考曲线的面积均由其前缀积分缓存求得，每个单调段 O(log N)，
+     * 拖动手柄时无需重新积分整条曲线。各单调段按 X 升序积分，与采样方向（升温/降温）无关。
+     * @return 峰面积值（各单调段上曲线与基线之间净面积的绝对值之和）
      */
     qreal calculateArea();
 
+    /**
+     * @brief 计算基线在 [lo, hi] 上的面积（按 X 升序积分，lo <= hi）
+     */
+    qreal baselineArea(qreal lo, qreal hi);
+
+    /**
+     * @brief 获取参考基线曲线数据（带缓存，不可用时返回 nullptr）
+     */
+    const ThermalDataSeries* referenceBaselineData();
+
     /**
      * @brief 构建阴影区域多边形
      * @return 区域多边形（场景坐标）
@@ -260,7 +273,7 @@ private:
     bool m_isDirty;                     ///< 脏标记：数据已改变，需要重新计算缓存
 
     // 性能优化：基线数据缓存
-    QVector<ThermalDataPoint> m_cachedBaselineData;  ///< 缓存的基线曲线数据（避免重复查询）
+    ThermalDataSeries m_cachedBaselineData;          ///< 缓存的基线曲线数据（避免重复查询）
     QString m_cachedBaselineCurveId;                 ///< 缓存数据对应的曲线ID
 
     // 交互状态
@@ -0,0 +1,142 @@
+#include "series_hit_grid.h"
+#include <QtMath>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+/**
+ * @brief 点到线段的距离（视口坐标）
+ */
+qreal pointToSegmentDistance(const QPointF& p, const QPointF& a, const QPointF& b)
+{
+    const qreal vx = b.x() - a.x();
+    const qreal vy = b.y() - a.y();
+    const qreal wx = p.x() - a.x();
+    const qreal wy = p.y() - a.y();
+    const qreal vv = vx * vx + vy * vy;
+    qreal t = vv > 0 ? (wx * vx + wy * vy) / vv : 0.0;
+    if (t < 0) {
+        t = 0;
+    } else if (t > 1) {
+        t = 1;
+    }
+    const qreal dx = p.x() - (a.x() + t * vx);
+    const qreal dy = p.y() - (a.y() + t * vy);
+    return qSqrt(dx * dx + dy * dy);
+}
+
+inline bool isFinitePoint(const QPointF& p)
+{
+    return qIsFinite(p.x()) && qIsFinite(p.y());
+}
+
+} // namespace
+
+bool SeriesHitGrid::isCurrent(const QVector<Source>& sources, const QRectF& plotArea, const QSize& viewportSize) const
+{
+    if (!m_built || plotArea != m_plotArea || viewportSize != m_viewportSize || sources.size() != m_sources.size()) {
+        return false;
+    }
+    for (int i = 0; i < sources.size(); ++i) {
+        const Source& current = sources.at(i);
+        const Source& cached = m_sources.at(i);
+        if (current.series != cached.series || current.points.constData() != cached.points.constData()
+            || current.points.size() != cached.points.size() || current.axisRanges != cached.axisRanges) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void SeriesHitGrid::reset(const QVector<Source>& sources, const QRectF& plotArea, const QSize& viewportSize)
+{
+    m_built = true;
+    m_sources = sources;
+    m_plotArea = plotArea;
+    m_viewportSize = viewportSize;
+
+    m_columns = qMax(1, (viewportSize.width() + CellSize - 1) / CellSize);
+    m_rows = qMax(1, (viewportSize.height() + CellSize - 1) / CellSize);
+    m_segments.clear();
+    m_cells.clear();
+    m_cells.resize(m_columns * m_rows);
+}
+
+void SeriesHitGrid::addPolyline(QLineSeries* series, const QVector<QPointF>& points)
+{
+    for (int i = 1; i < points.size(); ++i) {
+        const QPointF& a = points.at(i - 1);
+        const QPointF& b = points.at(i);
+        if (!isFinitePoint(a) || !isFinitePoint(b)) {
+            continue;
+        }
+
+        const int index = m_segments.size();
+        m_segments.append({ series, a, b });
+
+        const int firstColumn = column(qMin(a.x(), b.x()));
+        const int lastColumn = column(qMax(a.x(), b.x()));
+        const int firstRow = row(qMin(a.y(), b.y()));
+        const int lastRow = row(qMax(a.y(), b.y()));
+        for (int r = firstRow; r <= lastRow; ++r) {
+            for (int c = firstColumn; c <= lastColumn; ++c) {
+                m_cells[r * m_columns + c].append(index);
+            }
+        }
+    }
+}
+
+QLineSeries* SeriesHitGrid::nearest(const QPointF& pos, qreal& outDistance) const
+{
+    QLineSeries* closestSeries = nullptr;
+    qreal bestDist = std::numeric_limits<qreal>::max();
+
+    if (!m_segments.isEmpty() && isFinitePoint(pos)) {
+        const int c0 = column(pos.x());
+        const int r0 = row(pos.y());
+        const int maxRing = qMax(m_columns, m_rows);
+        for (int ring = 0; ring <= maxRing; ++ring) {
+            // 只遍历第 ring 圈的格子：首末两行整行，中间各行只取左右两端
+            for (int r = r0 - ring; r <= r0 + ring; ++r) {
+                if (r < 0 || r >= m_rows) {
+                    continue;
+                }
+                const bool edgeRow = r == r0 - ring || r == r0 + ring;
+                const int step = edgeRow ? 1 : 2 * ring;
+                for (int c = c0 - ring; c <= c0 + ring; c += step) {
+                    if (c < 0 || c >= m_columns) {
+                        continue;
+                    }
+                    for (int index : m_cells.at(r * m_columns + c)) {
+                        const Segment& segment = m_segments.at(index);
+                        const qreal dist = pointToSegmentDistance(pos, segment.a, segment.b);
+                        if (dist < bestDist) {
+                            bestDist = dist;
+                            closestSeries = segment.series;
+                        }
+                    }
+                }
+            }
+            // 下一圈的格子离 pos 至少 ring 个格子宽
+            if (closestSeries && bestDist <= ring * CellSize) {
+                break;
+            }
+        }
+    }
+
+    outDistance = bestDist;
+    return closestSeries;
+}
+
+int SeriesHitGrid::column(qreal x) const
+{
+    const qreal cell = std::floor(x / CellSize);
+    return int(qBound(qreal(0), cell, qreal(m_columns - 1)));
+}
+
+int SeriesHitGrid::row(qreal y) const
+{
+    const qreal cell = std::floor(y / CellSize);
+    return int(qBound(qreal(0), cell, qreal(m_rows - 1)));
+}
@@ -0,0 +1,79 @@
+#ifndef SERIES_HIT_GRID_H
+#define SERIES_HIT_GRID_H
+
+#include <QPointF>
+#include <QRectF>
+#include <QSize>
+#include <QVector>
+#include <QtCharts/QLineSeries>
+
+QT_CHARTS_USE_NAMESPACE
+
+/**
+ * @brief 曲线折线段在视口坐标下的粗粒度网格索引（多曲线命中测试用）
+ *
+ * 视口按 CellSize 像素划分为网格，每条线段登记到其包围盒覆盖的格子中（视口外的部分登记到边缘格子）。
+ * 查询时从鼠标所在格子按环向外逐圈检查，已找到的最近距离不超过下一圈的最小可能距离时停止，
+ * 通常只计算鼠标附近几个格子中的线段，而不必遍历所有系列的所有点。
+ *
+ * 网格按生成时的图表状态（各系列的点数组、坐标轴范围、绘图区与视口尺寸）缓存：
+ * 状态未变时重复点击直接复用，缩放、平移、重新抽稀之后在下一次查询时重建。
+ */
+class SeriesHitGrid {
+public:
+    static constexpr int CellSize = 32; ///< 格子边长（像素）
+
+    /**
+     * @brief 生成网格所依据的一条曲线系列的状态
+     */
+    struct Source {
+        QLineSeries* series = nullptr;
+        QVector<QPointF> points;   // 系列中的点（隐式共享的副本；持有它使按地址比较不会因内存复用而误判）
+        QVector<qreal> axisRanges; // 系列所附数值坐标轴的 min、max
+    };
+
+    /**
+     * @brief 当前网格是否由相同的状态生成
+     */
+    bool isCurrent(const QVector<Source>& sources, const QRectF& plotArea, const QSize& viewportSize) const;
+
+    /**
+     * @brief 清空网格并记录新的生成状态（随后逐条调用 addPolyline() 登记）
+     */
+    void reset(const QVector<Source>& sources, const QRectF& plotArea, const QSize& viewportSize);
+
+    /**
+     * @brief 登记一条折线（视口坐标）的各线段
+     */
+    void addPolyline(QLineSeries* series, const QVector<QPointF>& points);
+
+    /**
+     * @brief 查找离 pos 最近的线段所属的系列
+     * @param pos 视口坐标
+     * @param outDistance 输出：最近距离（没有线段时为 qreal 的最大值）
+     * @return 没有登记任何线段时返回 nullptr
+     */
+    QLineSeries* nearest(const QPointF& pos, qreal& outDistance) const;
+
+private:
+    struct Segment {
+        QLineSeries* series;
+        QPointF a;
+        QPointF b;
+    };
+
+    int column(qreal x) const;
+    int row(qreal y) const;
+
+    bool m_built = false;
+    QVector<Source> m_sources;
+    QRectF m_plotArea;
+    QSize m_viewportSize;
+
+    int m_columns = 0;
+    int m_rows = 0;
+    QVector<Segment> m_segments;
+    QVector<QVector<int>> m_cells; // 行优先，每格登记的线段下标
+};
+
+#endif // SERIES_HIT_GRID_H
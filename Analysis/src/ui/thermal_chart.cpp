@@ -1,5 +1,9 @@
 ﻿#include "thermal_chart.h"
 #include "application/curve/curve_manager.h"
+#include "domain/model/min_max_decimator.h"
+#include "domain/model/min_max_pyramid.h"
+#include "domain/model/monotonic_segment_index.h"
+#include "domain/model/project_document.h"
 #include "domain/model/thermal_curve.h"
 #include "domain/model/thermal_data_point.h"
 #include "floating_label.h"
@@ -9,7 +13,6 @@
 #include <QDebug>
 #include <QGraphicsLineItem>
 #include <QGraphicsScene>
-#include <QSignalBlocker>
 #include <QtCharts/QLegend>
 #include <QtCharts/QLegendMarker>
 #include <QtCharts/QLineSeries>
@@ -63,6 +66,10 @@ ThermalChart::ThermalChart(QGraphicsItem* parent, Qt::WindowFlags wFlags)
     m_selectedPointsSeries->setBorderColor(Qt::darkRed);
     m_selectedPointsSeries->setMarkerShape(QScatterSeries::MarkerShapeCircle);
     // 初始时不添加到 chart，在需要时添加
+
+    // 缩放、平移或绘图区大小变化后按新的可见范围重新抽稀
+    connect(m_axisX, &QValueAxis::rangeChanged, this, [this]() { refreshAllSeriesLod(); });
+    connect(this, &QChart::plotAreaChanged, this, [this]() { refreshAllSeriesLod(); });
 }
 
 ThermalChart::~ThermalChart() { qDebug() << "析构: ThermalChart"; }
@@ -200,31 +207,27 @@ void ThermalChart::addSelectedPoint(const QPointF& point) { m_selectedPointsSeri
 void ThermalChart::clearSelectedPoints() { m_selectedPointsSeries->clear(); }
 
 // ==================== 系列管理辅助函数（占位符）====================
-// 根据热分析数据创建曲线系列
+// 根据热分析数据创建曲线系列（点由 refreshSeriesLod() 按可见范围填充）
 QLineSeries* ThermalChart::createSeriesForThermalCurve(const ThermalCurve& curve) const
 {
     auto* series = new QLineSeries();
     series->setName(curve.name());
-    QSignalBlocker blocker(series);
-    series->replace(buildSeriesPoints(curve));
     return series;
 }
-// 根据显示模式实时的构建数据
-QList<QPointF> ThermalChart::buildSeriesPoints(const ThermalCurve& curve) const
+// 根据显示模式构建 [xMin, xMax] 内抽稀后的点
+QVector<QPointF> ThermalChart::buildSeriesPoints(const ThermalDataSeries& data, double xMin, double xMax, int bucketCount) const
 {
-    QList<QPointF> points;
-    const auto& data = curve.getProcessedData();
-    points.reserve(data.size());
-
-    // 根据横轴模式选择 X 轴数据
-    if (m_xAxisMode == XAxisMode::Temperature) {
-        for (const auto& point : data) {
-            points.append(QPointF(point.temperature, point.value));
-        }
-    } else {
-        for (const auto& point : data) {
-            points.append(QPointF(point.time, point.value));
-        }
+    // 根据横轴模式选择 X 列，直接遍历连续的列数据；金字塔按下标分块，两种横轴模式共用
+    const bool timeAxis = m_xAxisMode == XAxisMode::Time;
+    const ColumnView<double> xs = data.xColumn(timeAxis);
+    const ColumnView<double> ys = data.values();
+    const QSharedPointer<const MinMaxPyramid> pyramid = data.valuePyramid();
+    const QVector<int> indices =
+        MinMaxDecimator::decimate(xs, ys, *data.xSegments(timeAxis), xMin, xMax, bucketCount, pyramid.data());
+
+    QVector<QPointF> points(indices.size());
+    for (int i = 0; i < indices.size(); ++i) {
+        points[i] = QPointF(xs[indices[i]], ys[indices[i]]);
     }
     return points;
 }
@@ -285,19 +288,37 @@ void ThermalChart::updateAxisRangeForAttachedSeries(QValueAxis* axis) const
         return;
     }
 
+    // 系列中只有抽稀后的可见部分，范围由曲线数据求得
+    const bool timeAxis = m_xAxisMode == XAxisMode::Time;
     for (auto lineSeries : attachedSeries) {
-        const auto points = lineSeries->pointsVector();
-        for (const QPointF& point : points) {
-            if (axis->orientation() == Qt::Horizontal) {
-                minVal = qMin(minVal, point.x());
-                maxVal = qMax(maxVal, point.x());
-            } else {
-                minVal = qMin(minVal, point.y());
-                maxVal = qMax(maxVal, point.y());
+        const ThermalDataSeries* curveData = curveDataForSeries(lineSeries);
+        if (!curveData || curveData->isEmpty()) {
+            continue;
+        }
+        const ThermalDataSeries& data = *curveData;
+        if (axis->orientation() == Qt::Horizontal) {
+            const ColumnView<double> xs = data.xColumn(timeAxis);
+            double lo = xs[0];
+            double hi = xs[0];
+            data.xSegments(timeAxis)->range(xs, lo, hi);
+            minVal = qMin(minVal, lo);
+            maxVal = qMax(maxVal, hi);
+        } else {
+            // 全范围的极值由金字塔求得，O(log N)
+            const ColumnView<double> ys = data.values();
+            int minIndex = 0;
+            int maxIndex = 0;
+            if (data.valuePyramid()->rangeMinMax(ys, 0, ys.size() - 1, minIndex, maxIndex)) {
+                minVal = qMin(minVal, ys[minIndex]);
+                maxVal = qMax(maxVal, ys[maxIndex]);
             }
         }
     }
 
+    if (minVal > maxVal) {
+        return;
+    }
+
     qreal range = maxVal - minVal;
     if (qFuzzyIsNull(range)) {
         range = qAbs(minVal) * 0.1;
@@ -310,6 +331,15 @@ void ThermalChart::updateAxisRangeForAttachedSeries(QValueAxis* axis) const
     }
     axis->applyNiceNumbers();
 }
+// 扩展坐标轴以包含 [minVal, maxVal]，已包含时不改变范围
+void ThermalChart::expandAxisRange(QValueAxis* axis, qreal minVal, qreal maxVal) const
+{
+    if (!axis || (minVal >= axis->min() && maxVal <= axis->max())) {
+        return;
+    }
+    axis->setRange(qMin(axis->min(), minVal), qMax(axis->max(), maxVal));
+    axis->applyNiceNumbers();
+}
 // 获取指定轴的所有 liseseries
 QList<QLineSeries*> ThermalChart::lineSeriesAttachedToAxis(QAbstractAxis* axis) const
 {
@@ -372,36 +402,36 @@ QValueAxis* ThermalChart::ensureYAxisForCurve(const ThermalCurve& curve)
 
 // ==================== 数据查询辅助函数 ====================
 
-ThermalDataPoint ThermalChart::findNearestDataPoint(const QVector<ThermalDataPoint>& curveData, double xValue) const
+ThermalDataPoint ThermalChart::findNearestDataPoint(const ThermalDataSeries& curveData, double xValue) const
 {
     if (curveData.isEmpty()) {
         return ThermalDataPoint();
     }
 
-    // 根据当前横轴模式选择比较字段
-    bool useTimeAxis = (m_xAxisMode == XAxisMode::Time);
-
-    int nearestIdx = 0;
-    double minDist = useTimeAxis
-                     ? qAbs(curveData[0].time - xValue)
-                     : qAbs(curveData[0].temperature - xValue);
-
-    for (int i = 1; i < curveData.size(); ++i) {
-        double dist = useTimeAxis
-                      ? qAbs(curveData[i].time - xValue)
-                      : qAbs(curveData[i].temperature - xValue);
-        if (dist < minDist) {
-            minDist = dist;
-            nearestIdx = i;
-        }
-    }
-
-    return curveData[nearestIdx];
+    // 根据当前横轴模式选择比较的列，在单调段内二分查找
+    return curveData.at(curveData.nearestIndex(xValue, m_xAxisMode == XAxisMode::Time));
 }
 
 // ==================== Phase 2: 曲线管理实现 ====================
 
 void ThermalChart::addCurve(const ThermalCurve& curve)
+{
+    addCurveSeries(curve);
+    rescaleAxes();
+}
+
+void ThermalChart::addCurves(const QVector<const ThermalCurve*>& curves)
+{
+    if (curves.isEmpty()) {
+        return;
+    }
+    for (const ThermalCurve* curve : curves) {
+        addCurveSeries(*curve);
+    }
+    rescaleAxes();
+}
+
+void ThermalChart::addCurveSeries(const ThermalCurve& curve)
 {
     QLineSeries* series = createSeriesForThermalCurve(curve);
     if (!series) {
@@ -410,11 +440,13 @@ void ThermalChart::addCurve(const ThermalCurve& curve)
 
     addSeries(series);
     registerSeriesMapping(series, curve.id());
+    m_seriesLod.insert(series, SeriesLodCache());
+
+    // 加入图表时预先构建最小/最大值金字塔，之后的缩放、平移只按像素数取对应层
+    curve.getProcessedData().valuePyramid();
 
     QValueAxis* axisY_target = ensureYAxisForCurve(curve);
     attachSeriesToAxes(series, axisY_target);
-
-    rescaleAxes();
 }
 
 void ThermalChart::updateCurve(const ThermalCurve& curve)
@@ -424,8 +456,7 @@ void ThermalChart::updateCurve(const ThermalCurve& curve)
         return;
     }
 
-    QSignalBlocker blocker(series);
-    series->replace(buildSeriesPoints(curve));
+    // 系列中的点在 rescaleAxes() 结束时按新数据重新生成
     detachSeriesFromAxes(series);
     QValueAxis* axisY_target = ensureYAxisForCurve(curve);
     attachSeriesToAxes(series, axisY_target);
@@ -433,6 +464,73 @@ void ThermalChart::updateCurve(const ThermalCurve& curve)
     rescaleAxes();
 }
 
+void ThermalChart::appendCurveData(const ThermalCurve& curve, int firstNewIndex)
+{
+    QLineSeries* series = seriesForCurveId(curve.id());
+    if (!series) {
+        return;
+    }
+
+    const auto& data = curve.getProcessedData();
+    const int n = data.size();
+    // 处理后数据未随原始数据增长等不一致情况下整体重建
+    if (n < firstNewIndex) {
+        updateCurve(curve);
+        return;
+    }
+    if (n == firstNewIndex) {
+        return;
+    }
+
+    const bool timeAxis = m_xAxisMode == XAxisMode::Time;
+    const ColumnView<double> xs = data.xColumn(timeAxis);
+    const ColumnView<double> ys = data.values();
+    qreal xMin = std::numeric_limits<qreal>::max();
+    qreal xMax = std::numeric_limits<qreal>::lowest();
+    qreal yMin = std::numeric_limits<qreal>::max();
+    qreal yMax = std::numeric_limits<qreal>::lowest();
+    for (int i = firstNewIndex; i < n; ++i) {
+        xMin = qMin(xMin, xs[i]);
+        xMax = qMax(xMax, xs[i]);
+        yMin = qMin(yMin, ys[i]);
+        yMax = qMax(yMax, ys[i]);
+    }
+
+    // 系列已包含之前的全部点且追加后仍不需要抽稀时，只把新点追加到系列末尾；否则重新抽稀
+    SeriesLodCache& cache = m_seriesLod[series];
+    SeriesLodState& state = cache.projection(timeAxis);
+    const bool appendDirectly = cache.shownAxis == int(timeAxis) && state.complete && series->count() == firstNewIndex
+        && n <= 2 * lodBucketCount();
+    if (appendDirectly) {
+        // 单点用 append。多点时不用 append(QList)：Qt 5 中它逐点调用 append()，每点发出一次 pointAdded
+        // 并重算一次整条折线的几何；一次 replace 只重算一次。此分支要求 n <= 2 * lodBucketCount()，
+        // 复制系列中已有点的开销受抽稀点数限制，与曲线总点数无关
+        if (n - firstNewIndex == 1) {
+            series->append(xs[firstNewIndex], ys[firstNewIndex]);
+        } else {
+            QVector<QPointF> points = series->pointsVector();
+            points.reserve(n);
+            for (int i = firstNewIndex; i < n; ++i) {
+                points.append(QPointF(xs[i], ys[i]));
+            }
+            series->replace(points);
+        }
+        state.revision = data.revision();
+        state.points = series->pointsVector();
+    }
+
+    ++m_lodRefreshBlocked;
+    expandAxisRange(m_axisX, xMin, xMax);
+    const auto axes = series->attachedAxes();
+    for (QAbstractAxis* axis : axes) {
+        if (axis->orientation() == Qt::Vertical) {
+            expandAxisRange(qobject_cast<QValueAxis*>(axis), yMin, yMax);
+        }
+    }
+    --m_lodRefreshBlocked;
+    refreshAllSeriesLod();
+}
+
 void ThermalChart::removeCurve(const QString& curveId)
 {
     QLineSeries* series = seriesForCurveId(curveId);
@@ -440,6 +538,7 @@ void ThermalChart::removeCurve(const QString& curveId)
         return;
     }
 
+    m_seriesLod.remove(series);
     removeSeries(series);
     if (m_selectedSeries == series) {
         m_selectedSeries = nullptr;
@@ -456,6 +555,7 @@ void ThermalChart::removeCurve(const QString& curveId)
 
 void ThermalChart::clearCurves()
 {
+    m_seriesLod.clear();
     const auto currentSeries = series();
     for (QAbstractSeries* series : currentSeries) {
         removeSeries(series);
@@ -561,9 +661,78 @@ void ThermalChart::highlightCurve(const QString& curveId)
 
 void ThermalChart::rescaleAxes()
 {
+    // 三个轴都调整完后只抽稀一次
+    ++m_lodRefreshBlocked;
     updateAxisRangeForAttachedSeries(m_axisX);
     updateAxisRangeForAttachedSeries(m_axisY_mass);
     updateAxisRangeForAttachedSeries(m_axisY_diff);
+    --m_lodRefreshBlocked;
+    refreshAllSeriesLod();
+}
+
+int ThermalChart::lodBucketCount() const
+{
+    // 尚未布局时按常见的绘图区宽度估计，布局完成后 plotAreaChanged 会触发重新抽稀
+    const int width = qRound(plotArea().width());
+    return width > 0 ? width : 1000;
+}
+
+void ThermalChart::refreshSeriesLod(QLineSeries* series)
+{
+    const auto it = m_seriesLod.find(series);
+    if (it == m_seriesLod.end()) {
+        return;
+    }
+    SeriesLodCache& cache = it.value();
+    const ThermalDataSeries* data = curveDataForSeries(series);
+    if (!data) {
+        return;
+    }
+
+    const bool timeAxis = m_xAxisMode == XAxisMode::Time;
+    SeriesLodState& state = cache.projection(timeAxis);
+    const double xMin = m_axisX->min();
+    const double xMax = m_axisX->max();
+    const int bucketCount = lodBucketCount();
+
+    // 全部点已生成时缩放平移无需重建；否则视图（范围、桶数）也要相同
+    const bool sameData = state.revision == data->revision();
+    const bool upToDate = sameData
+        && ((state.complete && data->size() <= 2 * bucketCount)
+            || (state.xMin == xMin && state.xMax == xMax && state.bucketCount == bucketCount));
+    if (!upToDate) {
+        state.points = buildSeriesPoints(*data, xMin, xMax, bucketCount);
+        state.revision = data->revision();
+        state.xMin = xMin;
+        state.xMax = xMax;
+        state.bucketCount = bucketCount;
+        state.complete = state.points.size() == data->size();
+    } else if (cache.shownAxis == int(timeAxis)) {
+        return;
+    }
+
+    // 切换横轴时缓存的另一份投影仍有效则直接换入
+    series->replace(state.points);
+    cache.shownAxis = int(timeAxis);
+}
+
+const ThermalDataSeries* ThermalChart::curveDataForSeries(QLineSeries* series) const
+{
+    ThermalCurve* curve = m_curveManager ? m_curveManager->getCurve(curveIdForSeries(series)) : nullptr;
+    return curve ? &curve->getProcessedData() : nullptr;
+}
+
+void ThermalChart::refreshAllSeriesLod()
+{
+    if (m_lodRefreshBlocked > 0) {
+        return;
+    }
+    // 隐藏的系列在重新显示时（setCurveVisible → rescaleAxes）再生成
+    for (auto it = m_seriesLod.begin(); it != m_seriesLod.end(); ++it) {
+        if (it.key()->isVisible()) {
+            refreshSeriesLod(it.key());
+        }
+    }
 }
 
 void ThermalChart::setXAxisMode(XAxisMode mode)
@@ -612,34 +781,14 @@ void ThermalChart::setXAxisMode(XAxisMode mode)
     }
     qDebug() << "ThermalChart::setXAxisMode - 已通知" << m_peakAreaTools.size() << "个峰面积工具更新横轴模式";
 
-    // 重新加载所有曲线数据
-    const auto& allCurves = m_curveManager->getAllCurves();
-    for (const ThermalCurve& curve : allCurves) {
-        QLineSeries* series = seriesForCurveId(curve.id());
-        if (series) {
-            QSignalBlocker blocker(series);
-            series->replace(buildSeriesPoints(curve));
-        }
-    }
-
-    // 重新缩放坐标轴以适应新数据范围
+    // 重新缩放坐标轴以适应新数据范围，系列中的点随后按新横轴重新生成
     rescaleAxes();
 
-    // 更新所有标注点（Markers）的显示位置
+    // 标注点（Markers）换入按新横轴投影好的显示点
     for (auto it = m_curveMarkers.begin(); it != m_curveMarkers.end(); ++it) {
         CurveMarkerData& markerData = it.value();
         if (markerData.series) {
-            markerData.series->clear();
-            for (const ThermalDataPoint& dataPoint : markerData.dataPoints) {
-                QPointF displayPoint;
-                if (m_xAxisMode == XAxisMode::Temperature) {
-                    displayPoint.setX(dataPoint.temperature);
-                } else {
-                    displayPoint.setX(dataPoint.time);
-                }
-                displayPoint.setY(dataPoint.value);
-                markerData.series->append(displayPoint);
-            }
+            markerData.series->replace(useTimeAxis ? markerData.timePoints : markerData.temperaturePoints);
         }
     }
 
@@ -758,6 +907,27 @@ void ThermalChart::clearFloatingLabels()
     qDebug() << "ThermalChart::clearFloatingLabels - 清空所有浮动标签";
 }
 
+QVector<CurveLabelAnnotation> ThermalChart::curveLabelAnnotations() const
+{
+    QVector<CurveLabelAnnotation> annotations;
+    for (FloatingLabel* label : m_floatingLabels) {
+        if (!label || label->mode() != FloatingLabel::Mode::DataAnchored) {
+            continue;
+        }
+        const QString curveId = curveIdForSeries(qobject_cast<QLineSeries*>(label->anchorSeries()));
+        if (curveId.isEmpty()) {
+            continue;
+        }
+
+        CurveLabelAnnotation annotation;
+        annotation.curveId = curveId;
+        annotation.text = label->text();
+        annotation.anchor = label->anchorValue();
+        annotations.append(annotation);
+    }
+    return annotations;
+}
+
 // ==================== Phase 3: 标注点（Markers）管理实现 ====================
 
 void ThermalChart::addCurveMarkers(const QString& curveId, const QList<QPointF>& markers, const QColor& color, qreal size)
@@ -810,17 +980,17 @@ void ThermalChart::addCurveMarkers(const QString& curveId, const QList<QPointF>&
     markerSeries->setBorderColor(color.darker(120));
     markerSeries->setMarkerShape(QScatterSeries::MarkerShapeCircle);
 
-    // 添加点（根据当前横轴模式选择X坐标）
+    // 两种横轴的显示点各投影一次，按当前横轴模式放入系列
+    CurveMarkerData markerData;
+    markerData.series = markerSeries;
+    markerData.dataPoints = dataPoints;
+    markerData.temperaturePoints.reserve(dataPoints.size());
+    markerData.timePoints.reserve(dataPoints.size());
     for (const ThermalDataPoint& dataPoint : dataPoints) {
-        QPointF displayPoint;
-        if (m_xAxisMode == XAxisMode::Temperature) {
-            displayPoint.setX(dataPoint.temperature);
-        } else {
-            displayPoint.setX(dataPoint.time);
-        }
-        displayPoint.setY(dataPoint.value);
-        markerSeries->append(displayPoint);
+        markerData.temperaturePoints.append(QPointF(dataPoint.temperature, dataPoint.value));
+        markerData.timePoints.append(QPointF(dataPoint.time, dataPoint.value));
     }
+    markerSeries->replace(m_xAxisMode == XAxisMode::Time ? markerData.timePoints : markerData.temperaturePoints);
 
     // 添加到图表
     addSeries(markerSeries);
@@ -832,9 +1002,6 @@ void ThermalChart::addCurveMarkers(const QString& curveId, const QList<QPointF>&
     }
 
     // 保存映射关系和原始数据
-    CurveMarkerData markerData;
-    markerData.series = markerSeries;
-    markerData.dataPoints = dataPoints;
     m_curveMarkers[curveId] = markerData;
 
     qDebug() << "ThermalChart::addCurveMarkers - 为曲线" << curveId << "添加了" << markers.size() << "个标注点";
@@ -875,6 +1042,28 @@ void ThermalChart::clearAllMarkers()
     qDebug() << "ThermalChart::clearAllMarkers - 清空所有标注点";
 }
 
+QVector<CurveMarkerSet> ThermalChart::curveMarkerSets() const
+{
+    QVector<CurveMarkerSet> markerSets;
+    for (auto it = m_curveMarkers.constBegin(); it != m_curveMarkers.constEnd(); ++it) {
+        const CurveMarkerData& markerData = it.value();
+        if (!markerData.series) {
+            continue;
+        }
+
+        // 保存数据坐标（温度, 值），与横轴模式无关；重新添加时按温度找回最近的数据点
+        CurveMarkerSet markerSet;
+        markerSet.curveId = it.key();
+        markerSet.color = markerData.series->color();
+        markerSet.size = markerData.series->markerSize();
+        for (const ThermalDataPoint& point : markerData.dataPoints) {
+            markerSet.points.append(QPointF(point.temperature, point.value));
+        }
+        markerSets.append(markerSet);
+    }
+    return markerSets;
+}
+
 // ==================== Phase 3: 测量工具管理实现 ====================
 
 void ThermalChart::addMassLossTool(const ThermalDataPoint& point1, const ThermalDataPoint& point2, const QString& curveId)
@@ -1205,34 +1394,21 @@ bool ThermalChart::isSeriesAttachedToYAxis(QLineSeries* series, QValueAxis* yAxi
 
 bool ThermalChart::calculateYRangeInXRange(QLineSeries* series, qreal xMin, qreal xMax, qreal& outYMin, qreal& outYMax) const
 {
-    if (!series) {
+    const ThermalDataSeries* curveData = series ? curveDataForSeries(series) : nullptr;
+    if (!curveData) {
         return false;
     }
 
-    bool hasData = false;
-    qreal yMin = std::numeric_limits<qreal>::max();
-    qreal yMax = std::numeric_limits<qreal>::lowest();
-
-    // 遍历系列的数据点，找出在 [xMin, xMax] 范围内的 Y 值范围
-    const QVector<QPointF>& points = series->pointsVector();
-    for (const QPointF& point : points) {
-        qreal x = point.x();
-        qreal y = point.y();
-
-        // 只考虑在 X 范围内的点
-        if (x >= xMin && x <= xMax) {
-            yMin = qMin(yMin, y);
-            yMax = qMax(yMax, y);
-            hasData = true;
-        }
-    }
-
-    if (hasData) {
-        outYMin = yMin;
-        outYMax = yMax;
+    // 系列中只有抽稀后的点，基于曲线数据查找：单调段内二分定位 [xMin, xMax]，再由最小/最大值金字塔求极值
+    const bool timeAxis = m_xAxisMode == XAxisMode::Time;
+    double yMin = 0.0;
+    double yMax = 0.0;
+    if (!curveData->valueRange(xMin, xMax, timeAxis, yMin, yMax)) {
+        return false;
     }
-
-    return hasData;
+    outYMin = yMin;
+    outYMax = yMax;
+    return true;
 }
 
 void ThermalChart::rescaleYAxisForXRange(QValueAxis* yAxis, qreal xMin, qreal xMax)
@@ -18,8 +18,11 @@ QT_CHARTS_USE_NAMESPACE
 class QGraphicsLineItem;
 class QGraphicsObject;
 class ThermalCurve;
+class ThermalDataSeries;
 class CurveManager;
 class FloatingLabel;
+struct CurveMarkerSet;
+struct CurveLabelAnnotation;
 
 /**
  * @brief 定义横轴显示模式
@@ -38,6 +41,10 @@ enum class XAxisMode {
  * 3. 管理叠加物（浮动标签、标注点、测量工具、注释线）
  * 4. 提供数据查询接口
  *
+ * 细节层次：曲线系列只保存当前可见 X 范围内按绘图区像素宽度抽稀后的点（见 MinMaxDecimator），
+ * X 轴范围或绘图区大小变化时重新抽稀；坐标轴范围、Y 自适应等数据查询直接基于 CurveManager 中的曲线数据，
+ * 不依赖系列中的点。
+ *
  * 设计原则：
  * - 只管理数据和图元，不处理用户交互
  * - 不依赖 QChartView，所有操作基于 QChart API
@@ -65,7 +72,19 @@ public:
 
     // ==================== 曲线管理 ====================
     void addCurve(const ThermalCurve& curve);
+    /**
+     * @brief 一次添加多条曲线，所有系列加入后只重算一次坐标轴范围
+     */
+    void addCurves(const QVector<const ThermalCurve*>& curves);
     void updateCurve(const ThermalCurve& curve);
+    /**
+     * @brief 把曲线末尾新追加的点追加到对应系列（跟随文件/实时数据）
+     * @param curve 已追加数据的曲线
+     * @param firstNewIndex 第一个新点的索引
+     *
+     * 只转换新点，坐标轴仅在新点超出当前范围时扩展；系列与曲线不一致时退回 updateCurve()。
+     */
+    void appendCurveData(const ThermalCurve& curve, int firstNewIndex);
     void removeCurve(const QString& curveId);
     void clearCurves();
     void setCurveVisible(const QString& curveId, bool visible);
@@ -132,7 +151,7 @@ public:
      * @param xValue X 轴值（根据当前横轴模式自动选择温度或时间）
      * @return 最接近的数据点
      */
-    struct ThermalDataPoint findNearestDataPoint(const QVector<struct ThermalDataPoint>& curveData, double xValue) const;
+    struct ThermalDataPoint findNearestDataPoint(const ThermalDataSeries& curveData, double xValue) const;
 
     // ==================== 十字线管理（仅图元接口）====================
     void setCrosshairEnabled(bool vertical, bool horizontal);
@@ -149,11 +168,13 @@ public:
     void removeFloatingLabel(FloatingLabel* label);
     void clearFloatingLabels();
     const QVector<FloatingLabel*>& floatingLabels() const { return m_floatingLabels; }
+    QVector<CurveLabelAnnotation> curveLabelAnnotations() const; // 数据锚定在曲线上的标签（视图锚定标签不收集）
 
     // ==================== 标注点（Markers）管理 ====================
     void addCurveMarkers(const QString& curveId, const QList<QPointF>& markers, const QColor& color = Qt::red, qreal size = 12.0);
     void removeCurveMarkers(const QString& curveId);
     void clearAllMarkers();
+    QVector<CurveMarkerSet> curveMarkerSets() const;
 
     // ==================== 测量工具管理 ====================
     void addMassLossTool(const struct ThermalDataPoint& point1, const struct ThermalDataPoint& point2, const QString& curveId);
@@ -209,7 +230,8 @@ signals:
 private:
     // ==================== 系列管理辅助函数 ====================
     QLineSeries* createSeriesForThermalCurve(const ThermalCurve& curve) const;
-    QList<QPointF> buildSeriesPoints(const ThermalCurve& curve) const;
+    QVector<QPointF> buildSeriesPoints(const ThermalDataSeries& data, double xMin, double xMax, int bucketCount) const;
+    void addCurveSeries(const ThermalCurve& curve);
     void attachSeriesToAxes(QXYSeries* series, QValueAxis* axisY);
     void detachSeriesFromAxes(QXYSeries* series);
     void registerSeriesMapping(QLineSeries* series, const QString& curveId);
@@ -219,6 +241,7 @@ private:
     // ==================== 坐标轴管理辅助函数 ====================
     QValueAxis* ensureYAxisForCurve(const ThermalCurve& curve);
     void updateAxisRangeForAttachedSeries(QValueAxis* axis) const;
+    void expandAxisRange(QValueAxis* axis, qreal minVal, qreal maxVal) const;
     QList<QLineSeries*> lineSeriesAttachedToAxis(QAbstractAxis* axis) const;
 
     void resetAxesToDefault();
@@ -251,6 +274,27 @@ private:
      */
     bool calculateYRangeInXRange(QLineSeries* series, qreal xMin, qreal xMax, qreal& outYMin, qreal& outYMax) const;
 
+    // ==================== 细节层次（LOD）辅助函数 ====================
+    /**
+     * @brief 抽稀的桶数（绘图区宽度的像素数）
+     */
+    int lodBucketCount() const;
+
+    /**
+     * @brief 系列对应曲线的当前数据（取自 CurveManager；曲线已不存在时返回 nullptr）
+     */
+    const ThermalDataSeries* curveDataForSeries(QLineSeries* series) const;
+
+    /**
+     * @brief 按当前 X 轴范围和绘图区宽度重新抽稀系列（显示内容未过期时不做任何事）
+     */
+    void refreshSeriesLod(QLineSeries* series);
+
+    /**
+     * @brief 重新抽稀所有可见的曲线系列（批量调整坐标轴期间推迟到调整结束）
+     */
+    void refreshAllSeriesLod();
+
 private:
     // ==================== 初始化状态标记 ====================
     bool m_initialized = false; // 防止"半初始化对象"的运行时错误
@@ -266,6 +310,36 @@ private:
     QHash<QString, QLineSeries*> m_idToSeries;
     QLineSeries* m_selectedSeries = nullptr;
 
+    // ==================== 细节层次（LOD）====================
+    /**
+     * @brief 曲线系列在某一横轴模式下生成的点及其生成条件
+     *
+     * 不持有曲线数据的句柄：实时追加时 CurveManager 中的缓冲区不被共享，可以原地追加而不必整份复制。
+     */
+    struct SeriesLodState {
+        quint64 revision = 0;     // points 生成自哪个版本的数据（0 表示尚未生成）
+        double xMin = 0.0;        // 生成时的 X 可见范围
+        double xMax = 0.0;
+        int bucketCount = 0;      // 生成时的桶数
+        bool complete = false;    // points 包含全部采样点（未抽稀、未裁剪）
+        QVector<QPointF> points;  // 生成的点（与系列隐式共享）
+    };
+
+    /**
+     * @brief 曲线系列的两种横轴投影
+     *
+     * 温度横轴和时间横轴各保留一份生成的点，切换横轴时数据版本和视图未变的一份直接换回系列，不重新抽稀。
+     */
+    struct SeriesLodCache {
+        SeriesLodState temperature;
+        SeriesLodState time;
+        int shownAxis = -1;       // 系列当前显示的投影（0=温度，1=时间，-1=尚未生成）
+
+        SeriesLodState& projection(bool timeAxis) { return timeAxis ? time : temperature; }
+    };
+    QHash<QLineSeries*, SeriesLodCache> m_seriesLod;
+    int m_lodRefreshBlocked = 0; // >0 时坐标轴变化不立即重新抽稀
+
     // ==================== 十字线 ====================
     QGraphicsLineItem* m_verticalCrosshairLine = nullptr;
     QGraphicsLineItem* m_horizontalCrosshairLine = nullptr;
@@ -279,6 +353,8 @@ private:
     struct CurveMarkerData {
         QScatterSeries* series;
         QVector<struct ThermalDataPoint> dataPoints;
+        QVector<QPointF> temperaturePoints; // 按温度横轴投影的显示点（切换横轴时直接换入系列）
+        QVector<QPointF> timePoints;        // 按时间横轴投影的显示点
     };
     QMap<QString, CurveMarkerData> m_curveMarkers;
 
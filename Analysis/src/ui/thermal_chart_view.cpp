@@ -789,60 +789,45 @@ QLineSeries* ThermalChartView::findSeriesNearPoint(const QPointF& viewportPos, q
     // - mapFromScene(): 场景坐标 → 视口坐标
     // 必须统一到同一坐标系（视口坐标）才能计算准确距离
 
-    // 点到线段距离计算函数（在视口坐标系下计算）
-    auto pointToSegDist = [](const QPointF& p, const QPointF& a, const QPointF& b) -> qreal {
-        const qreal vx = b.x() - a.x();
-        const qreal vy = b.y() - a.y();
-        const qreal wx = p.x() - a.x();
-        const qreal wy = p.y() - a.y();
-        const qreal vv = vx * vx + vy * vy;
-        qreal t = vv > 0 ? (wx * vx + wy * vy) / vv : 0.0;
-        if (t < 0) {
-            t = 0;
-        } else if (t > 1) {
-            t = 1;
-        }
-        const QPointF proj(a.x() + t * vx, a.y() + t * vy);
-        const qreal dx = p.x() - proj.x();
-        const qreal dy = p.y() - proj.y();
-        return qSqrt(dx * dx + dy * dy);
-    };
-
-    QLineSeries* closestSeries = nullptr;
-    qreal bestDist = std::numeric_limits<qreal>::max();
-
+    // 收集可见曲线系列的当前状态；与上次生成网格时相同（未缩放、平移或重新抽稀）则直接复用网格
+    QVector<SeriesHitGrid::Source> sources;
     for (QAbstractSeries* abstractSeries : chart()->series()) {
         QLineSeries* lineSeries = qobject_cast<QLineSeries*>(abstractSeries);
         if (!lineSeries || !lineSeries->isVisible()) {
             continue;
         }
 
-        const auto points = lineSeries->pointsVector();
-        if (points.size() < 2) {
+        SeriesHitGrid::Source source;
+        source.series = lineSeries;
+        source.points = lineSeries->pointsVector();
+        if (source.points.size() < 2) {
             continue;
         }
-
-        // 获取第一个点的场景坐标，然后转换为视口坐标
-        QPointF scenePos = chart()->mapToPosition(points[0], lineSeries);
-        QPointF previous = mapFromScene(scenePos);
-
-        for (int i = 1; i < points.size(); ++i) {
-            // 获取当前点的场景坐标，然后转换为视口坐标
-            QPointF scenePosCurrent = chart()->mapToPosition(points[i], lineSeries);
-            QPointF current = mapFromScene(scenePosCurrent);
-
-            // 在视口坐标系下计算距离
-            const qreal dist = pointToSegDist(viewportPos, previous, current);
-            if (dist < bestDist) {
-                bestDist = dist;
-                closestSeries = lineSeries;
+        const auto axes = lineSeries->attachedAxes();
+        for (QAbstractAxis* axis : axes) {
+            if (QValueAxis* valueAxis = qobject_cast<QValueAxis*>(axis)) {
+                source.axisRanges << valueAxis->min() << valueAxis->max();
+            }
+        }
+        sources.append(source);
+    }
+
+    const QRectF plotArea = chart()->plotArea();
+    const QSize viewportSize = viewport()->size();
+    if (!m_hitGrid.isCurrent(sources, plotArea, viewportSize)) {
+        m_hitGrid.reset(sources, plotArea, viewportSize);
+        for (const SeriesHitGrid::Source& source : sources) {
+            // 数据坐标 → 场景坐标 → 视口坐标
+            QVector<QPointF> viewportPoints(source.points.size());
+            for (int i = 0; i < source.points.size(); ++i) {
+                viewportPoints[i] = mapFromScene(chart()->mapToPosition(source.points[i], source.series));
             }
-            previous = current;
+            m_hitGrid.addPolyline(source.series, viewportPoints);
         }
     }
 
-    outDistance = bestDist;
-    return closestSeries;
+    // 在视口坐标系下从鼠标所在格子向外查找最近的线段
+    return m_hitGrid.nearest(viewportPos, outDistance);
 }
 
 qreal ThermalChartView::hitThreshold() const
@@ -1,6 +1,7 @@
 #ifndef THERMAL_CHART_VIEW_H
 #define THERMAL_CHART_VIEW_H
 
+#include "series_hit_grid.h"
 #include <QChartView>
 #include <QPointF>
 #include <QVector>
@@ -288,6 +289,7 @@ private:
     // ==================== 碰撞检测配置 ====================
     qreal m_hitTestBasePx = 8.0;
     bool m_hitTestIncludePen = true;
+    mutable SeriesHitGrid m_hitGrid; // 可见曲线线段的视口网格（图表状态未变时复用）
 
     // ==================== 右键拖动 ====================
     bool m_isRightDragging = false;
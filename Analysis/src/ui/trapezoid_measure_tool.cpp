@@ -296,33 +296,8 @@ ThermalDataPoint TrapezoidMeasureTool::findNearestPointOnCurve(qreal xValue)
         return defaultPoint;
     }
 
-    // 查找最接近的点（根据当前横轴模式）
-    int nearestIdx = 0;
-    qreal minDist;
-
-    if (m_useTimeAxis) {
-        // 时间轴模式：按时间查找
-        minDist = qAbs(data[0].time - xValue);
-        for (int i = 1; i < data.size(); ++i) {
-            qreal dist = qAbs(data[i].time - xValue);
-            if (dist < minDist) {
-                minDist = dist;
-                nearestIdx = i;
-            }
-        }
-    } else {
-        // 温度轴模式：按温度查找
-        minDist = qAbs(data[0].temperature - xValue);
-        for (int i = 1; i < data.size(); ++i) {
-            qreal dist = qAbs(data[i].temperature - xValue);
-            if (dist < minDist) {
-                minDist = dist;
-                nearestIdx = i;
-            }
-        }
-    }
-
-    return data[nearestIdx];
+    // 查找最接近的点（根据当前横轴模式选择时间列或温度列，单调段内二分查找）
+    return data.at(data.nearestIndex(xValue, m_useTimeAxis));
 }
 
 void TrapezoidMeasureTool::paintCloseButton(QPainter* painter)
@@ -0,0 +1,19 @@
+QT       += core testlib
+QT       -= gui
+
+CONFIG += c++17 console testcase
+CONFIG -= app_bundle
+
+TARGET = tst_algorithm_descriptor
+
+INCLUDEPATH += $$PWD/../../src
+
+win32:msvc: QMAKE_CXXFLAGS += /utf-8
+win32:g++:  QMAKE_CXXFLAGS += -finput-charset=UTF-8 -fexec-charset=UTF-8
+
+SOURCES += \
+    tst_algorithm_descriptor.cpp \
+    ../../src/domain/algorithm/algorithm_descriptor.cpp
+
+HEADERS += \
+    ../../src/domain/algorithm/algorithm_descriptor.h
@@ -0,0 +1,92 @@
+#include "domain/algorithm/algorithm_descriptor.h"
+#include <QtTest>
+
+namespace {
+
+/**
+ * @brief 与移动平均滤波相同的参数声明：整数窗口（min 1）、可选边界模式，外加一个带上下限的浮点参数
+ */
+AlgorithmDescriptor filterDescriptor()
+{
+    AlgorithmDescriptor desc;
+    desc.name = QStringLiteral("filter");
+    desc.interaction = AlgorithmInteraction::ParameterDialog;
+    desc.parameters = {
+        { QStringLiteral("window"), QStringLiteral("窗口大小"), QVariant::Int, 5, true, { { QStringLiteral("min"), 1 } } },
+        { QStringLiteral("edgeMode"), QStringLiteral("边界处理"), QVariant::String, QStringLiteral("shrink"), false,
+          { { QStringLiteral("options"), QStringList{ QStringLiteral("shrink"), QStringLiteral("reflect"), QStringLiteral("valid") } } } },
+        { QStringLiteral("ratio"), QStringLiteral("比例"), QVariant::Double, 0.5, false,
+          { { QStringLiteral("min"), 0.0 }, { QStringLiteral("max"), 1.0 } } },
+    };
+    return desc;
+}
+
+} // namespace
+
+class TestAlgorithmDescriptor : public QObject {
+    Q_OBJECT
+
+private slots:
+    void validation_data();
+    void validation();
+    void reportsReason();
+};
+
+void TestAlgorithmDescriptor::validation_data()
+{
+    QTest::addColumn<QVariantMap>("parameters");
+    QTest::addColumn<bool>("valid");
+
+    QTest::newRow("defaults") << QVariantMap{ { "window", 5 }, { "edgeMode", "shrink" }, { "ratio", 0.5 } } << true;
+    // 缺失的参数与未声明的键不检查
+    QTest::newRow("empty") << QVariantMap() << true;
+    QTest::newRow("unknown key") << QVariantMap{ { "other", "anything" } } << true;
+
+    QTest::newRow("every option") << QVariantMap{ { "edgeMode", "reflect" } } << true;
+    QTest::newRow("last option") << QVariantMap{ { "edgeMode", "valid" } } << true;
+    QTest::newRow("unknown option") << QVariantMap{ { "edgeMode", "wrap" } } << false;
+    QTest::newRow("option is case sensitive") << QVariantMap{ { "edgeMode", "Shrink" } } << false;
+
+    QTest::newRow("min is inclusive") << QVariantMap{ { "window", 1 } } << true;
+    QTest::newRow("below min") << QVariantMap{ { "window", 0 } } << false;
+    QTest::newRow("negative") << QVariantMap{ { "window", -3 } } << false;
+    QTest::newRow("max is inclusive") << QVariantMap{ { "ratio", 1.0 } } << true;
+    QTest::newRow("above max") << QVariantMap{ { "ratio", 1.5 } } << false;
+    QTest::newRow("below min double") << QVariantMap{ { "ratio", -0.01 } } << false;
+
+    // 预设参数可能以字符串形式给出：能转换为声明类型即可
+    QTest::newRow("numeric string") << QVariantMap{ { "window", "12" } } << true;
+    QTest::newRow("numeric string below min") << QVariantMap{ { "window", "0" } } << false;
+    QTest::newRow("not a number") << QVariantMap{ { "window", "abc" } } << false;
+    QTest::newRow("invalid value") << QVariantMap{ { "ratio", QVariant() } } << false;
+}
+
+void TestAlgorithmDescriptor::validation()
+{
+    QFETCH(QVariantMap, parameters);
+    QFETCH(bool, valid);
+
+    QString error;
+    QCOMPARE(validateAlgorithmParameters(filterDescriptor(), parameters, &error), valid);
+    QCOMPARE(error.isEmpty(), valid);
+}
+
+void TestAlgorithmDescriptor::reportsReason()
+{
+    QString error;
+    QVERIFY(!validateAlgorithmParameters(filterDescriptor(), { { "edgeMode", "wrap" } }, &error));
+    // 原因中带参数名称、非法取值和可选值，便于直接显示给用户
+    QVERIFY(error.contains(QStringLiteral("边界处理")));
+    QVERIFY(error.contains(QStringLiteral("wrap")));
+    QVERIFY(error.contains(QStringLiteral("reflect")));
+
+    QVERIFY(!validateAlgorithmParameters(filterDescriptor(), { { "window", 0 } }, &error));
+    QVERIFY(error.contains(QStringLiteral("窗口大小")));
+
+    // error 可为空
+    QVERIFY(!validateAlgorithmParameters(filterDescriptor(), { { "window", 0 } }));
+}
+
+QTEST_APPLESS_MAIN(TestAlgorithmDescriptor)
+
+#include "tst_algorithm_descriptor.moc"
@@ -0,0 +1,23 @@
+QT       += core testlib
+QT       -= gui
+
+CONFIG += c++17 console testcase
+CONFIG -= app_bundle
+
+TARGET = tst_min_max_decimator
+
+INCLUDEPATH += $$PWD/../../src
+
+win32:msvc: QMAKE_CXXFLAGS += /utf-8
+win32:g++:  QMAKE_CXXFLAGS += -finput-charset=UTF-8 -fexec-charset=UTF-8
+
+SOURCES += \
+    tst_min_max_decimator.cpp \
+    ../../src/domain/model/min_max_decimator.cpp \
+    ../../src/domain/model/min_max_pyramid.cpp \
+    ../../src/domain/model/monotonic_segment_index.cpp
+
+HEADERS += \
+    ../../src/domain/model/min_max_decimator.h \
+    ../../src/domain/model/min_max_pyramid.h \
+    ../../src/domain/model/monotonic_segment_index.h
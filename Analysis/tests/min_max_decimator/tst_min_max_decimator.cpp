@@ -0,0 +1,248 @@
+#include "domain/model/min_max_decimator.h"
+#include <QtTest>
+#include <cmath>
+#include <random>
+
+namespace {
+
+ColumnView<double> view(const QVector<double>& values)
+{
+    return ColumnView<double>(values.constData(), values.size());
+}
+
+QVector<double> noisySignal(int size, quint32 seed)
+{
+    std::mt19937 engine(seed);
+    std::normal_distribution<double> noise(0.0, 0.05);
+    QVector<double> y(size);
+    for (int i = 0; i < size; ++i) {
+        y[i] = std::sin(i * 1e-3) + noise(engine);
+    }
+    // 少量尖峰：抽稀后仍必须保留
+    for (int i = 997; i < size; i += 7919) {
+        y[i] += (i % 2) ? 5.0 : -5.0;
+    }
+    return y;
+}
+
+/**
+ * @brief 带传感器抖动的升温横轴：抖动幅度大于采样间距，X 列被切成大量细碎的单调段
+ */
+QVector<double> jitteryRamp(int size, quint32 seed)
+{
+    std::mt19937 engine(seed);
+    std::normal_distribution<double> noise(0.0, 0.03);
+    QVector<double> x(size);
+    for (int i = 0; i < size; ++i) {
+        x[i] = i * 0.01 + noise(engine);
+    }
+    return x;
+}
+
+/**
+ * @brief 输出下标有效且严格递增，可见范围内每个采样的 Y 都落在输出点的 Y 范围之内
+ */
+bool checkCoverage(const QVector<int>& indices, const QVector<double>& x, const QVector<double>& y,
+                   double xMin, double xMax, QString& failure)
+{
+    if (indices.isEmpty()) {
+        failure = "empty output";
+        return false;
+    }
+    double outMin = y[indices[0]];
+    double outMax = outMin;
+    for (int k = 0; k < indices.size(); ++k) {
+        const int i = indices[k];
+        if (i < 0 || i >= y.size() || (k > 0 && i <= indices[k - 1])) {
+            failure = QString("index %1 at position %2 is out of order").arg(i).arg(k);
+            return false;
+        }
+        outMin = qMin(outMin, y[i]);
+        outMax = qMax(outMax, y[i]);
+    }
+    for (int i = 0; i < x.size(); ++i) {
+        if (x[i] >= xMin && x[i] <= xMax && (y[i] < outMin || y[i] > outMax)) {
+            failure = QString("visible sample %1 (y=%2) outside output extent").arg(i).arg(y[i]);
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+class TestMinMaxDecimator : public QObject {
+    Q_OBJECT
+
+private slots:
+    void handlesTinyColumns();
+    void returnsAllVisibleWhenFew();
+    void keepsBucketExtremes();
+    void pyramidKeepsVisibleExtent();
+    void jitteryColumnStaysBounded_data();
+    void jitteryColumnStaysBounded();
+    void revisitedRangeStaysBounded();
+};
+
+void TestMinMaxDecimator::handlesTinyColumns()
+{
+    const QVector<double> empty;
+    QVERIFY(MinMaxDecimator::decimate(view(empty), view(empty), MonotonicSegmentIndex(view(empty)), 0.0, 1.0, 10).isEmpty());
+
+    const QVector<double> single({ 5.0 });
+    const QVector<int> indices =
+        MinMaxDecimator::decimate(view(single), view(single), MonotonicSegmentIndex(view(single)), 0.0, 1.0, 10);
+    QCOMPARE(indices, QVector<int>({ 0 }));
+}
+
+void TestMinMaxDecimator::returnsAllVisibleWhenFew()
+{
+    QVector<double> x(1000);
+    for (int i = 0; i < x.size(); ++i) {
+        x[i] = i;
+    }
+    const QVector<double> y = noisySignal(x.size(), 1u);
+    const MonotonicSegmentIndex segments(view(x));
+
+    // 可见 11..20，两端各保留一个紧邻的点
+    const QVector<int> indices = MinMaxDecimator::decimate(view(x), view(y), segments, 10.5, 20.5, 100);
+    QVector<int> expected;
+    for (int i = 10; i <= 21; ++i) {
+        expected.append(i);
+    }
+    QCOMPARE(indices, expected);
+
+    // 可见范围贴着列的开头：没有更前面的点可保留
+    QCOMPARE(MinMaxDecimator::decimate(view(x), view(y), segments, -5.0, 2.5, 100), QVector<int>({ 0, 1, 2, 3 }));
+}
+
+void TestMinMaxDecimator::keepsBucketExtremes()
+{
+    const int size = 100000;
+    QVector<double> x(size);
+    for (int i = 0; i < size; ++i) {
+        x[i] = i * 0.01;
+    }
+    const QVector<double> y = noisySignal(size, 2u);
+    const MonotonicSegmentIndex segments(view(x));
+
+    const int bucketCount = 300;
+    const double xMin = 123.456;
+    const double xMax = 654.321;
+    const QVector<int> indices = MinMaxDecimator::decimate(view(x), view(y), segments, xMin, xMax, bucketCount);
+
+    QString failure;
+    QVERIFY2(checkCoverage(indices, x, y, xMin, xMax, failure), qPrintable(failure));
+    QVERIFY(indices.size() <= 2 * bucketCount + 2);
+
+    // 逐点扫描时每个 X 桶内可见采样的最小、最大值都必须出现在输出中
+    const double bucketWidth = (xMax - xMin) / bucketCount;
+    QVector<double> expectedMin(bucketCount, qInf());
+    QVector<double> expectedMax(bucketCount, -qInf());
+    for (int i = 0; i < size; ++i) {
+        if (x[i] < xMin || x[i] > xMax) {
+            continue;
+        }
+        const int b = qBound(0, int((x[i] - xMin) / bucketWidth), bucketCount - 1);
+        expectedMin[b] = qMin(expectedMin[b], y[i]);
+        expectedMax[b] = qMax(expectedMax[b], y[i]);
+    }
+    QVector<double> actualMin(bucketCount, qInf());
+    QVector<double> actualMax(bucketCount, -qInf());
+    for (int i : indices) {
+        if (x[i] < xMin || x[i] > xMax) {
+            continue;
+        }
+        const int b = qBound(0, int((x[i] - xMin) / bucketWidth), bucketCount - 1);
+        actualMin[b] = qMin(actualMin[b], y[i]);
+        actualMax[b] = qMax(actualMax[b], y[i]);
+    }
+    for (int b = 0; b < bucketCount; ++b) {
+        if (actualMin[b] != expectedMin[b] || actualMax[b] != expectedMax[b]) {
+            QFAIL(qPrintable(QString("bucket %1: %2..%3, expected %4..%5")
+                                 .arg(b).arg(actualMin[b]).arg(actualMax[b]).arg(expectedMin[b]).arg(expectedMax[b])));
+        }
+    }
+}
+
+void TestMinMaxDecimator::pyramidKeepsVisibleExtent()
+{
+    const int size = 200000;
+    QVector<double> x(size);
+    for (int i = 0; i < size; ++i) {
+        x[i] = i * 0.01;
+    }
+    const QVector<double> y = noisySignal(size, 3u);
+    const MonotonicSegmentIndex segments(view(x));
+    const MinMaxPyramid pyramid(view(y));
+
+    const int bucketCount = 400;
+    const double ranges[][2] = { { -10.0, 3000.0 }, { 100.005, 1500.0 }, { 7.77, 333.33 } };
+    for (const auto& range : ranges) {
+        const QVector<int> indices =
+            MinMaxDecimator::decimate(view(x), view(y), segments, range[0], range[1], bucketCount, &pyramid);
+        QString failure;
+        QVERIFY2(checkCoverage(indices, x, y, range[0], range[1], failure), qPrintable(failure));
+        // 选中的层每块不少于每桶采样数的一半：块数不超过 2 × 桶数，另加区间两端的零头与端点
+        QVERIFY(indices.size() <= 4 * bucketCount + 8);
+    }
+}
+
+void TestMinMaxDecimator::jitteryColumnStaysBounded_data()
+{
+    QTest::addColumn<double>("xMin");
+    QTest::addColumn<double>("xMax");
+    QTest::addColumn<bool>("usePyramid");
+
+    QTest::newRow("full range, scan") << -1.0 << 2001.0 << false;
+    QTest::newRow("full range, pyramid") << -1.0 << 2001.0 << true;
+    QTest::newRow("zoomed, scan") << 500.0 << 700.0 << false;
+    QTest::newRow("zoomed, pyramid") << 500.0 << 700.0 << true;
+}
+
+void TestMinMaxDecimator::jitteryColumnStaysBounded()
+{
+    QFETCH(double, xMin);
+    QFETCH(double, xMax);
+    QFETCH(bool, usePyramid);
+
+    const int size = 200000;
+    const QVector<double> x = jitteryRamp(size, 4u);
+    const QVector<double> y = noisySignal(size, 5u);
+    const MonotonicSegmentIndex segments(view(x));
+    const MinMaxPyramid pyramid(view(y));
+    QVERIFY(segments.segments().size() > size / 10); // 确实被切成了大量单调段
+
+    const int bucketCount = 800;
+    const QVector<int> indices = MinMaxDecimator::decimate(view(x), view(y), segments, xMin, xMax, bucketCount,
+                                                           usePyramid ? &pyramid : nullptr);
+    QString failure;
+    QVERIFY2(checkCoverage(indices, x, y, xMin, xMax, failure), qPrintable(failure));
+    // 细碎单调段不能让输出随段数增长
+    QVERIFY2(indices.size() <= 8 * bucketCount, qPrintable(QString("%1 points").arg(indices.size())));
+}
+
+void TestMinMaxDecimator::revisitedRangeStaysBounded()
+{
+    // X 在可见范围两侧反复往返（恒温回摆），合并后的区间数远超桶数：退化为整段抽稀
+    const int size = 100000;
+    QVector<double> x(size);
+    for (int i = 0; i < size; ++i) {
+        x[i] = 50.0 + 40.0 * std::sin(i * 0.05);
+    }
+    const QVector<double> y = noisySignal(size, 6u);
+    const MonotonicSegmentIndex segments(view(x));
+    const MinMaxPyramid pyramid(view(y));
+
+    const int bucketCount = 200;
+    for (const MinMaxPyramid* p : { static_cast<const MinMaxPyramid*>(nullptr), &pyramid }) {
+        const QVector<int> indices = MinMaxDecimator::decimate(view(x), view(y), segments, 80.0, 85.0, bucketCount, p);
+        QString failure;
+        QVERIFY2(checkCoverage(indices, x, y, 80.0, 85.0, failure), qPrintable(failure));
+        QVERIFY2(indices.size() <= 8 * bucketCount, qPrintable(QString("%1 points").arg(indices.size())));
+    }
+}
+
+QTEST_APPLESS_MAIN(TestMinMaxDecimator)
+
+#include "tst_min_max_decimator.moc"
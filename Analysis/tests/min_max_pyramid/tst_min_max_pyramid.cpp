@@ -0,0 +1,200 @@
+#include "domain/model/min_max_pyramid.h"
+#include <QtTest>
+#include <random>
+
+namespace {
+
+/**
+ * @brief 量化到少数几个取值的随机信号：大量相等的 Y 值用来检验并列极值的处理
+ */
+QVector<double> quantizedSignal(int size, int levels, quint32 seed)
+{
+    std::mt19937 engine(seed);
+    std::uniform_int_distribution<int> level(0, levels - 1);
+    QVector<double> values(size);
+    for (int i = 0; i < size; ++i) {
+        values[i] = 0.25 * level(engine);
+    }
+    return values;
+}
+
+ColumnView<double> view(const QVector<double>& values)
+{
+    return ColumnView<double>(values.constData(), values.size());
+}
+
+/**
+ * @brief 逐点比较 rangeMinMax() 与直接扫描 [first, last] 的结果
+ *
+ * 并列极值时金字塔可能返回区间内任意一个取到极值的点，因此比较的是取值而不是下标。
+ */
+bool matchesScan(const MinMaxPyramid& pyramid, const QVector<double>& y, int first, int last, QString& failure)
+{
+    double expectedMin = y[first];
+    double expectedMax = y[first];
+    for (int i = first + 1; i <= last; ++i) {
+        expectedMin = qMin(expectedMin, y[i]);
+        expectedMax = qMax(expectedMax, y[i]);
+    }
+
+    int minIndex = -1;
+    int maxIndex = -1;
+    if (!pyramid.rangeMinMax(view(y), first, last, minIndex, maxIndex)) {
+        failure = QString("[%1, %2]: returned false").arg(first).arg(last);
+        return false;
+    }
+    if (minIndex < first || minIndex > last || maxIndex < first || maxIndex > last) {
+        failure = QString("[%1, %2]: index outside range (min %3, max %4)").arg(first).arg(last).arg(minIndex).arg(maxIndex);
+        return false;
+    }
+    if (y[minIndex] != expectedMin || y[maxIndex] != expectedMax) {
+        failure = QString("[%1, %2]: extent %3..%4, expected %5..%6")
+                      .arg(first).arg(last)
+                      .arg(y[minIndex]).arg(y[maxIndex])
+                      .arg(expectedMin).arg(expectedMax);
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+class TestMinMaxPyramid : public QObject {
+    Q_OBJECT
+
+private slots:
+    void allRangesMatchScan_data();
+    void allRangesMatchScan();
+    void randomRangesMatchScan();
+    void clampsOutOfBoundsRanges();
+    void appendMatchesRebuild();
+    void levelForBlockSize();
+};
+
+void TestMinMaxPyramid::allRangesMatchScan_data()
+{
+    QTest::addColumn<int>("size");
+    QTest::addColumn<int>("levels");
+
+    // 小于一块、恰好一块、整块加零头、跨越多层的非 2 的幂长度
+    QTest::newRow("single sample") << 1 << 3;
+    QTest::newRow("partial block") << MinMaxPyramid::BaseBlockSize - 1 << 3;
+    QTest::newRow("one block") << MinMaxPyramid::BaseBlockSize << 3;
+    QTest::newRow("block plus one") << MinMaxPyramid::BaseBlockSize + 1 << 3;
+    QTest::newRow("several levels") << 9 * MinMaxPyramid::BaseBlockSize + 5 << 4;
+    QTest::newRow("many ties") << 300 << 2;
+    QTest::newRow("constant") << 200 << 1;
+}
+
+void TestMinMaxPyramid::allRangesMatchScan()
+{
+    QFETCH(int, size);
+    QFETCH(int, levels);
+
+    const QVector<double> y = quantizedSignal(size, levels, quint32(size));
+    const MinMaxPyramid pyramid(view(y));
+    QCOMPARE(pyramid.sampleCount(), size);
+
+    QString failure;
+    for (int first = 0; first < size; ++first) {
+        for (int last = first; last < size; ++last) {
+            if (!matchesScan(pyramid, y, first, last, failure)) {
+                QFAIL(qPrintable(failure));
+            }
+        }
+    }
+}
+
+void TestMinMaxPyramid::randomRangesMatchScan()
+{
+    const int size = 100000 + 7;
+    const QVector<double> y = quantizedSignal(size, 50, 21u);
+    const MinMaxPyramid pyramid(view(y));
+
+    std::mt19937 engine(22u);
+    std::uniform_int_distribution<int> index(0, size - 1);
+    std::uniform_int_distribution<int> edge(-2, 2);
+    QString failure;
+    for (int k = 0; k < 2000; ++k) {
+        int first = index(engine);
+        int last = index(engine);
+        if (first > last) {
+            std::swap(first, last);
+        }
+        // 一半的区间端点贴近块边界（块边界前后各两个采样）
+        if (k % 2 == 0) {
+            const int block = MinMaxPyramid::blockSize(k % 6);
+            first = qBound(0, first / block * block + edge(engine), size - 1);
+            last = qBound(first, last / block * block + edge(engine), size - 1);
+        }
+        if (!matchesScan(pyramid, y, first, last, failure)) {
+            QFAIL(qPrintable(failure));
+        }
+    }
+}
+
+void TestMinMaxPyramid::clampsOutOfBoundsRanges()
+{
+    const QVector<double> y = quantizedSignal(100, 10, 31u);
+    const MinMaxPyramid pyramid(view(y));
+    int minIndex = -1;
+    int maxIndex = -1;
+
+    // 超出列范围的端点截断到列内
+    QVERIFY(pyramid.rangeMinMax(view(y), -5, 200, minIndex, maxIndex));
+    QString failure;
+    QVERIFY(matchesScan(pyramid, y, 0, y.size() - 1, failure));
+
+    QVERIFY(!pyramid.rangeMinMax(view(y), 10, 9, minIndex, maxIndex));
+    QVERIFY(!pyramid.rangeMinMax(view(y), 100, 120, minIndex, maxIndex));
+
+    const QVector<double> empty;
+    const MinMaxPyramid emptyPyramid(view(empty));
+    QVERIFY(!emptyPyramid.rangeMinMax(view(empty), 0, 0, minIndex, maxIndex));
+}
+
+void TestMinMaxPyramid::appendMatchesRebuild()
+{
+    const QVector<double> full = quantizedSignal(5000, 40, 41u);
+
+    // 每次追加的点数不同，覆盖补全不完整块、恰好补满块以及一次新增多层的情况
+    MinMaxPyramid pyramid;
+    const int steps[] = { 1, 15, 16, 17, 100, 1, 255, 1024, 3 };
+    int size = 0;
+    for (int step = 0; size < full.size(); ++step) {
+        size = qMin(full.size(), size + steps[step % int(sizeof(steps) / sizeof(steps[0]))]);
+        const ColumnView<double> y(full.constData(), size);
+        pyramid.append(y);
+
+        const MinMaxPyramid rebuilt(y);
+        QCOMPARE(pyramid.sampleCount(), size);
+        QCOMPARE(pyramid.levelCount(), rebuilt.levelCount());
+        for (int l = 0; l < rebuilt.levelCount(); ++l) {
+            const MinMaxPyramid::Level& actual = pyramid.level(l);
+            const MinMaxPyramid::Level& expected = rebuilt.level(l);
+            QCOMPARE(actual.minIndex.size(), expected.minIndex.size());
+            for (int b = 0; b < expected.minIndex.size(); ++b) {
+                QCOMPARE(y[actual.minIndex[b]], y[expected.minIndex[b]]);
+                QCOMPARE(y[actual.maxIndex[b]], y[expected.maxIndex[b]]);
+            }
+        }
+    }
+}
+
+void TestMinMaxPyramid::levelForBlockSize()
+{
+    const QVector<double> y = quantizedSignal(1000, 10, 51u);
+    const MinMaxPyramid pyramid(view(y));
+    QVERIFY(pyramid.levelCount() > 2);
+
+    QCOMPARE(pyramid.levelForBlockSize(MinMaxPyramid::BaseBlockSize - 1), -1);
+    QCOMPARE(pyramid.levelForBlockSize(MinMaxPyramid::BaseBlockSize), 0);
+    QCOMPARE(pyramid.levelForBlockSize(2 * MinMaxPyramid::BaseBlockSize - 1), 0);
+    QCOMPARE(pyramid.levelForBlockSize(2 * MinMaxPyramid::BaseBlockSize), 1);
+    // 再大也不超过最粗一层
+    QCOMPARE(pyramid.levelForBlockSize(1 << 30), pyramid.levelCount() - 1);
+}
+
+QTEST_APPLESS_MAIN(TestMinMaxPyramid)
+
+#include "tst_min_max_pyramid.moc"
@@ -0,0 +1,144 @@
+#include "domain/model/monotonic_segment_index.h"
+#include <QtTest>
+#include <random>
+
+namespace {
+
+ColumnView<double> view(const QVector<double>& values)
+{
+    return ColumnView<double>(values.constData(), values.size());
+}
+
+/**
+ * @brief 从头逐点扫描求最接近 value 的点（距离相同时取下标最小者），作为参考
+ */
+int scanNearest(const QVector<double>& x, double value)
+{
+    int best = -1;
+    double bestDist = 0.0;
+    for (int i = 0; i < x.size(); ++i) {
+        const double dist = qAbs(x[i] - value);
+        if (best < 0 || dist < bestDist) {
+            best = i;
+            bestDist = dist;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief 整数取值的随机游走：X 值大量重复、折返频繁，半整数查询点与两侧整数等距（距离相同）
+ */
+QVector<double> integerWalk(int size, int maxStep, quint32 seed)
+{
+    std::mt19937 engine(seed);
+    std::uniform_int_distribution<int> step(-maxStep, maxStep);
+    QVector<double> x(size);
+    double value = 0.0;
+    for (int i = 0; i < size; ++i) {
+        x[i] = value;
+        value += step(engine);
+    }
+    return x;
+}
+
+/**
+ * @brief 列中每个取值、相邻取值的中点以及列范围外的点都作为查询点
+ */
+QVector<double> queriesFor(const QVector<double>& x)
+{
+    double minX = x.isEmpty() ? 0.0 : x[0];
+    double maxX = minX;
+    for (double v : x) {
+        minX = qMin(minX, v);
+        maxX = qMax(maxX, v);
+    }
+
+    QVector<double> queries;
+    for (double v = minX - 2.0; v <= maxX + 2.0; v += 0.5) {
+        queries.append(v);
+    }
+    queries.append(minX - 1e6);
+    queries.append(maxX + 1e6);
+    return queries;
+}
+
+} // namespace
+
+class TestMonotonicSegmentIndex : public QObject {
+    Q_OBJECT
+
+private slots:
+    void nearestMatchesScan_data();
+    void nearestMatchesScan();
+    void nearestOnEmptyAndSingle();
+    void segmentsShareTurningPoints();
+};
+
+void TestMonotonicSegmentIndex::nearestMatchesScan_data()
+{
+    QTest::addColumn<QVector<double>>("x");
+
+    QTest::newRow("ascending") << QVector<double>({ 0, 1, 2, 3, 5, 8, 13 });
+    QTest::newRow("descending") << QVector<double>({ 13, 8, 5, 3, 2, 1, 0 });
+    // 等值串：距离相同的一串点中必须返回第一个
+    QTest::newRow("ascending plateaus") << QVector<double>({ 0, 0, 1, 1, 1, 2, 4, 4, 6 });
+    QTest::newRow("descending plateaus") << QVector<double>({ 6, 4, 4, 2, 1, 1, 1, 0, 0 });
+    QTest::newRow("constant") << QVector<double>({ 3, 3, 3, 3 });
+    // 折返：同一取值出现在多个段中，较早的段必须优先
+    QTest::newRow("turnaround") << QVector<double>({ 0, 2, 4, 6, 4, 2, 0, 2, 4 });
+    QTest::newRow("plateau at turning point") << QVector<double>({ 0, 1, 3, 3, 3, 1, 0, 0, 2 });
+    QTest::newRow("zigzag") << QVector<double>({ 0, 1, 0, 1, 0, 1, 0 });
+    QTest::newRow("two samples") << QVector<double>({ 5, 1 });
+    QTest::newRow("jittery walk") << integerWalk(500, 2, 1u);
+    QTest::newRow("long walk") << integerWalk(5000, 5, 2u);
+}
+
+void TestMonotonicSegmentIndex::nearestMatchesScan()
+{
+    QFETCH(QVector<double>, x);
+
+    const MonotonicSegmentIndex index(view(x));
+    for (double value : queriesFor(x)) {
+        const int expected = scanNearest(x, value);
+        const int actual = index.nearest(view(x), value);
+        if (actual != expected) {
+            QFAIL(qPrintable(QString("value %1: index %2, expected %3").arg(value).arg(actual).arg(expected)));
+        }
+    }
+}
+
+void TestMonotonicSegmentIndex::nearestOnEmptyAndSingle()
+{
+    const QVector<double> empty;
+    QCOMPARE(MonotonicSegmentIndex(view(empty)).nearest(view(empty), 1.0), -1);
+
+    const QVector<double> single({ 42.0 });
+    QCOMPARE(MonotonicSegmentIndex(view(single)).nearest(view(single), -100.0), 0);
+}
+
+void TestMonotonicSegmentIndex::segmentsShareTurningPoints()
+{
+    const QVector<double> x = integerWalk(2000, 3, 3u);
+    const MonotonicSegmentIndex index(view(x));
+    const QVector<MonotonicSegmentIndex::Segment>& segments = index.segments();
+    QVERIFY(!segments.isEmpty());
+
+    // 各段首尾相接、覆盖整列，段内单调方向与标记一致
+    QCOMPARE(segments.first().first, 0);
+    QCOMPARE(segments.last().last, x.size() - 1);
+    for (int s = 0; s < segments.size(); ++s) {
+        const MonotonicSegmentIndex::Segment& segment = segments[s];
+        QVERIFY(segment.last > segment.first);
+        if (s > 0) {
+            QCOMPARE(segment.first, segments[s - 1].last);
+        }
+        for (int i = segment.first; i < segment.last; ++i) {
+            QVERIFY(segment.ascending ? x[i] <= x[i + 1] : x[i] >= x[i + 1]);
+        }
+    }
+}
+
+QTEST_APPLESS_MAIN(TestMonotonicSegmentIndex)
+
+#include "tst_monotonic_segment_index.moc"
@@ -0,0 +1,19 @@
+QT       += core testlib
+QT       -= gui
+
+CONFIG += c++17 console testcase
+CONFIG -= app_bundle
+
+TARGET = tst_sliding_window_difference
+
+INCLUDEPATH += $$PWD/../../src
+
+win32:msvc: QMAKE_CXXFLAGS += /utf-8
+win32:g++:  QMAKE_CXXFLAGS += -finput-charset=UTF-8 -fexec-charset=UTF-8
+
+SOURCES += \
+    tst_sliding_window_difference.cpp \
+    ../../src/infrastructure/algorithm/sliding_window_difference.cpp
+
+HEADERS += \
+    ../../src/infrastructure/algorithm/sliding_window_difference.h
@@ -0,0 +1,121 @@
+#include "infrastructure/algorithm/sliding_window_difference.h"
+#include <QtTest>
+#include <random>
+
+namespace {
+
+/**
+ * @brief 原微分算法的逐窗口直接求和内核（O(N × halfWin)），作为数值参考
+ */
+QVector<double> referenceDifferences(const QVector<double>& values, int halfWin)
+{
+    QVector<double> out;
+    for (int i = halfWin; i < values.size() - halfWin; ++i) {
+        double sum_before = 0.0;
+        double sum_after = 0.0;
+        for (int j = 1; j <= halfWin; ++j) {
+            sum_before += values[i - j];
+            sum_after += values[i + j];
+        }
+        out.append(sum_after - sum_before);
+    }
+    return out;
+}
+
+/**
+ * @brief 带大偏移量和噪声的随机游走（模拟 TGA 质量信号，放大增量更新的舍入误差）
+ */
+QVector<double> randomSignal(int size, quint32 seed)
+{
+    std::mt19937 engine(seed);
+    std::normal_distribution<double> step(0.0, 0.01);
+    std::normal_distribution<double> noise(0.0, 1e-3);
+    QVector<double> values(size);
+    double level = 1000.0;
+    for (int i = 0; i < size; ++i) {
+        level += step(engine);
+        values[i] = level + noise(engine);
+    }
+    return values;
+}
+
+ColumnView<double> view(const QVector<double>& values)
+{
+    return ColumnView<double>(values.constData(), values.size());
+}
+
+} // namespace
+
+class TestSlidingWindowDifference : public QObject {
+    Q_OBJECT
+
+private slots:
+    void matchesDirectSum_data();
+    void matchesDirectSum();
+    void rejectsShortInput();
+    void stopsWhenCancelled();
+};
+
+void TestSlidingWindowDifference::matchesDirectSum_data()
+{
+    QTest::addColumn<int>("size");
+    QTest::addColumn<int>("halfWin");
+    QTest::addColumn<quint32>("seed");
+
+    // 覆盖最小输入、窗口为 1、跨越多个重新同步间隔以及不同窗口大小
+    QTest::newRow("minimal") << 3 << 1 << 1u;
+    QTest::newRow("halfWin 1") << 1000 << 1 << 2u;
+    QTest::newRow("halfWin 7") << 5000 << 7 << 3u;
+    QTest::newRow("default halfWin") << 20000 << 50 << 4u;
+    QTest::newRow("wide window") << 30000 << 733 << 5u;
+    QTest::newRow("window near resync interval") << 3 * SlidingWindowDifference::ResyncInterval << 2000 << 6u;
+}
+
+void TestSlidingWindowDifference::matchesDirectSum()
+{
+    QFETCH(int, size);
+    QFETCH(int, halfWin);
+    QFETCH(quint32, seed);
+
+    const QVector<double> values = randomSignal(size, seed);
+    const QVector<double> expected = referenceDifferences(values, halfWin);
+
+    QVector<double> actual;
+    QVERIFY(SlidingWindowDifference::compute(view(values), halfWin, actual));
+    QCOMPARE(actual.size(), expected.size());
+
+    // 误差以窗口内数值的量级为尺度：两种求和顺序只应在舍入误差级别上不同
+    const double tolerance = 1e-12 * 2.0 * halfWin * 1000.0;
+    for (int k = 0; k < expected.size(); ++k) {
+        if (qAbs(actual[k] - expected[k]) > tolerance) {
+            QFAIL(qPrintable(QString("k=%1: %2 != %3").arg(k).arg(actual[k], 0, 'g', 17).arg(expected[k], 0, 'g', 17)));
+        }
+    }
+}
+
+void TestSlidingWindowDifference::rejectsShortInput()
+{
+    const QVector<double> values = randomSignal(10, 7u);
+    QVector<double> out;
+    QVERIFY(!SlidingWindowDifference::compute(view(values), 5, out));
+    QVERIFY(out.isEmpty());
+    QVERIFY(!SlidingWindowDifference::compute(view(values), 0, out));
+}
+
+void TestSlidingWindowDifference::stopsWhenCancelled()
+{
+    const QVector<double> values = randomSignal(10000, 8u);
+    QVector<double> out;
+    int calls = 0;
+    const bool completed = SlidingWindowDifference::compute(view(values), 10, out, [&](int processed) {
+        ++calls;
+        return processed < 500;
+    });
+    QVERIFY(!completed);
+    QVERIFY(out.isEmpty());
+    QCOMPARE(calls, 500 / SlidingWindowDifference::CheckInterval + 1);
+}
+
+QTEST_APPLESS_MAIN(TestSlidingWindowDifference)
+
+#include "tst_sliding_window_difference.moc"
@@ -0,0 +1,27 @@
+QT       += core testlib
+QT       -= gui
+
+CONFIG += c++17 console testcase
+CONFIG -= app_bundle
+
+TARGET = tst_text_data_parser
+
+INCLUDEPATH += $$PWD/../../src
+
+win32:msvc: QMAKE_CXXFLAGS += /utf-8
+win32:g++:  QMAKE_CXXFLAGS += -finput-charset=UTF-8 -fexec-charset=UTF-8
+
+SOURCES += \
+    tst_text_data_parser.cpp \
+    ../../src/infrastructure/io/text_data_parser.cpp \
+    ../../src/domain/model/thermal_data_series.cpp \
+    ../../src/domain/model/monotonic_segment_index.cpp \
+    ../../src/domain/model/cumulative_integral.cpp \
+    ../../src/domain/model/min_max_pyramid.cpp
+
+HEADERS += \
+    ../../src/infrastructure/io/text_data_parser.h \
+    ../../src/domain/model/thermal_data_series.h \
+    ../../src/domain/model/monotonic_segment_index.h \
+    ../../src/domain/model/cumulative_integral.h \
+    ../../src/domain/model/min_max_pyramid.h
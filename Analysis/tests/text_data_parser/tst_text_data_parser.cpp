@@ -0,0 +1,324 @@
+#include "infrastructure/io/text_data_parser.h"
+#include <QtTest>
+#include <cmath>
+#include <random>
+
+namespace {
+
+struct Row {
+    double time;
+    double temperature;
+    double value;
+};
+
+/**
+ * @brief 时间/温度/信号依次为第 0/1/2 列，温度缺失时取 -1（便于与解析出的 0.0 区分）
+ */
+TextColumnLayout threeColumnLayout(char separator = 0)
+{
+    TextColumnLayout layout;
+    layout.timeColumn = 0;
+    layout.tempColumn = 1;
+    layout.signalColumn = 2;
+    layout.tempFixedValue = -1.0;
+    layout.separator = separator;
+    return layout;
+}
+
+QVector<Row> rowsOf(TextDataParser& parser)
+{
+    const ThermalDataSeries series = parser.takeSeries();
+    QVector<Row> rows;
+    for (int i = 0; i < series.size(); ++i) {
+        rows.append({ series.timeAt(i), series.temperatureAt(i), series.valueAt(i) });
+    }
+    return rows;
+}
+
+QVector<Row> parseWhole(const QByteArray& text, const TextColumnLayout& layout)
+{
+    TextDataParser parser(layout);
+    parser.feed(text.constData(), text.size());
+    parser.finish();
+    return rowsOf(parser);
+}
+
+/**
+ * @brief 按 cuts 中的位置把输入切成多块依次 feed()
+ */
+QVector<Row> parseInBlocks(const QByteArray& text, const TextColumnLayout& layout, const QVector<int>& cuts)
+{
+    TextDataParser parser(layout);
+    int begin = 0;
+    for (int cut : cuts) {
+        parser.feed(text.constData() + begin, cut - begin);
+        begin = cut;
+    }
+    parser.feed(text.constData() + begin, text.size() - begin);
+    parser.finish();
+    return rowsOf(parser);
+}
+
+bool sameRows(const QVector<Row>& actual, const QVector<Row>& expected)
+{
+    if (actual.size() != expected.size()) {
+        return false;
+    }
+    for (int i = 0; i < actual.size(); ++i) {
+        if (actual[i].time != expected[i].time || actual[i].temperature != expected[i].temperature
+            || actual[i].value != expected[i].value) {
+            return false;
+        }
+    }
+    return true;
+}
+
+QList<QByteArray> splitAll(const QByteArray& line, char separator)
+{
+    QList<QByteArray> fields;
+    const char* field = line.constData();
+    const char* const end = line.constData() + line.size();
+    while (field) {
+        const char* fieldEnd = field;
+        const char* next = TextDataParser::splitField(field, end, separator, &fieldEnd);
+        fields.append(QByteArray(field, int(fieldEnd - field)));
+        field = next;
+    }
+    return fields;
+}
+
+// UTF-8 BOM + 中文表头 + 英文表头 + CRLF 数据行，最后一行没有换行
+const QByteArray kBomCrlfText = QByteArray("\xEF\xBB\xBF")
+    + QByteArray("\xE6\x97\xB6\xE9\x97\xB4 \xE6\xB8\xA9\xE5\xBA\xA6 \xE4\xBF\xA1\xE5\x8F\xB7\r\n") // 时间 温度 信号
+    + QByteArray("Time Temp Signal\r\n"
+                 "0 25.5 1.25\r\n"
+                 "\r\n"
+                 "60 26.0 -3e-2\r\n"
+                 "  120\t26.5  0.5  \r\n"
+                 "180 27.0 7");
+
+const QVector<Row> kBomCrlfRows = {
+    { 0.0, 25.5, 1.25 },
+    { 60.0, 26.0, -3e-2 },
+    { 120.0, 26.5, 0.5 },
+    { 180.0, 27.0, 7.0 },
+};
+
+} // namespace
+
+class TestTextDataParser : public QObject {
+    Q_OBJECT
+
+private slots:
+    void parseDoubleAccepts_data();
+    void parseDoubleAccepts();
+    void parseDoubleRejects_data();
+    void parseDoubleRejects();
+    void parseDoubleMatchesQt();
+    void splitFieldBySeparator();
+    void splitFieldByWhitespace();
+    void carriesLinesAcrossTwoBlocks();
+    void carriesLinesAcrossSingleBytes();
+    void keepsBytesThatOnlyStartLikeBom();
+    void midStreamKeepsLeadingBytes();
+    void localeSeparators();
+    void malformedNumbers();
+};
+
+void TestTextDataParser::parseDoubleAccepts_data()
+{
+    QTest::addColumn<QByteArray>("text");
+    QTest::addColumn<double>("expected");
+
+    QTest::newRow("integer") << QByteArray("42") << 42.0;
+    QTest::newRow("decimal") << QByteArray("25.125") << 25.125;
+    QTest::newRow("leading plus") << QByteArray("+7.5") << 7.5;
+    QTest::newRow("negative") << QByteArray("-0.001") << -0.001;
+    QTest::newRow("no integer part") << QByteArray(".5") << 0.5;
+    QTest::newRow("no fraction digits") << QByteArray("5.") << 5.0;
+    QTest::newRow("exponent") << QByteArray("1.5e3") << 1500.0;
+    QTest::newRow("negative exponent") << QByteArray("-3E-2") << -0.03;
+    QTest::newRow("leading zeros") << QByteArray("000.000123") << 0.000123;
+    QTest::newRow("long mantissa") << QByteArray("3.14159265358979323846264338") << 3.14159265358979323846264338;
+    QTest::newRow("large exponent") << QByteArray("1e300") << 1e300;
+    QTest::newRow("small exponent") << QByteArray("2.5e-300") << 2.5e-300;
+}
+
+void TestTextDataParser::parseDoubleAccepts()
+{
+    QFETCH(QByteArray, text);
+    QFETCH(double, expected);
+
+    double value = 0.0;
+    QVERIFY(TextDataParser::parseDouble(text.constData(), text.constData() + text.size(), value));
+    QCOMPARE(value, expected);
+}
+
+void TestTextDataParser::parseDoubleRejects_data()
+{
+    QTest::addColumn<QByteArray>("text");
+
+    QTest::newRow("empty") << QByteArray();
+    QTest::newRow("sign only") << QByteArray("-");
+    QTest::newRow("plus minus") << QByteArray("+-1");
+    QTest::newRow("double minus") << QByteArray("--1");
+    QTest::newRow("letters") << QByteArray("abc");
+    QTest::newRow("trailing letters") << QByteArray("12abc");
+    QTest::newRow("two points") << QByteArray("1.2.3");
+    QTest::newRow("dangling exponent") << QByteArray("1e");
+    QTest::newRow("exponent sign only") << QByteArray("1e+");
+    QTest::newRow("decimal comma") << QByteArray("1,5");
+    QTest::newRow("group separator") << QByteArray("1,234.5");
+}
+
+void TestTextDataParser::parseDoubleRejects()
+{
+    QFETCH(QByteArray, text);
+
+    double value = 0.0;
+    QVERIFY(!TextDataParser::parseDouble(text.constData(), text.constData() + text.size(), value));
+}
+
+void TestTextDataParser::parseDoubleMatchesQt()
+{
+    // 随机数值按不同精度格式化：快速路径与回退路径都必须与 QByteArray::toDouble 逐位一致
+    std::mt19937 engine(11u);
+    std::uniform_real_distribution<double> mantissa(-10.0, 10.0);
+    std::uniform_int_distribution<int> exponent(-30, 30);
+    std::uniform_int_distribution<int> precision(1, 20);
+
+    for (int i = 0; i < 20000; ++i) {
+        const double number = mantissa(engine) * std::pow(10.0, exponent(engine));
+        const char format = (i % 2) ? 'g' : 'f';
+        const QByteArray text = QByteArray::number(number, format, format == 'f' ? precision(engine) % 8 : precision(engine));
+
+        bool ok = false;
+        const double expected = text.toDouble(&ok);
+        QVERIFY(ok);
+
+        double actual = 0.0;
+        if (!TextDataParser::parseDouble(text.constData(), text.constData() + text.size(), actual)
+            || actual != expected) {
+            QFAIL(qPrintable(QString("%1: %2 != %3").arg(QString::fromLatin1(text))
+                                 .arg(actual, 0, 'g', 17).arg(expected, 0, 'g', 17)));
+        }
+    }
+}
+
+void TestTextDataParser::splitFieldBySeparator()
+{
+    QCOMPARE(splitAll("1.5,20,3", ','), (QList<QByteArray>{ "1.5", "20", "3" }));
+    // 空字段与末尾分隔符之后的空字段都保留
+    QCOMPARE(splitAll("a,,b,", ','), (QList<QByteArray>{ "a", "", "b", "" }));
+    // 分隔符两侧的空白属于字段本身（由调用方去除）
+    QCOMPARE(splitAll("1 ; 2", ';'), (QList<QByteArray>{ "1 ", " 2" }));
+    QCOMPARE(splitAll("1,5;2,5", ';'), (QList<QByteArray>{ "1,5", "2,5" }));
+}
+
+void TestTextDataParser::splitFieldByWhitespace()
+{
+    // 连续空白（空格、制表符混合）视为一个分隔
+    QCOMPARE(splitAll("1  2\t\t3 \t4", 0), (QList<QByteArray>{ "1", "2", "3", "4" }));
+    QCOMPARE(splitAll("single", 0), (QList<QByteArray>{ "single" }));
+    // 空白分隔时逗号是字段内容
+    QCOMPARE(splitAll("1,5 2", 0), (QList<QByteArray>{ "1,5", "2" }));
+}
+
+void TestTextDataParser::carriesLinesAcrossTwoBlocks()
+{
+    const TextColumnLayout layout = threeColumnLayout();
+    QVERIFY(sameRows(parseWhole(kBomCrlfText, layout), kBomCrlfRows));
+
+    // 每个切分位置都要覆盖：BOM 中间、CR 与 LF 之间、数字中间、行首行尾
+    for (int cut = 0; cut <= kBomCrlfText.size(); ++cut) {
+        if (!sameRows(parseInBlocks(kBomCrlfText, layout, { cut }), kBomCrlfRows)) {
+            QFAIL(qPrintable(QString("cut at byte %1").arg(cut)));
+        }
+    }
+}
+
+void TestTextDataParser::carriesLinesAcrossSingleBytes()
+{
+    QVector<int> cuts;
+    for (int i = 1; i < kBomCrlfText.size(); ++i) {
+        cuts.append(i);
+    }
+    QVERIFY(sameRows(parseInBlocks(kBomCrlfText, threeColumnLayout(), cuts), kBomCrlfRows));
+}
+
+void TestTextDataParser::keepsBytesThatOnlyStartLikeBom()
+{
+    // 与 BOM 前两个字节相同但第三个字节不同：不是 BOM，这些字节属于第一行（非 ASCII 开头，按表头跳过）
+    const QByteArray text = QByteArray("\xEF\xBB") + "x\n1 2 3\n";
+    const QVector<Row> expected = { { 1.0, 2.0, 3.0 } };
+    for (int cut = 0; cut <= text.size(); ++cut) {
+        if (!sameRows(parseInBlocks(text, threeColumnLayout(), { cut }), expected)) {
+            QFAIL(qPrintable(QString("cut at byte %1").arg(cut)));
+        }
+    }
+
+    // BOM 之后直接是数据行
+    const QByteArray bomData = QByteArray("\xEF\xBB\xBF") + "4 5 6";
+    for (int cut = 0; cut <= bomData.size(); ++cut) {
+        if (!sameRows(parseInBlocks(bomData, threeColumnLayout(), { cut }), { { 4.0, 5.0, 6.0 } })) {
+            QFAIL(qPrintable(QString("cut at byte %1").arg(cut)));
+        }
+    }
+}
+
+void TestTextDataParser::midStreamKeepsLeadingBytes()
+{
+    // 分段解析的后续段从行首开始：开头的数字不能被当作 BOM 检查吞掉，中文表头按文件的 BOM 改用 UTF-8
+    const QByteArray segment = QByteArray("\xE6\x97\xB6\xE9\x97\xB4\n") + "7 8 9\r\n10 11 12";
+    TextDataParser parser(threeColumnLayout());
+    parser.startMidStream(true);
+    parser.feed(segment.constData(), 1);
+    parser.feed(segment.constData() + 1, segment.size() - 1);
+    parser.finish();
+    QVERIFY(sameRows(rowsOf(parser), { { 7.0, 8.0, 9.0 }, { 10.0, 11.0, 12.0 } }));
+}
+
+void TestTextDataParser::localeSeparators()
+{
+    // 分号分隔、小数点：正常解析，字段两侧的空白被忽略
+    QVERIFY(sameRows(parseWhole("1.5 ; 20.25;3\n", threeColumnLayout(';')), { { 1.5, 20.25, 3.0 } }));
+    QVERIFY(sameRows(parseWhole("1.5, 20.25 ,3\n", threeColumnLayout(',')), { { 1.5, 20.25, 3.0 } }));
+
+    // 小数逗号按 C 区域不是数值（与 QString::toDouble 一致）：时间/信号取 0，温度取固定值
+    QVERIFY(sameRows(parseWhole("1,5;20,25;3,125\n", threeColumnLayout(';')), { { 0.0, -1.0, 0.0 } }));
+
+    // 逗号分隔时小数逗号会把一个数切成两列
+    QVERIFY(sameRows(parseWhole("1,5,20\n", threeColumnLayout(',')), { { 1.0, 5.0, 20.0 } }));
+}
+
+void TestTextDataParser::malformedNumbers()
+{
+    TextColumnLayout layout = threeColumnLayout();
+    layout.timeFactor = 60.0;
+    layout.tempOffset = 10.0;
+
+    const QByteArray text = "1 2 3\n"
+                            "1x 2 3\n"      // 时间无法解析
+                            "1 -- 3\n"      // 温度无法解析：取固定值（不加偏移）
+                            "1 2 3.3.3\n"   // 信号无法解析
+                            "1\n"           // 缺少温度与信号列
+                            "-5 +2 .5e1\n";
+    const QVector<Row> expected = {
+        { 60.0, 12.0, 3.0 },
+        { 0.0, 12.0, 3.0 },
+        { 60.0, -1.0, 3.0 },
+        { 60.0, 12.0, 0.0 },
+        { 60.0, -1.0, 0.0 },
+        { -300.0, 12.0, 5.0 },
+    };
+    QVERIFY(sameRows(parseWhole(text, layout), expected));
+
+    // 温度固定时不读取温度列
+    layout.tempIsFixed = true;
+    layout.tempFixedValue = 30.0;
+    QVERIFY(sameRows(parseWhole("1 abc 3\n", layout), { { 60.0, 30.0, 3.0 } }));
+}
+
+QTEST_APPLESS_MAIN(TestTextDataParser)
+
+#include "tst_text_data_parser.moc"